@@ -37,6 +37,7 @@ use revaer_torrent_core::{
 };
 pub use revaer_torrent_core::{
     FilePriority, FilePriorityOverride, TorrentCleanupPolicy, TorrentLabelPolicy, TorrentRateLimit,
+    model::TorrentAuthorFormat,
 };
 
 /// RFC9457-compatible problem document surfaced on validation/runtime errors.
@@ -2516,6 +2517,9 @@ pub struct TorrentCreateRequest {
     /// Percentage of pieces to hash-check before honoring seed mode.
     pub hash_check_sample_pct: Option<u8>,
     #[serde(default)]
+    /// Hashes every piece of existing data before admission so the torrent starts verified.
+    pub pre_verify: Option<bool>,
+    #[serde(default)]
     /// Enables super-seeding on admission when set.
     pub super_seeding: Option<bool>,
     #[serde(default)]
@@ -2602,6 +2606,7 @@ impl TorrentCreateRequest {
             hash_check_sample_pct: self
                 .hash_check_sample_pct
                 .and_then(|value| if value > 0 { Some(value) } else { None }),
+            pre_verify: self.pre_verify,
             super_seeding: self.super_seeding,
             file_rules: FileSelectionRules {
                 include: self.include.clone(),
@@ -2685,6 +2690,12 @@ pub struct TorrentAuthorRequest {
     #[serde(default)]
     /// Optional source label embedded in the metainfo.
     pub source: Option<String>,
+    #[serde(default)]
+    /// Metainfo format to author: `v1` (default), `hybrid` or `v2`.
+    pub format: TorrentAuthorFormat,
+    #[serde(default)]
+    /// Optional number of hashing threads; defaults to the available parallelism.
+    pub hash_threads: Option<u32>,
 }
 
 impl TorrentAuthorRequest {
@@ -2704,6 +2715,8 @@ impl TorrentAuthorRequest {
             private: self.private,
             comment: self.comment.clone(),
             source: self.source.clone(),
+            hash_threads: self.hash_threads,
+            format: self.format,
         }
     }
 }
@@ -2726,6 +2739,12 @@ pub struct TorrentAuthorResponse {
     pub magnet_uri: String,
     /// Best available info hash string.
     pub info_hash: String,
+    #[serde(default, skip_serializing_if = "Option::is_none")]
+    /// SHA-1 info hash when the metainfo carries a v1 info dictionary.
+    pub info_hash_v1: Option<String>,
+    #[serde(default, skip_serializing_if = "Option::is_none")]
+    /// SHA-256 info hash when the metainfo carries a v2 info dictionary.
+    pub info_hash_v2: Option<String>,
     /// Effective piece length in bytes.
     pub piece_length: u32,
     /// Total payload size in bytes.
@@ -2768,6 +2787,8 @@ impl TorrentAuthorResponse {
             metainfo: general_purpose::STANDARD.encode(result.metainfo),
             magnet_uri: result.magnet_uri,
             info_hash: result.info_hash,
+            info_hash_v1: result.info_hash_v1,
+            info_hash_v2: result.info_hash_v2,
             piece_length: result.piece_length,
             total_size: result.total_size,
             files,
@@ -3066,6 +3087,7 @@ mod tests {
             start_paused: Some(true),
             seed_mode: Some(true),
             hash_check_sample_pct: Some(25),
+            pre_verify: Some(true),
             super_seeding: Some(true),
             tags: vec!["tag-a".to_string(), "tag-b".to_string()],
             auto_managed: Some(false),
@@ -3095,6 +3117,7 @@ mod tests {
         assert_eq!(options.start_paused, Some(true));
         assert_eq!(options.seed_mode, Some(true));
         assert_eq!(options.hash_check_sample_pct, Some(25));
+        assert_eq!(options.pre_verify, Some(true));
         assert_eq!(options.super_seeding, Some(true));
         assert_eq!(options.tags, vec!["tag-a".to_string(), "tag-b".to_string()]);
         assert_eq!(options.auto_managed, Some(false));
@@ -3510,17 +3533,27 @@ mod tests {
             private: true,
             comment: Some("comment".to_string()),
             source: Some("source".to_string()),
+            format: TorrentAuthorFormat::V2,
+            hash_threads: Some(4),
         };
         let core = request.to_core();
         assert_eq!(core.root_path, "/data");
         assert_eq!(core.trackers, request.trackers);
         assert!(core.file_rules.skip_fluff);
         assert_eq!(core.piece_length, Some(262_144));
+        assert_eq!(core.format, TorrentAuthorFormat::V2);
+        assert_eq!(core.hash_threads, Some(4));
+
+        let defaulted = TorrentAuthorRequest::default().to_core();
+        assert_eq!(defaulted.format, TorrentAuthorFormat::V1);
+        assert_eq!(defaulted.hash_threads, None);
 
         let response = TorrentAuthorResponse::from_core(CoreTorrentAuthorResult {
             metainfo: b"payload".to_vec(),
             magnet_uri: "magnet:?xt=urn:btih:test".to_string(),
             info_hash: "abcd".to_string(),
+            info_hash_v1: Some("abcd".to_string()),
+            info_hash_v2: Some("ef01".to_string()),
             piece_length: 262_144,
             total_size: 4_096,
             files: vec![revaer_torrent_core::model::TorrentAuthorFile {
@@ -3545,6 +3578,8 @@ mod tests {
             vec!["http://seed.example/file".to_string()]
         );
         assert!(response.private);
+        assert_eq!(response.info_hash_v1.as_deref(), Some("abcd"));
+        assert_eq!(response.info_hash_v2.as_deref(), Some("ef01"));
     }
 
     #[test]
@@ -31,6 +31,7 @@ pub(crate) const EVENT_KIND_WHITELIST: &[&str] = &[
     "torrent_added",
     "files_discovered",
     "progress",
+    "file_progress",
     "state_changed",
     "completed",
     "metadata_updated",
@@ -286,6 +286,7 @@ pub(crate) async fn sync_maindata(
             CoreEvent::TorrentAdded { torrent_id, .. }
             | CoreEvent::FilesDiscovered { torrent_id, .. }
             | CoreEvent::Progress { torrent_id, .. }
+            | CoreEvent::FileProgress { torrent_id, .. }
             | CoreEvent::StateChanged { torrent_id, .. }
             | CoreEvent::Completed { torrent_id, .. }
             | CoreEvent::MetadataUpdated { torrent_id, .. }
@@ -141,6 +141,11 @@ mod tests {
             coalesce_reads: EngineProfile::default_coalesce_reads(),
             coalesce_writes: EngineProfile::default_coalesce_writes(),
             use_disk_cache_pool: EngineProfile::default_use_disk_cache_pool(),
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
+            disk_io_backend: None,
+            aio_threads: None,
+            hashing_threads: None,
             tracker: TrackerConfig::default(),
             enable_lsd: false.into(),
             enable_upnp: false.into(),
@@ -107,6 +107,7 @@ pub(crate) fn matches_sse_filter(envelope: &EventEnvelope, filter: &SseFilter) -
             CoreEvent::TorrentAdded { torrent_id, .. }
             | CoreEvent::FilesDiscovered { torrent_id, .. }
             | CoreEvent::Progress { torrent_id, .. }
+            | CoreEvent::FileProgress { torrent_id, .. }
             | CoreEvent::StateChanged { torrent_id, .. }
             | CoreEvent::Completed { torrent_id, .. }
             | CoreEvent::MetadataUpdated { torrent_id, .. }
@@ -958,6 +958,13 @@ fn build_add_torrent(
         }
     }
 
+    let pre_verify = matches!(request.pre_verify, Some(true));
+    if pre_verify && matches!(request.seed_mode, Some(true)) {
+        return Err(ApiError::bad_request(
+            "pre_verify cannot be combined with seed_mode",
+        ));
+    }
+
     if let Some(position) = request.queue_position
         && position < 0
     {
@@ -972,12 +979,18 @@ fn build_add_torrent(
         ));
     }
 
-    let prefer_metainfo =
-        matches!(request.seed_mode, Some(true)) || request.hash_check_sample_pct.unwrap_or(0) > 0;
+    let prefer_metainfo = pre_verify
+        || matches!(request.seed_mode, Some(true))
+        || request.hash_check_sample_pct.unwrap_or(0) > 0;
 
     let source = if prefer_metainfo {
         match metainfo_bytes.clone() {
             Some(bytes) => TorrentSource::metainfo(bytes),
+            None if pre_verify => {
+                return Err(ApiError::bad_request(
+                    "pre_verify requires a metainfo payload",
+                ));
+            }
             None => {
                 return Err(ApiError::bad_request(
                     "seed_mode/hash_check_sample_pct requires a metainfo payload",
@@ -1039,8 +1052,8 @@ mod tests {
         RemoveTorrent, TorrentCleanupPolicy, TorrentError, TorrentFile, TorrentLabelPolicy,
         TorrentRateLimit, TorrentResult, TorrentStatus,
         model::{
-            PieceDeadline, TorrentAuthorFile, TorrentAuthorResult, TorrentOptionsUpdate,
-            TorrentTrackersUpdate, TorrentWebSeedsUpdate,
+            PieceDeadline, TorrentAuthorFile, TorrentAuthorFormat, TorrentAuthorResult,
+            TorrentOptionsUpdate, TorrentTrackersUpdate, TorrentWebSeedsUpdate,
         },
     };
     use serde_json::json;
@@ -1130,6 +1143,25 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn build_add_torrent_rejects_pre_verify_without_metainfo() -> Result<()> {
+        let request = TorrentCreateRequest {
+            id: Uuid::new_v4(),
+            magnet: Some(
+                "magnet:?xt=urn:btih:0123456789abcdef0123456789abcdef01234567".to_string(),
+            ),
+            pre_verify: Some(true),
+            ..TorrentCreateRequest::default()
+        };
+
+        let err = build_add_torrent(&request, Vec::new(), Vec::new(), None)
+            .err()
+            .ok_or_else(|| anyhow!("expected pre-verify metainfo error"))?;
+        assert_eq!(err.status(), StatusCode::BAD_REQUEST);
+        assert_eq!(err.detail(), Some("pre_verify requires a metainfo payload"));
+        Ok(())
+    }
+
     #[test]
     fn build_add_torrent_rejects_negative_queue_position() -> Result<()> {
         let request = TorrentCreateRequest {
@@ -1264,6 +1296,8 @@ mod tests {
             metainfo: b"payload".to_vec(),
             magnet_uri: "magnet:?xt=urn:btih:demo".to_string(),
             info_hash: "deadbeef".to_string(),
+            info_hash_v1: Some("deadbeef".to_string()),
+            info_hash_v2: None,
             piece_length: 16_384,
             total_size: 42,
             files: vec![TorrentAuthorFile {
@@ -1367,6 +1401,8 @@ mod tests {
             private: true,
             comment: Some("note".to_string()),
             source: Some("source".to_string()),
+            format: TorrentAuthorFormat::V1,
+            hash_threads: Some(2),
         };
 
         let Json(response) = create_torrent_authoring(
@@ -1407,6 +1443,8 @@ mod tests {
         );
         assert_eq!(recorded.piece_length, None);
         assert!(recorded.file_rules.skip_fluff);
+        assert_eq!(recorded.format, TorrentAuthorFormat::V1);
+        assert_eq!(recorded.hash_threads, Some(2));
         Ok(())
     }
 
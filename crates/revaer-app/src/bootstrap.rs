@@ -21,7 +21,15 @@ use crate::orchestrator::{
     EngineConfigurator, LibtorrentOrchestratorDeps, spawn_libtorrent_orchestrator,
 };
 #[cfg(feature = "libtorrent")]
+use revaer_config::normalize_engine_profile;
+#[cfg(feature = "libtorrent")]
 use revaer_torrent_core::{TorrentEngine, TorrentInspector, TorrentWorkflow};
+#[cfg(feature = "libtorrent")]
+use revaer_torrent_libt::LibtorrentEngine;
+
+/// How often libtorrent session counters are copied into the metrics registry.
+#[cfg(feature = "libtorrent")]
+const ENGINE_STATS_INTERVAL: Duration = Duration::from_secs(5);
 
 /// Dependencies required to bootstrap the Revaer application.
 pub(crate) struct BootstrapDependencies {
@@ -71,9 +79,15 @@ impl BootstrapDependencies {
         let _runtime: Option<RuntimeStore> = None;
 
         #[cfg(feature = "libtorrent")]
-        let libtorrent = Some(LibtorrentOrchestratorDeps::new(
-            &events, &telemetry, runtime,
-        )?);
+        let libtorrent = {
+            let storage = normalize_engine_profile(&snapshot.engine_profile).storage;
+            Some(LibtorrentOrchestratorDeps::new(
+                &events,
+                &telemetry,
+                runtime,
+                &storage.resume_dir,
+            )?)
+        };
 
         Ok(Self {
             logging,
@@ -264,9 +278,9 @@ async fn run_bootstrap_services(dependencies: BootstrapDependencies) -> AppResul
     let addr = bootstrap_listener_addr(&snapshot.app_profile, &telemetry, &events)?;
 
     #[cfg(feature = "libtorrent")]
-    let (fsops_worker, config_task, torrent_handles) = {
+    let (fsops_worker, config_task, stats_task, torrent_handles) = {
         let libtorrent = libtorrent.ok_or(AppError::MissingDependency { name: "libtorrent" })?;
-        let (_engine, orchestrator, worker) = spawn_libtorrent_orchestrator(
+        let (engine, orchestrator, worker) = spawn_libtorrent_orchestrator(
             &events,
             snapshot.fs_policy.clone(),
             snapshot.engine_profile.clone(),
@@ -284,7 +298,8 @@ async fn run_bootstrap_services(dependencies: BootstrapDependencies) -> AppResul
             events.clone(),
             telemetry.clone(),
         );
-        (worker, config_task, Some(handles))
+        let stats_task = spawn_engine_stats_task(engine, telemetry.clone());
+        (worker, config_task, stats_task, Some(handles))
     };
 
     #[cfg(not(feature = "libtorrent"))]
@@ -324,6 +339,13 @@ async fn run_bootstrap_services(dependencies: BootstrapDependencies) -> AppResul
         if let Err(err) = config_task.await {
             warn!(error = %err, "config watcher task join failed");
         }
+
+        if !stats_task.is_finished() {
+            stats_task.abort();
+        }
+        if let Err(err) = stats_task.await {
+            warn!(error = %err, "engine stats task join failed");
+        }
     }
 
     serve_result.map_err(|err| AppError::api_server("api_server.serve", err))?;
@@ -454,6 +476,54 @@ where
     })
 }
 
+#[cfg(feature = "libtorrent")]
+fn spawn_engine_stats_task(
+    engine: Arc<LibtorrentEngine>,
+    telemetry: Metrics,
+) -> tokio::task::JoinHandle<()> {
+    tokio::spawn(async move {
+        let mut ticker = tokio::time::interval(ENGINE_STATS_INTERVAL);
+        let mut last_sequence = 0;
+        let mut sampling_failed = false;
+        loop {
+            ticker.tick().await;
+            // A failed sample (worker busy restarting, session rebuilt) is transient: keep
+            // ticking, warning once per outage rather than on every interval.
+            let stats = match engine.inspect_session_stats().await {
+                Ok(stats) => {
+                    if sampling_failed {
+                        info!("engine stats sampling recovered");
+                        sampling_failed = false;
+                    }
+                    stats
+                }
+                Err(err) => {
+                    if !sampling_failed {
+                        warn!(error = %err, "engine stats sampling failed; retrying");
+                        sampling_failed = true;
+                    }
+                    continue;
+                }
+            };
+            if stats.sequence == last_sequence {
+                continue;
+            }
+            last_sequence = stats.sequence;
+            telemetry.set_engine_session_stats(
+                stats
+                    .iter()
+                    .map(|(metric, value)| (metric.name.as_str(), value)),
+            );
+            if let Some(received) = stats.get("net.recv_bytes") {
+                telemetry.set_engine_bytes_in(received);
+            }
+            if let Some(sent) = stats.get("net.sent_bytes") {
+                telemetry.set_engine_bytes_out(sent);
+            }
+        }
+    })
+}
+
 #[cfg(feature = "libtorrent")]
 async fn apply_config_snapshot<E>(
     snapshot: revaer_config::ConfigSnapshot,
@@ -6,8 +6,8 @@
 //! - Keeps encryption mapping centralised to avoid drift between API/config/runtime layers.
 
 use revaer_config::engine_profile::{
-    AltSpeedConfig, ChokingAlgorithm, DiskIoMode, PeerClassesConfig, SeedChokingAlgorithm,
-    StorageMode as ConfigStorageMode,
+    AltSpeedConfig, ChokingAlgorithm, DiskIoBackend, DiskIoMode, PeerClassesConfig,
+    SeedChokingAlgorithm, StorageMode as ConfigStorageMode,
 };
 use revaer_config::{
     EngineEncryptionPolicy, EngineIpv6Mode, EngineNetworkConfig, EngineProfile,
@@ -22,7 +22,8 @@ use revaer_torrent_libt::{
     types::{
         AltSpeedRuntimeConfig as RuntimeAltSpeedConfig,
         AltSpeedSchedule as RuntimeAltSpeedSchedule, ChokingAlgorithm as RuntimeChokingAlgorithm,
-        DiskIoMode as RuntimeDiskIoMode, OutgoingPortRange as RuntimeOutgoingPortRange,
+        DiskIoBackend as RuntimeDiskIoBackend, DiskIoMode as RuntimeDiskIoMode,
+        OutgoingPortRange as RuntimeOutgoingPortRange,
         PeerClassRuntimeConfig as RuntimePeerClassConfig,
         SeedChokingAlgorithm as RuntimeSeedChokingAlgorithm, StorageMode as RuntimeStorageMode,
     },
@@ -69,6 +70,14 @@ impl EngineRuntimePlan {
             coalesce_reads: bool::from(effective.storage.coalesce_reads).into(),
             coalesce_writes: bool::from(effective.storage.coalesce_writes).into(),
             use_disk_cache_pool: bool::from(effective.storage.use_disk_cache_pool).into(),
+            disk_io_backend: effective
+                .storage
+                .disk_io_backend
+                .map_or(RuntimeDiskIoBackend::Auto, map_disk_io_backend),
+            aio_threads: effective.storage.aio_threads,
+            hashing_threads: effective.storage.hashing_threads,
+            resume_checkpoint_interval_ms: effective.storage.resume_checkpoint_interval_ms,
+            resume_max_inflight_saves: effective.storage.resume_max_inflight_saves,
             enable_dht: effective.network.enable_dht,
             dht_bootstrap_nodes: effective.network.dht_bootstrap_nodes.clone(),
             dht_router_nodes: effective.network.dht_router_nodes.clone(),
@@ -181,6 +190,13 @@ const fn map_disk_mode(mode: DiskIoMode) -> RuntimeDiskIoMode {
     }
 }
 
+const fn map_disk_io_backend(backend: DiskIoBackend) -> RuntimeDiskIoBackend {
+    match backend {
+        DiskIoBackend::Mmap => RuntimeDiskIoBackend::Mmap,
+        DiskIoBackend::Posix => RuntimeDiskIoBackend::Posix,
+    }
+}
+
 fn map_alt_speed(config: &AltSpeedConfig) -> Option<RuntimeAltSpeedConfig> {
     let schedule = config.schedule.as_ref()?;
     if config.download_bps.is_none() && config.upload_bps.is_none() {
@@ -375,6 +391,11 @@ mod tests {
             coalesce_reads: EngineProfile::default_coalesce_reads(),
             coalesce_writes: EngineProfile::default_coalesce_writes(),
             use_disk_cache_pool: EngineProfile::default_use_disk_cache_pool(),
+            resume_checkpoint_interval_ms: Some(-5),
+            resume_max_inflight_saves: Some(12),
+            disk_io_backend: Some("mmap".to_string()),
+            aio_threads: Some(0),
+            hashing_threads: Some(4),
             tracker: TrackerConfig::default(),
             enable_lsd: false.into(),
             enable_upnp: false.into(),
@@ -394,6 +415,11 @@ mod tests {
         assert_eq!(plan.runtime.encryption, EncryptionPolicy::Prefer);
         assert_eq!(plan.runtime.download_root, ".server_root/downloads");
         assert_eq!(plan.runtime.resume_dir, ".server_root/resume");
+        assert!(plan.runtime.resume_checkpoint_interval_ms.is_none());
+        assert_eq!(plan.runtime.resume_max_inflight_saves, Some(12));
+        assert_eq!(plan.runtime.disk_io_backend, RuntimeDiskIoBackend::Mmap);
+        assert!(plan.runtime.aio_threads.is_none());
+        assert_eq!(plan.runtime.hashing_threads, Some(4));
         assert_eq!(plan.effective.tracker, TrackerConfig::default());
         assert!(plan.runtime.tracker.default.is_empty());
         assert!(
@@ -467,6 +493,11 @@ mod tests {
             coalesce_reads: EngineProfile::default_coalesce_reads(),
             coalesce_writes: EngineProfile::default_coalesce_writes(),
             use_disk_cache_pool: EngineProfile::default_use_disk_cache_pool(),
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
+            disk_io_backend: None,
+            aio_threads: None,
+            hashing_threads: None,
             tracker: TrackerConfig::default(),
             enable_lsd: true.into(),
             enable_upnp: true.into(),
@@ -560,6 +591,11 @@ mod tests {
             coalesce_reads: EngineProfile::default_coalesce_reads(),
             coalesce_writes: EngineProfile::default_coalesce_writes(),
             use_disk_cache_pool: EngineProfile::default_use_disk_cache_pool(),
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
+            disk_io_backend: None,
+            aio_threads: None,
+            hashing_threads: None,
             tracker: TrackerConfig::default(),
             enable_lsd: false.into(),
             enable_upnp: false.into(),
@@ -649,6 +685,11 @@ mod tests {
             coalesce_reads: EngineProfile::default_coalesce_reads(),
             coalesce_writes: EngineProfile::default_coalesce_writes(),
             use_disk_cache_pool: EngineProfile::default_use_disk_cache_pool(),
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
+            disk_io_backend: None,
+            aio_threads: None,
+            hashing_threads: None,
             tracker: TrackerConfig {
                 proxy: Some(TrackerProxyConfig {
                     host: "proxy.example".to_string(),
@@ -734,6 +775,11 @@ mod tests {
             coalesce_reads: EngineProfile::default_coalesce_reads(),
             coalesce_writes: EngineProfile::default_coalesce_writes(),
             use_disk_cache_pool: EngineProfile::default_use_disk_cache_pool(),
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
+            disk_io_backend: None,
+            aio_threads: None,
+            hashing_threads: None,
             tracker: TrackerConfig::default(),
             enable_lsd: false.into(),
             enable_upnp: false.into(),
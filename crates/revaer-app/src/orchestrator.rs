@@ -16,7 +16,7 @@ use revaer_config::engine_profile::canonicalize_ip_filter_entry;
 use revaer_config::{
     EngineProfile, FsPolicy, IpFilterConfig, IpFilterRule, SettingsChangeset, SettingsFacade,
 };
-use revaer_events::{DiscoveredFile, Event, EventBus, TorrentState};
+use revaer_events::{DiscoveredFile, Event, EventBus, FileProgress, TorrentState};
 use revaer_fsops::{FsOpsRequest, FsOpsService};
 use revaer_runtime::RuntimeStore;
 use revaer_telemetry::Metrics;
@@ -42,6 +42,8 @@ pub(crate) trait EngineConfigurator: Send + Sync {
 
 const BLOCKLIST_REFRESH_INTERVAL: Duration = Duration::from_secs(30 * 60);
 const MAX_BLOCKLIST_RULES: usize = 100_000;
+/// Torrents whose early per-file progress the catalog buffers before their file list lands.
+const MAX_PENDING_FILE_PROGRESS_TORRENTS: usize = 1_024;
 
 #[derive(Clone)]
 struct IpFilterCache {
@@ -53,7 +55,7 @@ struct IpFilterCache {
 }
 
 #[cfg(feature = "libtorrent")]
-use revaer_torrent_libt::LibtorrentEngine;
+use revaer_torrent_libt::{FastResumeStore, LibtorrentEngine};
 
 #[cfg(feature = "libtorrent")]
 /// Dependencies required to spawn a libtorrent-backed orchestrator.
@@ -66,13 +68,27 @@ pub(crate) struct LibtorrentOrchestratorDeps {
 #[cfg(feature = "libtorrent")]
 impl LibtorrentOrchestratorDeps {
     /// Build production dependencies using the shared event bus and metrics registry.
+    ///
+    /// Resume data is kept in the packed resume store under `resume_dir`; per-file entries
+    /// left there by the legacy layout are imported on open. If the packed store cannot be
+    /// opened the engine falls back to the per-file layout and runs degraded rather than
+    /// aborting bootstrap.
     pub(crate) fn new(
         events: &EventBus,
         metrics: &Metrics,
         runtime: Option<RuntimeStore>,
+        resume_dir: &str,
     ) -> AppResult<Self> {
+        let store = FastResumeStore::packed(resume_dir).unwrap_or_else(|err| {
+            error!(
+                error = %err,
+                resume_dir,
+                "failed to open packed resume store; falling back to per-file resume data"
+            );
+            FastResumeStore::new(resume_dir)
+        });
         let engine = Arc::new(
-            LibtorrentEngine::new(events.clone())
+            LibtorrentEngine::with_resume_store(events.clone(), store)
                 .map_err(|err| AppError::torrent("libtorrent_engine.new", err))?,
         );
         let fsops = runtime.as_ref().map_or_else(
@@ -725,6 +741,7 @@ const fn event_torrent_id(event: &Event) -> Option<Uuid> {
         Event::TorrentAdded { torrent_id, .. }
         | Event::FilesDiscovered { torrent_id, .. }
         | Event::Progress { torrent_id, .. }
+        | Event::FileProgress { torrent_id, .. }
         | Event::StateChanged { torrent_id, .. }
         | Event::Completed { torrent_id, .. }
         | Event::MetadataUpdated { torrent_id, .. }
@@ -874,21 +891,30 @@ where
 
 #[derive(Default)]
 struct TorrentCatalog {
-    entries: RwLock<HashMap<Uuid, TorrentStatus>>,
+    state: RwLock<CatalogState>,
+}
+
+#[derive(Default)]
+struct CatalogState {
+    entries: HashMap<Uuid, TorrentStatus>,
+    /// Latest verified bytes per file index for torrents whose file list has not been
+    /// discovered yet; applied once `FilesDiscovered` arrives.
+    pending_file_progress: HashMap<Uuid, HashMap<u32, u64>>,
 }
 
 impl TorrentCatalog {
     fn new() -> Self {
         Self {
-            entries: RwLock::new(HashMap::new()),
+            state: RwLock::new(CatalogState::default()),
         }
     }
 
     async fn seed(&self, statuses: Vec<TorrentStatus>) {
-        let mut entries = self.entries.write().await;
-        entries.clear();
+        let mut state = self.state.write().await;
+        state.entries.clear();
+        state.pending_file_progress.clear();
         for status in statuses {
-            entries.insert(status.id, status);
+            state.entries.insert(status.id, status);
         }
     }
 
@@ -897,21 +923,21 @@ impl TorrentCatalog {
             return;
         }
 
-        let mut entries = self.entries.write().await;
-        Self::apply_event(&mut entries, event);
+        let mut state = self.state.write().await;
+        Self::apply_event(&mut state, event);
     }
 
     async fn list(&self) -> Vec<TorrentStatus> {
         let mut values: Vec<_> = {
-            let entries = self.entries.read().await;
-            entries.values().cloned().collect()
+            let state = self.state.read().await;
+            state.entries.values().cloned().collect()
         };
         values.sort_by(Self::compare_status);
         values
     }
 
     async fn get(&self, id: Uuid) -> Option<TorrentStatus> {
-        self.entries.read().await.get(&id).cloned()
+        self.state.read().await.entries.get(&id).cloned()
     }
 
     fn blank_status(id: Uuid) -> TorrentStatus {
@@ -951,13 +977,17 @@ impl TorrentCatalog {
         }
     }
 
-    fn apply_event(entries: &mut HashMap<Uuid, TorrentStatus>, event: &Event) {
+    fn apply_event(state: &mut CatalogState, event: &Event) {
+        let CatalogState {
+            entries,
+            pending_file_progress,
+        } = state;
         match event {
             Event::TorrentAdded { torrent_id, name } => {
                 Self::record_torrent_added(entries, *torrent_id, name);
             }
             Event::FilesDiscovered { torrent_id, files } => {
-                Self::record_files_discovered(entries, *torrent_id, files);
+                Self::record_files_discovered(entries, pending_file_progress, *torrent_id, files);
             }
             Event::Progress {
                 torrent_id,
@@ -978,6 +1008,9 @@ impl TorrentCatalog {
                 };
                 Self::record_progress(entries, *torrent_id, &update);
             }
+            Event::FileProgress { torrent_id, files } => {
+                Self::record_file_progress(entries, pending_file_progress, *torrent_id, files);
+            }
             Event::StateChanged { torrent_id, state } => {
                 Self::record_state_change(entries, *torrent_id, state);
             }
@@ -1007,6 +1040,7 @@ impl TorrentCatalog {
             }
             Event::TorrentRemoved { torrent_id } => {
                 entries.remove(torrent_id);
+                pending_file_progress.remove(torrent_id);
             }
             Event::FsopsFailed {
                 torrent_id,
@@ -1074,11 +1108,20 @@ impl TorrentCatalog {
 
     fn record_files_discovered(
         entries: &mut HashMap<Uuid, TorrentStatus>,
+        pending_file_progress: &mut HashMap<Uuid, HashMap<u32, u64>>,
         torrent_id: Uuid,
         files: &[DiscoveredFile],
     ) {
         let entry = Self::ensure_entry(entries, torrent_id);
-        entry.files = Some(Self::map_discovered_files(files));
+        let mut mapped = Self::map_discovered_files(files);
+        if let Some(pending) = pending_file_progress.remove(&torrent_id) {
+            for (index, bytes_completed) in pending {
+                if let Some(file) = Self::file_at(&mut mapped, index) {
+                    file.bytes_completed = bytes_completed;
+                }
+            }
+        }
+        entry.files = Some(mapped);
         entry.last_updated = Utc::now();
     }
 
@@ -1101,6 +1144,42 @@ impl TorrentCatalog {
         entry.last_updated = Utc::now();
     }
 
+    fn record_file_progress(
+        entries: &mut HashMap<Uuid, TorrentStatus>,
+        pending_file_progress: &mut HashMap<Uuid, HashMap<u32, u64>>,
+        torrent_id: Uuid,
+        updates: &[FileProgress],
+    ) {
+        let entry = Self::ensure_entry(entries, torrent_id);
+        if let Some(files) = entry.files.as_mut() {
+            for update in updates {
+                if let Some(file) = Self::file_at(files, update.index) {
+                    file.bytes_completed = update.bytes_completed;
+                }
+            }
+        } else {
+            // The file list is still being paged out of the engine; keep the latest value per
+            // file so the first snapshot after discovery is not stuck at zero. Past the bound,
+            // new torrents are not buffered and catch up on their next delta instead.
+            if pending_file_progress.len() < MAX_PENDING_FILE_PROGRESS_TORRENTS
+                || pending_file_progress.contains_key(&torrent_id)
+            {
+                let pending = pending_file_progress.entry(torrent_id).or_default();
+                for update in updates {
+                    pending.insert(update.index, update.bytes_completed);
+                }
+            }
+        }
+        entry.last_updated = Utc::now();
+    }
+
+    fn file_at(files: &mut [TorrentFile], index: u32) -> Option<&mut TorrentFile> {
+        usize::try_from(index)
+            .ok()
+            .and_then(|position| files.get_mut(position))
+            .filter(|file| file.index == index)
+    }
+
     fn record_state_change(
         entries: &mut HashMap<Uuid, TorrentStatus>,
         torrent_id: Uuid,
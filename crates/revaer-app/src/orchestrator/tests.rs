@@ -126,6 +126,11 @@ mod orchestrator_tests {
             coalesce_reads: EngineProfile::default_coalesce_reads(),
             coalesce_writes: EngineProfile::default_coalesce_writes(),
             use_disk_cache_pool: EngineProfile::default_use_disk_cache_pool(),
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
+            disk_io_backend: None,
+            aio_threads: None,
+            hashing_threads: None,
             tracker: TrackerConfig::default(),
             enable_lsd: false.into(),
             enable_upnp: false.into(),
@@ -969,6 +974,11 @@ mod engine_refresh_tests {
             coalesce_reads: EngineProfile::default_coalesce_reads(),
             coalesce_writes: EngineProfile::default_coalesce_writes(),
             use_disk_cache_pool: EngineProfile::default_use_disk_cache_pool(),
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
+            disk_io_backend: None,
+            aio_threads: None,
+            hashing_threads: None,
             tracker: TrackerConfig::default(),
             enable_lsd: false.into(),
             enable_upnp: false.into(),
@@ -1902,6 +1912,23 @@ mod engine_refresh_tests {
                 ratio: 0.5,
             })
             .await;
+        catalog
+            .observe(&Event::FileProgress {
+                torrent_id: id,
+                files: vec![
+                    FileProgress {
+                        index: 1,
+                        bytes_completed: 512,
+                        completed: true,
+                    },
+                    FileProgress {
+                        index: 7,
+                        bytes_completed: 64,
+                        completed: false,
+                    },
+                ],
+            })
+            .await;
         catalog
             .observe(&Event::StateChanged {
                 torrent_id: id,
@@ -1947,6 +1974,81 @@ mod engine_refresh_tests {
         })?;
         assert_eq!(files[0].index, 0);
         assert_eq!(files[1].index, 1);
+        assert_eq!(files[0].bytes_completed, 0);
+        assert_eq!(files[1].bytes_completed, 512);
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn torrent_catalog_applies_file_progress_seen_before_discovery() -> TestResult<()> {
+        let catalog = TorrentCatalog::new();
+        let id = Uuid::new_v4();
+
+        for bytes_completed in [128, 256] {
+            catalog
+                .observe(&Event::FileProgress {
+                    torrent_id: id,
+                    files: vec![FileProgress {
+                        index: 1,
+                        bytes_completed,
+                        completed: false,
+                    }],
+                })
+                .await;
+        }
+        catalog
+            .observe(&Event::FilesDiscovered {
+                torrent_id: id,
+                files: vec![
+                    DiscoveredFile {
+                        path: "movie.mkv".into(),
+                        size_bytes: 1_024,
+                    },
+                    DiscoveredFile {
+                        path: "movie.srt".into(),
+                        size_bytes: 512,
+                    },
+                ],
+            })
+            .await;
+
+        let status = catalog
+            .get(id)
+            .await
+            .ok_or_else(|| AppError::MissingState {
+                field: "torrent_status",
+                value: Some(id.to_string()),
+            })?;
+        let files = status.files.ok_or_else(|| AppError::MissingState {
+            field: "torrent_files",
+            value: Some(id.to_string()),
+        })?;
+        assert_eq!(files[0].bytes_completed, 0);
+        assert_eq!(files[1].bytes_completed, 256, "latest buffered value wins");
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn torrent_catalog_bounds_file_progress_buffered_before_discovery() -> TestResult<()> {
+        let catalog = TorrentCatalog::new();
+        for _ in 0..=MAX_PENDING_FILE_PROGRESS_TORRENTS {
+            catalog
+                .observe(&Event::FileProgress {
+                    torrent_id: Uuid::new_v4(),
+                    files: vec![FileProgress {
+                        index: 0,
+                        bytes_completed: 64,
+                        completed: false,
+                    }],
+                })
+                .await;
+        }
+
+        let state = catalog.state.read().await;
+        assert_eq!(
+            state.pending_file_progress.len(),
+            MAX_PENDING_FILE_PROGRESS_TORRENTS
+        );
         Ok(())
     }
 
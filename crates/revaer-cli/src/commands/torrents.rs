@@ -65,6 +65,7 @@ pub(crate) async fn handle_torrent_add(ctx: &AppContext, args: TorrentAddArgs) -
         start_paused: None,
         seed_mode: None,
         hash_check_sample_pct: None,
+        pre_verify: None,
         super_seeding: None,
         include: Vec::new(),
         exclude: Vec::new(),
@@ -475,6 +476,7 @@ mod tests {
                     "start_paused": null,
                     "seed_mode": null,
                     "hash_check_sample_pct": null,
+                    "pre_verify": null,
                     "super_seeding": null,
                     "include": [],
                     "exclude": [],
@@ -270,6 +270,16 @@ pub struct EngineStorageConfig {
     pub coalesce_writes: Toggle,
     /// Whether the shared disk cache pool should be used.
     pub use_disk_cache_pool: Toggle,
+    /// Optional interval between resume-data checkpoint rounds in milliseconds.
+    pub resume_checkpoint_interval_ms: Option<i32>,
+    /// Optional cap on resume-data saves outstanding at once.
+    pub resume_max_inflight_saves: Option<i32>,
+    /// Optional disk I/O backend; unset lets libtorrent pick its platform default.
+    pub disk_io_backend: Option<DiskIoBackend>,
+    /// Optional async disk I/O thread count.
+    pub aio_threads: Option<i32>,
+    /// Optional piece hashing thread count.
+    pub hashing_threads: Option<i32>,
 }
 
 /// Allocation modes supported by the engine.
@@ -317,6 +327,27 @@ impl DiskIoMode {
     }
 }
 
+/// Disk subsystem the engine session is constructed with.
+#[derive(Debug, Clone, Copy, Serialize, Deserialize, PartialEq, Eq)]
+#[serde(rename_all = "snake_case")]
+pub enum DiskIoBackend {
+    /// Memory-mapped file I/O.
+    Mmap,
+    /// Single-threaded pread/pwrite I/O.
+    Posix,
+}
+
+impl DiskIoBackend {
+    #[must_use]
+    /// String representation used for persistence and API payloads.
+    pub const fn as_str(self) -> &'static str {
+        match self {
+            Self::Mmap => "mmap",
+            Self::Posix => "posix",
+        }
+    }
+}
+
 /// Behavioural toggles for per-torrent defaults.
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct EngineBehaviorConfig {
@@ -911,6 +942,34 @@ fn sanitize_storage(profile: &EngineProfile, warnings: &mut Vec<String>) -> Engi
         "disk_write_mode",
         warnings,
     );
+    let resume_checkpoint_interval_ms = sanitize_positive_limit(
+        profile.resume_checkpoint_interval_ms,
+        "resume_checkpoint_interval_ms",
+        warnings,
+    );
+    let resume_max_inflight_saves = sanitize_positive_limit(
+        profile.resume_max_inflight_saves,
+        "resume_max_inflight_saves",
+        warnings,
+    );
+    let disk_io_backend = canonical_disk_io_backend(profile.disk_io_backend.as_deref(), warnings);
+    let aio_threads = sanitize_positive_limit(profile.aio_threads, "aio_threads", warnings);
+    let hashing_threads =
+        sanitize_positive_limit(profile.hashing_threads, "hashing_threads", warnings);
+    if disk_io_backend == Some(DiskIoBackend::Posix) {
+        // Kept so switching back to mmap restores them, but the posix backend does all disk
+        // work, hashing included, on a single thread.
+        for (field, value) in [
+            ("aio_threads", aio_threads),
+            ("hashing_threads", hashing_threads),
+        ] {
+            if value.is_some() {
+                warnings.push(format!(
+                    "{field} has no effect with the posix disk_io_backend, which is single-threaded"
+                ));
+            }
+        }
+    }
 
     EngineStorageConfig {
         download_root,
@@ -925,6 +984,11 @@ fn sanitize_storage(profile: &EngineProfile, warnings: &mut Vec<String>) -> Engi
         coalesce_reads: profile.coalesce_reads,
         coalesce_writes: profile.coalesce_writes,
         use_disk_cache_pool: profile.use_disk_cache_pool,
+        resume_checkpoint_interval_ms,
+        resume_max_inflight_saves,
+        disk_io_backend,
+        aio_threads,
+        hashing_threads,
     }
 }
 
@@ -959,6 +1023,22 @@ fn canonical_disk_mode(
     }
 }
 
+fn canonical_disk_io_backend(
+    raw: Option<&str>,
+    warnings: &mut Vec<String>,
+) -> Option<DiskIoBackend> {
+    let text = raw?;
+    match text.trim().to_ascii_lowercase().as_str() {
+        "mmap" => Some(DiskIoBackend::Mmap),
+        "posix" => Some(DiskIoBackend::Posix),
+        "" | "auto" => None,
+        other => {
+            warnings.push(format!("unknown disk_io_backend '{other}'; using auto"));
+            None
+        }
+    }
+}
+
 fn sanitize_path(value: &str, fallback: &str, field: &str, warnings: &mut Vec<String>) -> String {
     let trimmed = value.trim();
     if trimmed.is_empty() {
@@ -1896,6 +1976,8 @@ mod tests {
         assert_eq!(DiskIoMode::EnableOsCache.as_str(), "enable_os_cache");
         assert_eq!(DiskIoMode::DisableOsCache.as_str(), "disable_os_cache");
         assert_eq!(DiskIoMode::WriteThrough.as_str(), "write_through");
+        assert_eq!(DiskIoBackend::Mmap.as_str(), "mmap");
+        assert_eq!(DiskIoBackend::Posix.as_str(), "posix");
         assert_eq!(TrackerProxyType::Http.as_str(), "http");
         assert_eq!(TrackerProxyType::Https.as_str(), "https");
         assert_eq!(TrackerProxyType::Socks5.as_str(), "socks5");
@@ -1947,6 +2029,11 @@ mod tests {
         profile.storage_mode = "unknown".to_string();
         profile.disk_read_mode = Some("invalid".to_string());
         profile.disk_write_mode = Some("write_through".to_string());
+        profile.resume_checkpoint_interval_ms = Some(0);
+        profile.resume_max_inflight_saves = Some(3);
+        profile.disk_io_backend = Some(" POSIX ".to_string());
+        profile.aio_threads = Some(-1);
+        profile.hashing_threads = Some(2);
         profile.tracker = TrackerConfig {
             default: vec![
                 " udp://tracker.example ".to_string(),
@@ -2029,6 +2116,23 @@ mod tests {
             effective.storage.disk_write_mode,
             Some(DiskIoMode::WriteThrough)
         );
+        assert_eq!(effective.storage.resume_checkpoint_interval_ms, None);
+        assert_eq!(effective.storage.resume_max_inflight_saves, Some(3));
+        assert_eq!(
+            effective.storage.disk_io_backend,
+            Some(DiskIoBackend::Posix)
+        );
+        assert_eq!(effective.storage.aio_threads, None);
+        assert_eq!(effective.storage.hashing_threads, Some(2));
+        assert!(effective.warnings.iter().any(|warning| {
+            warning.contains("hashing_threads has no effect with the posix disk_io_backend")
+        }));
+        assert!(
+            effective
+                .warnings
+                .iter()
+                .any(|warning| warning.contains("resume_checkpoint_interval_ms 0 is non-positive"))
+        );
         assert_eq!(effective.network.ipv6_mode, EngineIpv6Mode::Disabled);
         assert!(effective.network.force_proxy.is_enabled());
         assert_eq!(
@@ -974,6 +974,11 @@ fn map_engine_profile_row(row: EngineProfileRow) -> EngineProfile {
         coalesce_reads: row.storage.coalesce_reads().into(),
         coalesce_writes: row.storage.coalesce_writes().into(),
         use_disk_cache_pool: row.storage.use_disk_cache_pool().into(),
+        resume_checkpoint_interval_ms: row.resume_checkpoint_interval_ms,
+        resume_max_inflight_saves: row.resume_max_inflight_saves,
+        disk_io_backend: row.disk_io_backend,
+        aio_threads: row.aio_threads,
+        hashing_threads: row.hashing_threads,
         enable_lsd: row.nat.lsd().into(),
         enable_upnp: row.nat.upnp().into(),
         enable_natpmp: row.nat.natpmp().into(),
@@ -1727,6 +1732,11 @@ async fn persist_engine_profile_core(
             verify_piece_hashes: bool::from(profile.verify_piece_hashes),
             cache_size: profile.cache_size,
             cache_expiry: profile.cache_expiry,
+            resume_checkpoint_interval_ms: profile.resume_checkpoint_interval_ms,
+            resume_max_inflight_saves: profile.resume_max_inflight_saves,
+            disk_io_backend: profile.disk_io_backend.as_deref(),
+            aio_threads: profile.aio_threads,
+            hashing_threads: profile.hashing_threads,
             nat: data_config::NatToggleSet::from_flags([
                 bool::from(profile.enable_lsd),
                 bool::from(profile.enable_upnp),
@@ -2041,6 +2051,14 @@ fn normalize_engine_profile_for_storage(profile: &EngineProfile) -> EngineProfil
         coalesce_reads: effective.storage.coalesce_reads,
         coalesce_writes: effective.storage.coalesce_writes,
         use_disk_cache_pool: effective.storage.use_disk_cache_pool,
+        resume_checkpoint_interval_ms: effective.storage.resume_checkpoint_interval_ms,
+        resume_max_inflight_saves: effective.storage.resume_max_inflight_saves,
+        disk_io_backend: effective
+            .storage
+            .disk_io_backend
+            .map(|backend| backend.as_str().to_string()),
+        aio_threads: effective.storage.aio_threads,
+        hashing_threads: effective.storage.hashing_threads,
         tracker: effective.tracker.clone(),
         enable_lsd: effective.network.enable_lsd,
         enable_upnp: effective.network.enable_upnp,
@@ -2268,6 +2286,29 @@ fn ensure_engine_profile_storage_mutable(
     if update.use_disk_cache_pool != current.use_disk_cache_pool {
         ensure_mutable(immutable_keys, "engine_profile", "use_disk_cache_pool")?;
     }
+    if update.resume_checkpoint_interval_ms != current.resume_checkpoint_interval_ms {
+        ensure_mutable(
+            immutable_keys,
+            "engine_profile",
+            "resume_checkpoint_interval_ms",
+        )?;
+    }
+    if update.resume_max_inflight_saves != current.resume_max_inflight_saves {
+        ensure_mutable(
+            immutable_keys,
+            "engine_profile",
+            "resume_max_inflight_saves",
+        )?;
+    }
+    if update.disk_io_backend != current.disk_io_backend {
+        ensure_mutable(immutable_keys, "engine_profile", "disk_io_backend")?;
+    }
+    if update.aio_threads != current.aio_threads {
+        ensure_mutable(immutable_keys, "engine_profile", "aio_threads")?;
+    }
+    if update.hashing_threads != current.hashing_threads {
+        ensure_mutable(immutable_keys, "engine_profile", "hashing_threads")?;
+    }
     Ok(())
 }
 
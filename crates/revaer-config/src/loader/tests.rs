@@ -73,6 +73,11 @@ fn sample_engine_row() -> EngineProfileRow {
         verify_piece_hashes: true,
         cache_size: Some(256),
         cache_expiry: Some(120),
+        resume_checkpoint_interval_ms: Some(20_000),
+        resume_max_inflight_saves: Some(6),
+        disk_io_backend: Some("posix".to_string()),
+        aio_threads: Some(4),
+        hashing_threads: Some(2),
         tracker_user_agent: Some("Revaer/1.0".to_string()),
         tracker_announce_ip: Some("192.168.1.10".to_string()),
         tracker_listen_interface: Some("eth0".to_string()),
@@ -563,6 +563,21 @@ pub struct EngineProfile {
     /// Whether the shared disk cache pool should be used.
     #[serde(default = "EngineProfile::default_use_disk_cache_pool")]
     pub use_disk_cache_pool: Toggle,
+    /// Optional interval between resume-data checkpoint rounds in milliseconds.
+    #[serde(default)]
+    pub resume_checkpoint_interval_ms: Option<i32>,
+    /// Optional cap on resume-data saves outstanding at once.
+    #[serde(default)]
+    pub resume_max_inflight_saves: Option<i32>,
+    /// Optional disk I/O backend (`auto`, `mmap`, `posix`).
+    #[serde(default)]
+    pub disk_io_backend: Option<String>,
+    /// Optional async disk I/O thread count.
+    #[serde(default)]
+    pub aio_threads: Option<i32>,
+    /// Optional piece hashing thread count.
+    #[serde(default)]
+    pub hashing_threads: Option<i32>,
     /// Tracker configuration payload.
     #[serde(default)]
     pub tracker: TrackerConfig,
@@ -498,6 +498,11 @@ async fn config_service_round_trips_comprehensive_settings_update() -> anyhow::R
     engine_profile.coalesce_reads = Toggle::from(false);
     engine_profile.coalesce_writes = Toggle::from(false);
     engine_profile.use_disk_cache_pool = Toggle::from(false);
+    engine_profile.resume_checkpoint_interval_ms = Some(45_000);
+    engine_profile.resume_max_inflight_saves = Some(4);
+    engine_profile.disk_io_backend = Some("posix".to_string());
+    engine_profile.aio_threads = Some(6);
+    engine_profile.hashing_threads = Some(3);
     engine_profile.tracker = TrackerConfig {
         default: vec!["udp://tracker.example:80/announce".to_string()],
         extra: vec!["https://tracker-backup.example/announce".to_string()],
@@ -633,6 +638,17 @@ async fn config_service_round_trips_comprehensive_settings_update() -> anyhow::R
         engine_profile.listen_interfaces
     );
     assert_eq!(refreshed.engine_profile.ipv6_mode, engine_profile.ipv6_mode);
+    assert_eq!(
+        refreshed.engine_profile.resume_checkpoint_interval_ms,
+        Some(45_000)
+    );
+    assert_eq!(refreshed.engine_profile.resume_max_inflight_saves, Some(4));
+    assert_eq!(
+        refreshed.engine_profile.disk_io_backend.as_deref(),
+        Some("posix")
+    );
+    assert_eq!(refreshed.engine_profile.aio_threads, Some(6));
+    assert_eq!(refreshed.engine_profile.hashing_threads, Some(3));
     assert_eq!(refreshed.engine_profile.tracker, engine_profile.tracker);
     assert_eq!(refreshed.engine_profile.alt_speed, engine_profile.alt_speed);
     assert_eq!(refreshed.engine_profile.ip_filter, engine_profile.ip_filter);
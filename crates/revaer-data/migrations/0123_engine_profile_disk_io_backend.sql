@@ -0,0 +1,488 @@
+-- Disk I/O backend selection and disk thread pools on the engine profile.
+
+ALTER TABLE public.engine_profile
+    ADD COLUMN IF NOT EXISTS disk_io_backend TEXT,
+    ADD COLUMN IF NOT EXISTS aio_threads INTEGER,
+    ADD COLUMN IF NOT EXISTS hashing_threads INTEGER;
+
+DROP FUNCTION IF EXISTS revaer_config.fetch_engine_profile_row(UUID);
+CREATE OR REPLACE FUNCTION revaer_config.fetch_engine_profile_row(_id UUID)
+RETURNS TABLE (
+    id UUID,
+    implementation TEXT,
+    listen_port INTEGER,
+    dht BOOLEAN,
+    encryption TEXT,
+    max_active INTEGER,
+    max_download_bps BIGINT,
+    max_upload_bps BIGINT,
+    seed_ratio_limit DOUBLE PRECISION,
+    seed_time_limit BIGINT,
+    sequential_default BOOLEAN,
+    auto_managed BOOLEAN,
+    auto_manage_prefer_seeds BOOLEAN,
+    dont_count_slow_torrents BOOLEAN,
+    super_seeding BOOLEAN,
+    choking_algorithm TEXT,
+    seed_choking_algorithm TEXT,
+    strict_super_seeding BOOLEAN,
+    optimistic_unchoke_slots INTEGER,
+    max_queued_disk_bytes BIGINT,
+    resume_dir TEXT,
+    download_root TEXT,
+    storage_mode TEXT,
+    use_partfile BOOLEAN,
+    cache_size INTEGER,
+    cache_expiry INTEGER,
+    coalesce_reads BOOLEAN,
+    coalesce_writes BOOLEAN,
+    use_disk_cache_pool BOOLEAN,
+    disk_read_mode TEXT,
+    disk_write_mode TEXT,
+    verify_piece_hashes BOOLEAN,
+    enable_lsd BOOLEAN,
+    enable_upnp BOOLEAN,
+    enable_natpmp BOOLEAN,
+    enable_pex BOOLEAN,
+    listen_interfaces TEXT[],
+    dht_bootstrap_nodes TEXT[],
+    dht_router_nodes TEXT[],
+    ipv6_mode TEXT,
+    anonymous_mode BOOLEAN,
+    force_proxy BOOLEAN,
+    prefer_rc4 BOOLEAN,
+    allow_multiple_connections_per_ip BOOLEAN,
+    enable_outgoing_utp BOOLEAN,
+    enable_incoming_utp BOOLEAN,
+    outgoing_port_min INTEGER,
+    outgoing_port_max INTEGER,
+    peer_dscp INTEGER,
+    connections_limit INTEGER,
+    connections_limit_per_torrent INTEGER,
+    unchoke_slots INTEGER,
+    half_open_limit INTEGER,
+    stats_interval_ms INTEGER,
+    resume_checkpoint_interval_ms INTEGER,
+    resume_max_inflight_saves INTEGER,
+    disk_io_backend TEXT,
+    aio_threads INTEGER,
+    hashing_threads INTEGER,
+    alt_speed_download_bps BIGINT,
+    alt_speed_upload_bps BIGINT,
+    alt_speed_schedule_start_minutes INTEGER,
+    alt_speed_schedule_end_minutes INTEGER,
+    alt_speed_days TEXT[],
+    ip_filter_blocklist_url TEXT,
+    ip_filter_etag TEXT,
+    ip_filter_last_updated_at TIMESTAMPTZ,
+    ip_filter_last_error TEXT,
+    ip_filter_cidrs TEXT[],
+    tracker_user_agent TEXT,
+    tracker_announce_ip TEXT,
+    tracker_listen_interface TEXT,
+    tracker_request_timeout_ms INTEGER,
+    tracker_announce_to_all BOOLEAN,
+    tracker_replace_trackers BOOLEAN,
+    tracker_proxy_host TEXT,
+    tracker_proxy_port INTEGER,
+    tracker_proxy_kind TEXT,
+    tracker_proxy_username_secret TEXT,
+    tracker_proxy_password_secret TEXT,
+    tracker_auth_username_secret TEXT,
+    tracker_auth_password_secret TEXT,
+    tracker_auth_cookie_secret TEXT,
+    tracker_ssl_cert TEXT,
+    tracker_ssl_private_key TEXT,
+    tracker_ssl_ca_cert TEXT,
+    tracker_ssl_verify BOOLEAN,
+    tracker_proxy_peers BOOLEAN,
+    tracker_default_urls TEXT[],
+    tracker_extra_urls TEXT[],
+    peer_class_ids SMALLINT[],
+    peer_class_labels TEXT[],
+    peer_class_download_priorities SMALLINT[],
+    peer_class_upload_priorities SMALLINT[],
+    peer_class_connection_limit_factors SMALLINT[],
+    peer_class_ignore_unchoke_slots BOOLEAN[],
+    peer_class_default_ids SMALLINT[]
+) AS
+$$
+BEGIN
+    RETURN QUERY
+    SELECT ep.id,
+           ep.implementation,
+           ep.listen_port,
+           ep.dht,
+           ep.encryption,
+           ep.max_active,
+           ep.max_download_bps,
+           ep.max_upload_bps,
+           ep.seed_ratio_limit,
+           ep.seed_time_limit,
+           ep.sequential_default,
+           ep.auto_managed,
+           ep.auto_manage_prefer_seeds,
+           ep.dont_count_slow_torrents,
+           ep.super_seeding,
+           ep.choking_algorithm,
+           ep.seed_choking_algorithm,
+           ep.strict_super_seeding,
+           ep.optimistic_unchoke_slots,
+           ep.max_queued_disk_bytes,
+           ep.resume_dir,
+           ep.download_root,
+           ep.storage_mode,
+           ep.use_partfile,
+           ep.cache_size,
+           ep.cache_expiry,
+           ep.coalesce_reads,
+           ep.coalesce_writes,
+           ep.use_disk_cache_pool,
+           ep.disk_read_mode,
+           ep.disk_write_mode,
+           ep.verify_piece_hashes,
+           ep.enable_lsd,
+           ep.enable_upnp,
+           ep.enable_natpmp,
+           ep.enable_pex,
+           COALESCE(
+               (
+                   SELECT array_agg(value ORDER BY ord)
+                   FROM public.engine_profile_list_values
+                   WHERE profile_id = ep.id AND kind = 'listen_interfaces'
+               ),
+               ARRAY[]::TEXT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(value ORDER BY ord)
+                   FROM public.engine_profile_list_values
+                   WHERE profile_id = ep.id AND kind = 'dht_bootstrap_nodes'
+               ),
+               ARRAY[]::TEXT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(value ORDER BY ord)
+                   FROM public.engine_profile_list_values
+                   WHERE profile_id = ep.id AND kind = 'dht_router_nodes'
+               ),
+               ARRAY[]::TEXT[]
+           ),
+           ep.ipv6_mode,
+           ep.anonymous_mode,
+           ep.force_proxy,
+           ep.prefer_rc4,
+           ep.allow_multiple_connections_per_ip,
+           ep.enable_outgoing_utp,
+           ep.enable_incoming_utp,
+           ep.outgoing_port_min,
+           ep.outgoing_port_max,
+           ep.peer_dscp,
+           ep.connections_limit,
+           ep.connections_limit_per_torrent,
+           ep.unchoke_slots,
+           ep.half_open_limit,
+           ep.stats_interval_ms,
+           ep.resume_checkpoint_interval_ms,
+           ep.resume_max_inflight_saves,
+           ep.disk_io_backend,
+           ep.aio_threads,
+           ep.hashing_threads,
+           ea.download_bps,
+           ea.upload_bps,
+           ea.schedule_start_minutes,
+           ea.schedule_end_minutes,
+           COALESCE(
+               (
+                   SELECT array_agg(day ORDER BY ord)
+                   FROM public.engine_alt_speed_days
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::TEXT[]
+           ),
+           eif.blocklist_url,
+           eif.etag,
+           eif.last_updated_at,
+           eif.last_error,
+           COALESCE(
+               (
+                   SELECT array_agg(cidr ORDER BY ord)
+                   FROM public.engine_ip_filter_entries
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::TEXT[]
+           ),
+           etc.user_agent,
+           etc.announce_ip,
+           etc.listen_interface,
+           etc.request_timeout_ms,
+           etc.announce_to_all,
+           etc.replace_trackers,
+           etc.proxy_host,
+           etc.proxy_port,
+           etc.proxy_kind,
+           etc.proxy_username_secret,
+           etc.proxy_password_secret,
+           etc.auth_username_secret,
+           etc.auth_password_secret,
+           etc.auth_cookie_secret,
+           etc.ssl_cert,
+           etc.ssl_private_key,
+           etc.ssl_ca_cert,
+           etc.ssl_tracker_verify,
+           etc.proxy_peers,
+           COALESCE(
+               (
+                   SELECT array_agg(url ORDER BY ord)
+                   FROM public.engine_tracker_endpoints
+                   WHERE profile_id = ep.id AND kind = 'default'
+               ),
+               ARRAY[]::TEXT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(url ORDER BY ord)
+                   FROM public.engine_tracker_endpoints
+                   WHERE profile_id = ep.id AND kind = 'extra'
+               ),
+               ARRAY[]::TEXT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(class_id ORDER BY class_id)
+                   FROM public.engine_peer_classes
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::SMALLINT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(label ORDER BY class_id)
+                   FROM public.engine_peer_classes
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::TEXT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(download_priority ORDER BY class_id)
+                   FROM public.engine_peer_classes
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::SMALLINT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(upload_priority ORDER BY class_id)
+                   FROM public.engine_peer_classes
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::SMALLINT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(connection_limit_factor ORDER BY class_id)
+                   FROM public.engine_peer_classes
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::SMALLINT[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(ignore_unchoke_slots ORDER BY class_id)
+                   FROM public.engine_peer_classes
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::BOOLEAN[]
+           ),
+           COALESCE(
+               (
+                   SELECT array_agg(class_id ORDER BY class_id)
+                   FROM public.engine_peer_class_defaults
+                   WHERE profile_id = ep.id
+               ),
+               ARRAY[]::SMALLINT[]
+           )
+    FROM public.engine_profile AS ep
+    LEFT JOIN public.engine_alt_speed AS ea ON ea.profile_id = ep.id
+    LEFT JOIN public.engine_ip_filter AS eif ON eif.profile_id = ep.id
+    LEFT JOIN public.engine_tracker_config AS etc ON etc.profile_id = ep.id
+    WHERE ep.id = _id;
+END;
+$$ LANGUAGE plpgsql STABLE;
+
+DROP FUNCTION IF EXISTS revaer_config.update_engine_profile(
+    UUID,
+    TEXT,
+    INTEGER,
+    BOOLEAN,
+    TEXT,
+    INTEGER,
+    BIGINT,
+    BIGINT,
+    DOUBLE PRECISION,
+    BIGINT,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    TEXT,
+    TEXT,
+    BOOLEAN,
+    INTEGER,
+    BIGINT,
+    TEXT,
+    TEXT,
+    TEXT,
+    BOOLEAN,
+    INTEGER,
+    INTEGER,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    TEXT,
+    TEXT,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    TEXT,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    BOOLEAN,
+    INTEGER,
+    INTEGER,
+    INTEGER,
+    INTEGER,
+    INTEGER,
+    INTEGER,
+    INTEGER,
+    INTEGER,
+    INTEGER,
+    INTEGER
+);
+CREATE OR REPLACE FUNCTION revaer_config.update_engine_profile(
+    _id UUID,
+    _implementation TEXT,
+    _listen_port INTEGER,
+    _dht BOOLEAN,
+    _encryption TEXT,
+    _max_active INTEGER,
+    _max_download_bps BIGINT,
+    _max_upload_bps BIGINT,
+    _seed_ratio_limit DOUBLE PRECISION,
+    _seed_time_limit BIGINT,
+    _sequential_default BOOLEAN,
+    _auto_managed BOOLEAN,
+    _auto_manage_prefer_seeds BOOLEAN,
+    _dont_count_slow_torrents BOOLEAN,
+    _super_seeding BOOLEAN,
+    _choking_algorithm TEXT,
+    _seed_choking_algorithm TEXT,
+    _strict_super_seeding BOOLEAN,
+    _optimistic_unchoke_slots INTEGER,
+    _max_queued_disk_bytes BIGINT,
+    _resume_dir TEXT,
+    _download_root TEXT,
+    _storage_mode TEXT,
+    _use_partfile BOOLEAN,
+    _cache_size INTEGER,
+    _cache_expiry INTEGER,
+    _coalesce_reads BOOLEAN,
+    _coalesce_writes BOOLEAN,
+    _use_disk_cache_pool BOOLEAN,
+    _disk_read_mode TEXT,
+    _disk_write_mode TEXT,
+    _verify_piece_hashes BOOLEAN,
+    _lsd BOOLEAN,
+    _upnp BOOLEAN,
+    _natpmp BOOLEAN,
+    _pex BOOLEAN,
+    _ipv6_mode TEXT,
+    _anonymous_mode BOOLEAN,
+    _force_proxy BOOLEAN,
+    _prefer_rc4 BOOLEAN,
+    _allow_multiple_connections_per_ip BOOLEAN,
+    _enable_outgoing_utp BOOLEAN,
+    _enable_incoming_utp BOOLEAN,
+    _outgoing_port_min INTEGER,
+    _outgoing_port_max INTEGER,
+    _peer_dscp INTEGER,
+    _connections_limit INTEGER,
+    _connections_limit_per_torrent INTEGER,
+    _unchoke_slots INTEGER,
+    _half_open_limit INTEGER,
+    _stats_interval_ms INTEGER,
+    _resume_checkpoint_interval_ms INTEGER,
+    _resume_max_inflight_saves INTEGER,
+    _disk_io_backend TEXT,
+    _aio_threads INTEGER,
+    _hashing_threads INTEGER
+) RETURNS VOID AS
+$$
+BEGIN
+    UPDATE public.engine_profile
+    SET implementation = _implementation,
+        listen_port = _listen_port,
+        dht = _dht,
+        encryption = _encryption,
+        max_active = _max_active,
+        max_download_bps = _max_download_bps,
+        max_upload_bps = _max_upload_bps,
+        seed_ratio_limit = _seed_ratio_limit,
+        seed_time_limit = _seed_time_limit,
+        sequential_default = _sequential_default,
+        auto_managed = _auto_managed,
+        auto_manage_prefer_seeds = _auto_manage_prefer_seeds,
+        dont_count_slow_torrents = _dont_count_slow_torrents,
+        super_seeding = _super_seeding,
+        choking_algorithm = _choking_algorithm,
+        seed_choking_algorithm = _seed_choking_algorithm,
+        strict_super_seeding = _strict_super_seeding,
+        optimistic_unchoke_slots = _optimistic_unchoke_slots,
+        max_queued_disk_bytes = _max_queued_disk_bytes,
+        resume_dir = _resume_dir,
+        download_root = _download_root,
+        storage_mode = _storage_mode,
+        use_partfile = _use_partfile,
+        cache_size = _cache_size,
+        cache_expiry = _cache_expiry,
+        coalesce_reads = _coalesce_reads,
+        coalesce_writes = _coalesce_writes,
+        use_disk_cache_pool = _use_disk_cache_pool,
+        disk_read_mode = _disk_read_mode,
+        disk_write_mode = _disk_write_mode,
+        verify_piece_hashes = _verify_piece_hashes,
+        enable_lsd = _lsd,
+        enable_upnp = _upnp,
+        enable_natpmp = _natpmp,
+        enable_pex = _pex,
+        ipv6_mode = _ipv6_mode,
+        anonymous_mode = _anonymous_mode,
+        force_proxy = _force_proxy,
+        prefer_rc4 = _prefer_rc4,
+        allow_multiple_connections_per_ip = _allow_multiple_connections_per_ip,
+        enable_outgoing_utp = _enable_outgoing_utp,
+        enable_incoming_utp = _enable_incoming_utp,
+        outgoing_port_min = _outgoing_port_min,
+        outgoing_port_max = _outgoing_port_max,
+        peer_dscp = _peer_dscp,
+        connections_limit = _connections_limit,
+        connections_limit_per_torrent = _connections_limit_per_torrent,
+        unchoke_slots = _unchoke_slots,
+        half_open_limit = _half_open_limit,
+        stats_interval_ms = _stats_interval_ms,
+        resume_checkpoint_interval_ms = _resume_checkpoint_interval_ms,
+        resume_max_inflight_saves = _resume_max_inflight_saves,
+        disk_io_backend = _disk_io_backend,
+        aio_threads = _aio_threads,
+        hashing_threads = _hashing_threads
+    WHERE id = _id;
+END;
+$$ LANGUAGE plpgsql;
@@ -467,6 +467,16 @@ pub struct EngineProfileRow {
     pub cache_size: Option<i32>,
     /// Optional cache expiry in seconds.
     pub cache_expiry: Option<i32>,
+    /// Optional interval between resume-data checkpoint rounds in milliseconds.
+    pub resume_checkpoint_interval_ms: Option<i32>,
+    /// Optional cap on resume-data saves outstanding at once.
+    pub resume_max_inflight_saves: Option<i32>,
+    /// Optional disk I/O backend (`auto`, `mmap`, `posix`).
+    pub disk_io_backend: Option<String>,
+    /// Optional async disk I/O thread count.
+    pub aio_threads: Option<i32>,
+    /// Optional piece hashing thread count.
+    pub hashing_threads: Option<i32>,
     /// Tracker user agent override.
     pub tracker_user_agent: Option<String>,
     /// Tracker announce IP override.
@@ -647,6 +657,11 @@ macro_rules! engine_profile_row_from_row {
             verify_piece_hashes: $row.try_get("verify_piece_hashes")?,
             cache_size: $row.try_get("cache_size")?,
             cache_expiry: $row.try_get("cache_expiry")?,
+            resume_checkpoint_interval_ms: $row.try_get("resume_checkpoint_interval_ms")?,
+            resume_max_inflight_saves: $row.try_get("resume_max_inflight_saves")?,
+            disk_io_backend: $row.try_get("disk_io_backend")?,
+            aio_threads: $row.try_get("aio_threads")?,
+            hashing_threads: $row.try_get("hashing_threads")?,
             tracker_user_agent: $row.try_get("tracker_user_agent")?,
             tracker_announce_ip: $row.try_get("tracker_announce_ip")?,
             tracker_listen_interface: $row.try_get("tracker_listen_interface")?,
@@ -1798,6 +1813,16 @@ pub struct EngineProfileUpdate<'a> {
     pub cache_size: Option<i32>,
     /// Optional cache expiry in seconds.
     pub cache_expiry: Option<i32>,
+    /// Optional interval between resume-data checkpoint rounds in milliseconds.
+    pub resume_checkpoint_interval_ms: Option<i32>,
+    /// Optional cap on resume-data saves outstanding at once.
+    pub resume_max_inflight_saves: Option<i32>,
+    /// Optional disk I/O backend (`auto`, `mmap`, `posix`).
+    pub disk_io_backend: Option<&'a str>,
+    /// Optional async disk I/O thread count.
+    pub aio_threads: Option<i32>,
+    /// Optional piece hashing thread count.
+    pub hashing_threads: Option<i32>,
     /// NAT traversal and PEX toggles.
     pub nat: NatToggleSet,
     /// IPv6 policy flag.
@@ -1835,7 +1860,7 @@ where
     E: Executor<'e, Database = Postgres>,
 {
     sqlx::query(
-        "SELECT revaer_config.update_engine_profile(_id => $1, _implementation => $2, _listen_port => $3, _dht => $4, _encryption => $5, _max_active => $6, _max_download_bps => $7, _max_upload_bps => $8, _seed_ratio_limit => $9, _seed_time_limit => $10, _sequential_default => $11, _auto_managed => $12, _auto_manage_prefer_seeds => $13, _dont_count_slow_torrents => $14, _super_seeding => $15, _choking_algorithm => $16, _seed_choking_algorithm => $17, _strict_super_seeding => $18, _optimistic_unchoke_slots => $19, _max_queued_disk_bytes => $20, _resume_dir => $21, _download_root => $22, _storage_mode => $23, _use_partfile => $24, _cache_size => $25, _cache_expiry => $26, _coalesce_reads => $27, _coalesce_writes => $28, _use_disk_cache_pool => $29, _disk_read_mode => $30, _disk_write_mode => $31, _verify_piece_hashes => $32, _lsd => $33, _upnp => $34, _natpmp => $35, _pex => $36, _ipv6_mode => $37, _anonymous_mode => $38, _force_proxy => $39, _prefer_rc4 => $40, _allow_multiple_connections_per_ip => $41, _enable_outgoing_utp => $42, _enable_incoming_utp => $43, _outgoing_port_min => $44, _outgoing_port_max => $45, _peer_dscp => $46, _connections_limit => $47, _connections_limit_per_torrent => $48, _unchoke_slots => $49, _half_open_limit => $50, _stats_interval_ms => $51)",
+        "SELECT revaer_config.update_engine_profile(_id => $1, _implementation => $2, _listen_port => $3, _dht => $4, _encryption => $5, _max_active => $6, _max_download_bps => $7, _max_upload_bps => $8, _seed_ratio_limit => $9, _seed_time_limit => $10, _sequential_default => $11, _auto_managed => $12, _auto_manage_prefer_seeds => $13, _dont_count_slow_torrents => $14, _super_seeding => $15, _choking_algorithm => $16, _seed_choking_algorithm => $17, _strict_super_seeding => $18, _optimistic_unchoke_slots => $19, _max_queued_disk_bytes => $20, _resume_dir => $21, _download_root => $22, _storage_mode => $23, _use_partfile => $24, _cache_size => $25, _cache_expiry => $26, _coalesce_reads => $27, _coalesce_writes => $28, _use_disk_cache_pool => $29, _disk_read_mode => $30, _disk_write_mode => $31, _verify_piece_hashes => $32, _lsd => $33, _upnp => $34, _natpmp => $35, _pex => $36, _ipv6_mode => $37, _anonymous_mode => $38, _force_proxy => $39, _prefer_rc4 => $40, _allow_multiple_connections_per_ip => $41, _enable_outgoing_utp => $42, _enable_incoming_utp => $43, _outgoing_port_min => $44, _outgoing_port_max => $45, _peer_dscp => $46, _connections_limit => $47, _connections_limit_per_torrent => $48, _unchoke_slots => $49, _half_open_limit => $50, _stats_interval_ms => $51, _resume_checkpoint_interval_ms => $52, _resume_max_inflight_saves => $53, _disk_io_backend => $54, _aio_threads => $55, _hashing_threads => $56)",
     )
     .bind(profile.id)
     .bind(profile.implementation)
@@ -1888,6 +1913,11 @@ where
     .bind(profile.unchoke_slots)
     .bind(profile.half_open_limit)
     .bind(profile.stats_interval_ms)
+    .bind(profile.resume_checkpoint_interval_ms)
+    .bind(profile.resume_max_inflight_saves)
+    .bind(profile.disk_io_backend)
+    .bind(profile.aio_threads)
+    .bind(profile.hashing_threads)
     .execute(executor)
     .await
     .map_err(map_query_err("update engine profile"))?;
@@ -53,6 +53,11 @@ fn engine_update_from_row(row: &EngineProfileRow) -> EngineProfileUpdate<'_> {
         verify_piece_hashes: row.verify_piece_hashes,
         cache_size: row.cache_size,
         cache_expiry: row.cache_expiry,
+        resume_checkpoint_interval_ms: row.resume_checkpoint_interval_ms,
+        resume_max_inflight_saves: row.resume_max_inflight_saves,
+        disk_io_backend: row.disk_io_backend.as_deref(),
+        aio_threads: row.aio_threads,
+        hashing_threads: row.hashing_threads,
         nat: row.nat,
         ipv6_mode: &row.ipv6_mode,
         privacy: row.privacy,
@@ -24,7 +24,8 @@ pub mod topics;
 
 pub use error::{EventBusError, EventBusResult};
 pub use payloads::{
-    DEFAULT_REPLAY_CAPACITY, DiscoveredFile, Event, EventEnvelope, EventId, TorrentState,
+    DEFAULT_REPLAY_CAPACITY, DiscoveredFile, Event, EventEnvelope, EventId, FileProgress,
+    TorrentState,
 };
 #[cfg(not(target_arch = "wasm32"))]
 pub use routing::{EventBus, EventStream};
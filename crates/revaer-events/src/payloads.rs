@@ -48,6 +48,13 @@ pub enum Event {
         /// Current share ratio reported by the engine.
         ratio: f64,
     },
+    /// Completion changed for individual files of a downloading torrent.
+    FileProgress {
+        /// Identifier for the torrent whose files progressed.
+        torrent_id: Uuid,
+        /// Files whose completed bytes changed since the previous update.
+        files: Vec<FileProgress>,
+    },
     /// Torrent transitioned into a new lifecycle state.
     StateChanged {
         /// Identifier for the torrent whose state changed.
@@ -133,6 +140,7 @@ impl Event {
             Self::TorrentAdded { .. } => "torrent_added",
             Self::FilesDiscovered { .. } => "files_discovered",
             Self::Progress { .. } => "progress",
+            Self::FileProgress { .. } => "file_progress",
             Self::StateChanged { .. } => "state_changed",
             Self::Completed { .. } => "completed",
             Self::MetadataUpdated { .. } => "metadata_updated",
@@ -191,6 +199,17 @@ mod tests {
             },
             "progress",
         );
+        assert_event_kind(
+            &Event::FileProgress {
+                torrent_id: Uuid::nil(),
+                files: vec![FileProgress {
+                    index: 0,
+                    bytes_completed: 1,
+                    completed: true,
+                }],
+            },
+            "file_progress",
+        );
         assert_event_kind(
             &Event::StateChanged {
                 torrent_id: Uuid::nil(),
@@ -301,6 +320,17 @@ pub struct DiscoveredFile {
     pub size_bytes: u64,
 }
 
+/// Completion change for a single file within a torrent.
+#[derive(Debug, Clone, Copy, serde::Serialize, serde::Deserialize, PartialEq, Eq)]
+pub struct FileProgress {
+    /// Index of the file within the torrent metainfo.
+    pub index: u32,
+    /// Bytes of the file downloaded and verified so far.
+    pub bytes_completed: u64,
+    /// Whether the file is fully downloaded.
+    pub completed: bool,
+}
+
 /// High-level torrent states that downstream consumers care about.
 #[derive(Debug, Clone, serde::Serialize, serde::Deserialize, PartialEq, Eq)]
 #[serde(rename_all = "snake_case")]
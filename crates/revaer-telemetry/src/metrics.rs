@@ -10,8 +10,8 @@ use std::time::Duration;
 use crate::error::{Result, TelemetryError};
 use prometheus::core::Collector;
 use prometheus::{
-    Encoder, HistogramOpts, HistogramVec, IntCounter, IntCounterVec, IntGauge, Opts, Registry,
-    TextEncoder,
+    Encoder, HistogramOpts, HistogramVec, IntCounter, IntCounterVec, IntGauge, IntGaugeVec, Opts,
+    Registry, TextEncoder,
 };
 use serde::Serialize;
 
@@ -30,6 +30,7 @@ struct MetricsInner {
     queue_depth: IntGauge,
     engine_bytes_in: IntGauge,
     engine_bytes_out: IntGauge,
+    engine_session_stats: IntGaugeVec,
     config_watch_latency_ms: IntGauge,
     config_apply_latency_ms: IntGauge,
     config_update_failures_total: IntCounter,
@@ -51,6 +52,7 @@ struct MetricsCollectors {
     queue_depth: IntGauge,
     engine_bytes_in: IntGauge,
     engine_bytes_out: IntGauge,
+    engine_session_stats: IntGaugeVec,
     config_watch_latency_ms: IntGauge,
     config_apply_latency_ms: IntGauge,
     config_update_failures_total: IntCounter,
@@ -143,6 +145,16 @@ impl Metrics {
         self.inner.engine_bytes_out.set(value);
     }
 
+    /// Record the latest libtorrent session counters, labelled by metric name.
+    pub fn set_engine_session_stats<'a>(&self, stats: impl IntoIterator<Item = (&'a str, i64)>) {
+        for (name, value) in stats {
+            self.inner
+                .engine_session_stats
+                .with_label_values(&[name])
+                .set(value);
+        }
+    }
+
     /// Record the observed latency while waiting for configuration updates.
     pub fn observe_config_watch_latency(&self, duration: Duration) {
         self.inner
@@ -271,6 +283,7 @@ impl MetricsInner {
             queue_depth,
             engine_bytes_in,
             engine_bytes_out,
+            engine_session_stats,
             config_watch_latency_ms,
             config_apply_latency_ms,
             config_update_failures_total,
@@ -293,6 +306,7 @@ impl MetricsInner {
             queue_depth,
             engine_bytes_in,
             engine_bytes_out,
+            engine_session_stats,
             config_watch_latency_ms,
             config_apply_latency_ms,
             config_update_failures_total,
@@ -330,6 +344,11 @@ impl MetricsCollectors {
             queue_depth: gauge("queue_depth", "Queued torrent operations")?,
             engine_bytes_in: gauge("engine_bytes_in", "Bytes received by the engine")?,
             engine_bytes_out: gauge("engine_bytes_out", "Bytes sent by the engine")?,
+            engine_session_stats: gauge_vec(
+                "engine_session_stat",
+                "Latest libtorrent session counter sample by metric name",
+                &["metric"],
+            )?,
             config_watch_latency_ms: gauge(
                 "config_watch_latency_ms",
                 "Time spent waiting for configuration updates (ms)",
@@ -402,6 +421,11 @@ impl MetricsCollectors {
         register_collector(registry, "queue_depth", self.queue_depth.clone())?;
         register_collector(registry, "engine_bytes_in", self.engine_bytes_in.clone())?;
         register_collector(registry, "engine_bytes_out", self.engine_bytes_out.clone())?;
+        register_collector(
+            registry,
+            "engine_session_stat",
+            self.engine_session_stats.clone(),
+        )?;
         register_collector(
             registry,
             "config_watch_latency_ms",
@@ -476,6 +500,11 @@ fn histogram_vec(name: &'static str, help: &'static str, labels: &[&str]) -> Res
         .map_err(|source| TelemetryError::MetricsCollector { name, source })
 }
 
+fn gauge_vec(name: &'static str, help: &'static str, labels: &[&str]) -> Result<IntGaugeVec> {
+    IntGaugeVec::new(Opts::new(name, help), labels)
+        .map_err(|source| TelemetryError::MetricsCollector { name, source })
+}
+
 fn gauge(name: &'static str, help: &'static str) -> Result<IntGauge> {
     IntGauge::with_opts(Opts::new(name, help))
         .map_err(|source| TelemetryError::MetricsCollector { name, source })
@@ -511,6 +540,7 @@ mod tests {
         metrics.set_queue_depth(2);
         metrics.set_engine_bytes_in(1_024);
         metrics.set_engine_bytes_out(2_048);
+        metrics.set_engine_session_stats([("disk.queued_disk_jobs", 3), ("net.sent_bytes", 2_048)]);
         metrics.observe_config_watch_latency(Duration::from_millis(120));
         metrics.observe_config_apply_latency(Duration::from_millis(45));
         metrics.inc_config_update_failure();
@@ -540,6 +570,7 @@ mod tests {
         let rendered = metrics.render()?;
         assert!(rendered.contains("http_requests_total"));
         assert!(rendered.contains("fsops_steps_total"));
+        assert!(rendered.contains("engine_session_stat{metric=\"disk.queued_disk_jobs\"} 3"));
         assert!(rendered.contains("config_guardrail_violations_total"));
         assert!(rendered.contains("indexer_torznab_invalid_requests_total"));
         assert!(rendered.contains("indexer_search_requests_total"));
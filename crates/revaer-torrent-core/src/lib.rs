@@ -22,7 +22,7 @@ pub mod service;
 
 pub use error::{TorrentError, TorrentResult};
 pub use model::{
-    AddTorrent, AddTorrentOptions, EngineEvent, FilePriority, FilePriorityOverride,
+    AddTorrent, AddTorrentOptions, EngineEvent, FilePriority, FilePriorityOverride, FileProgress,
     FileSelectionRules, FileSelectionUpdate, PeerChoke, PeerInterest, PeerSnapshot, RemoveTorrent,
     StorageMode, TorrentCleanupPolicy, TorrentFile, TorrentLabelPolicy, TorrentProgress,
     TorrentRateLimit, TorrentRates, TorrentSource, TorrentStatus,
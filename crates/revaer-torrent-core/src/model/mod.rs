@@ -88,6 +88,8 @@ pub struct AddTorrentOptions {
     pub seed_mode: Option<bool>,
     /// Optional percentage of pieces to hash-check before honoring seed mode.
     pub hash_check_sample_pct: Option<u8>,
+    /// Whether every piece should be hashed against existing data before admission.
+    pub pre_verify: Option<bool>,
     /// Whether the torrent should use super-seeding.
     pub super_seeding: Option<bool>,
     /// Per-torrent rate limits applied immediately after the torrent is added.
@@ -139,6 +141,25 @@ pub struct TorrentAuthorRequest {
     #[serde(default)]
     /// Optional source label embedded in the metainfo.
     pub source: Option<String>,
+    #[serde(default)]
+    /// Optional number of hashing threads; defaults to the available parallelism.
+    pub hash_threads: Option<u32>,
+    #[serde(default)]
+    /// Metainfo format to author.
+    pub format: TorrentAuthorFormat,
+}
+
+/// Metainfo formats supported by torrent authoring.
+#[derive(Debug, Clone, Copy, Serialize, Deserialize, Default, PartialEq, Eq)]
+#[serde(rename_all = "snake_case")]
+pub enum TorrentAuthorFormat {
+    /// Both v1 and v2 info dictionaries; opt-in.
+    Hybrid,
+    /// `BitTorrent` v1 only (SHA-1 pieces), the most widely supported format (default).
+    #[default]
+    V1,
+    /// `BitTorrent` v2 only (per-file SHA-256 merkle trees).
+    V2,
 }
 
 /// File entry included in a newly authored torrent.
@@ -159,6 +180,12 @@ pub struct TorrentAuthorResult {
     pub magnet_uri: String,
     /// Best available info hash string.
     pub info_hash: String,
+    #[serde(default)]
+    /// SHA-1 info hash when the metainfo carries a v1 info dictionary.
+    pub info_hash_v1: Option<String>,
+    #[serde(default)]
+    /// SHA-256 info hash when the metainfo carries a v2 info dictionary.
+    pub info_hash_v2: Option<String>,
     /// Effective piece length in bytes.
     pub piece_length: u32,
     /// Total size of the payload in bytes.
@@ -183,6 +210,23 @@ pub struct TorrentAuthorResult {
     pub source: Option<String>,
 }
 
+/// Progress snapshot for a background torrent authoring job.
+#[derive(Debug, Clone, Copy, Serialize, Deserialize, Default, PartialEq, Eq)]
+pub struct TorrentAuthorProgress {
+    /// Identifier of the authoring job.
+    pub job_id: Uuid,
+    /// Payload bytes hashed so far.
+    pub bytes_hashed: u64,
+    /// Total payload bytes to hash.
+    pub bytes_total: u64,
+    /// Pieces hashed so far.
+    pub pieces_done: u32,
+    /// Total pieces in the torrent.
+    pub pieces_total: u32,
+    /// Average hashing throughput since the job started.
+    pub bytes_per_second: u64,
+}
+
 /// Storage allocation strategies supported by the engine.
 #[derive(Debug, Clone, Copy, Serialize, Deserialize, PartialEq, Eq)]
 #[serde(rename_all = "snake_case")]
@@ -476,6 +520,17 @@ pub struct TorrentFile {
     pub selected: bool,
 }
 
+/// Completion change for a single file, reported as the engine verifies pieces.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Serialize, Deserialize)]
+pub struct FileProgress {
+    /// Index of the file within the torrent metainfo.
+    pub index: u32,
+    /// Bytes of the file covered by verified pieces.
+    pub bytes_completed: u64,
+    /// Whether every byte of the file is present.
+    pub completed: bool,
+}
+
 /// High-level torrent status surfaced by the inspector.
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct TorrentStatus {
@@ -553,6 +608,13 @@ pub enum EngineEvent {
         /// Updated transfer rates.
         rates: TorrentRates,
     },
+    /// Completion changed for some of a torrent's files since the previous report.
+    FileProgress {
+        /// Torrent identifier.
+        torrent_id: Uuid,
+        /// Files whose completed bytes changed.
+        files: Vec<FileProgress>,
+    },
     /// Torrent state transitioned.
     StateChanged {
         /// Torrent identifier.
@@ -610,6 +672,38 @@ pub enum EngineEvent {
         /// Human-readable message.
         message: String,
     },
+    /// A background authoring job hashed more pieces.
+    AuthoringProgress {
+        /// Latest progress snapshot.
+        progress: TorrentAuthorProgress,
+    },
+    /// A background authoring job finished, failed, or was cancelled.
+    AuthoringFinished {
+        /// Identifier of the authoring job.
+        job_id: Uuid,
+    },
+    /// A torrent held back for pre-verification checked more of its existing data.
+    VerifyProgress {
+        /// Torrent identifier.
+        torrent_id: Uuid,
+        /// Pieces checked so far.
+        pieces_done: u32,
+        /// Pieces in the torrent.
+        pieces_total: u32,
+    },
+    /// A torrent held back for pre-verification was admitted into the session. A failed
+    /// pre-verify reports [`EngineEvent::Error`] instead.
+    VerifyAdmitted {
+        /// Torrent identifier.
+        torrent_id: Uuid,
+    },
+    /// A bulk restore of stored torrents finished admitting or rejecting every entry.
+    RestoreFinished {
+        /// Torrents admitted into the session.
+        restored: u32,
+        /// Torrents whose restore failed; each also reported an [`EngineEvent::Error`].
+        failed: u32,
+    },
 }
 
 #[cfg(test)]
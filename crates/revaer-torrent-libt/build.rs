@@ -30,9 +30,13 @@ fn try_main() -> Result<(), BuildError> {
         .map(PathBuf::from)
         .ok_or(BuildError::MissingManifestDir)?;
 
-    let mut bridge = cxx_build::bridge("src/ffi/bridge.rs");
+    // The oracle bridge and its TU back the splice parity tests only; production code never
+    // references them, so the linker drops them from shipped binaries.
+    let mut bridge = cxx_build::bridges(["src/ffi/bridge.rs", "src/ffi/oracle.rs"]);
     bridge.flag_if_supported("-std=c++17");
     bridge.file("src/ffi/session.cpp");
+    bridge.file("src/ffi/metainfo.cpp");
+    bridge.file("src/ffi/metainfo_oracle.cpp");
 
     let include_dir = PathBuf::from("src/ffi/include");
     bridge.include(&include_dir);
@@ -220,8 +224,13 @@ fn emit_link_libs(libs: Vec<String>) {
 fn emit_reruns() {
     // Re-run if the bridge or C++ sources change.
     println!("cargo:rerun-if-changed=src/ffi/bridge.rs");
+    println!("cargo:rerun-if-changed=src/ffi/oracle.rs");
     println!("cargo:rerun-if-changed=src/ffi/include/revaer/session.hpp");
+    println!("cargo:rerun-if-changed=src/ffi/include/revaer/metainfo.hpp");
+    println!("cargo:rerun-if-changed=src/ffi/include/revaer/metainfo_oracle.hpp");
     println!("cargo:rerun-if-changed=src/ffi/session.cpp");
+    println!("cargo:rerun-if-changed=src/ffi/metainfo.cpp");
+    println!("cargo:rerun-if-changed=src/ffi/metainfo_oracle.cpp");
 }
 
 fn ensure_header_version(include_dir: &Path) -> Result<(), BuildError> {
@@ -1,25 +1,60 @@
 //! Safe wrapper around the libtorrent worker and FFI bindings.
 
-use tokio::sync::{mpsc, oneshot};
+use tokio::sync::{mpsc, oneshot, watch};
 use uuid::Uuid;
 
 use crate::command::EngineCommand;
 use crate::error::op_failed;
 use crate::store::FastResumeStore;
-use crate::types::{EngineRuntimeConfig, EngineSettingsSnapshot};
+use crate::types::{
+    EngineRuntimeConfig, EngineSettingsSnapshot, MetadataCacheStats, SessionStats, TimingState,
+};
 use crate::worker;
 use revaer_events::EventBus;
 use revaer_torrent_core::{
     AddTorrent, FileSelectionUpdate, PeerSnapshot, RemoveTorrent, TorrentEngine, TorrentRateLimit,
     TorrentResult,
     model::{
-        PieceDeadline, TorrentAuthorRequest, TorrentAuthorResult, TorrentOptionsUpdate,
-        TorrentTrackersUpdate, TorrentWebSeedsUpdate,
+        PieceDeadline, TorrentAuthorProgress, TorrentAuthorRequest, TorrentAuthorResult,
+        TorrentOptionsUpdate, TorrentTrackersUpdate, TorrentWebSeedsUpdate,
     },
 };
 
 const COMMAND_BUFFER: usize = 128;
 
+/// Handle to a torrent authoring job running on the engine.
+#[derive(Debug)]
+pub struct TorrentAuthorJob {
+    job_id: Uuid,
+    progress: watch::Receiver<TorrentAuthorProgress>,
+    result: oneshot::Receiver<TorrentResult<TorrentAuthorResult>>,
+}
+
+impl TorrentAuthorJob {
+    /// Identifier used to cancel the job.
+    #[must_use]
+    pub const fn job_id(&self) -> Uuid {
+        self.job_id
+    }
+
+    /// Subscribe to hashing progress updates.
+    #[must_use]
+    pub fn progress(&self) -> watch::Receiver<TorrentAuthorProgress> {
+        self.progress.clone()
+    }
+
+    /// Wait for the authored metainfo.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if authoring fails, is cancelled, or the engine stops.
+    pub async fn wait(self) -> TorrentResult<TorrentAuthorResult> {
+        self.result
+            .await
+            .map_err(|err| op_failed("create_torrent", None, err))?
+    }
+}
+
 /// Thin wrapper around the libtorrent bindings that also emits domain events.
 #[derive(Clone)]
 pub struct LibtorrentEngine {
@@ -68,6 +103,86 @@ impl LibtorrentEngine {
             .map_err(|err| op_failed("inspect_settings", None, err))?
     }
 
+    /// Inspect occupancy and memory accounting of the native parsed-metadata cache.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the statistics cannot be retrieved.
+    pub async fn inspect_metadata_cache(&self) -> TorrentResult<MetadataCacheStats> {
+        let (respond_to, rx) = oneshot::channel();
+        self.send_command(EngineCommand::InspectMetadataCache { respond_to })
+            .await?;
+        rx.await
+            .map_err(|err| op_failed("inspect_metadata_cache", None, err))?
+    }
+
+    /// Inspect the latest sample of libtorrent's session-wide performance counters.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the sample cannot be retrieved.
+    pub async fn inspect_session_stats(&self) -> TorrentResult<SessionStats> {
+        let (respond_to, rx) = oneshot::channel();
+        self.send_command(EngineCommand::InspectSessionStats { respond_to })
+            .await?;
+        rx.await
+            .map_err(|err| op_failed("inspect_session_stats", None, err))?
+    }
+
+    /// Inspect latency histograms for every native session entry point, measured inside the
+    /// bridge so they exclude time spent queueing in the Rust worker.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the histograms cannot be retrieved.
+    pub async fn inspect_timing_state(&self) -> TorrentResult<TimingState> {
+        let (respond_to, rx) = oneshot::channel();
+        self.send_command(EngineCommand::InspectTimingState { respond_to })
+            .await?;
+        rx.await
+            .map_err(|err| op_failed("inspect_timing_state", None, err))?
+    }
+
+    /// Start authoring a `.torrent` and return a handle for progress, cancellation, and the
+    /// result.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the request could not be enqueued for the background worker.
+    pub async fn start_create_torrent(
+        &self,
+        request: TorrentAuthorRequest,
+    ) -> TorrentResult<TorrentAuthorJob> {
+        let job_id = Uuid::new_v4();
+        let (respond_to, result) = oneshot::channel();
+        let (progress_tx, progress) = watch::channel(TorrentAuthorProgress {
+            job_id,
+            ..TorrentAuthorProgress::default()
+        });
+        self.send_command(EngineCommand::CreateTorrent {
+            job_id,
+            request,
+            progress: progress_tx,
+            respond_to,
+        })
+        .await?;
+        Ok(TorrentAuthorJob {
+            job_id,
+            progress,
+            result,
+        })
+    }
+
+    /// Cancel an authoring job; hashing stops within one piece.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the cancel could not be enqueued for the background worker.
+    pub async fn cancel_create_torrent(&self, job_id: Uuid) -> TorrentResult<()> {
+        self.send_command(EngineCommand::CancelCreateTorrent { job_id })
+            .await
+    }
+
     fn build(events: EventBus, store: Option<FastResumeStore>) -> TorrentResult<Self> {
         let session = crate::session::create_session()?;
         let (commands, rx) = mpsc::channel(COMMAND_BUFFER);
@@ -100,14 +215,7 @@ impl TorrentEngine for LibtorrentEngine {
         &self,
         request: TorrentAuthorRequest,
     ) -> TorrentResult<TorrentAuthorResult> {
-        let (respond_to, rx) = oneshot::channel();
-        self.send_command(EngineCommand::CreateTorrent {
-            request,
-            respond_to,
-        })
-        .await?;
-        rx.await
-            .map_err(|err| op_failed("create_torrent", None, err))?
+        self.start_create_torrent(request).await?.wait().await
     }
 
     async fn remove_torrent(&self, id: Uuid, options: RemoveTorrent) -> TorrentResult<()> {
@@ -248,6 +356,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: crate::types::DiskIoBackend::Auto,
+            aio_threads: None,
+            hashing_threads: None,
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
             listen_interfaces: Vec::new(),
             ipv6_mode: Ipv6Mode::Disabled,
             enable_dht: false,
@@ -375,7 +488,7 @@ mod tests {
     async fn resume_store_is_initialized_when_provided() -> Result<()> {
         let dir = temp_dir("revaer-libt-resume-")?;
         let resume_dir = dir.path().join("resume");
-        let store = FastResumeStore::new(&resume_dir);
+        let store = FastResumeStore::packed(&resume_dir)?;
 
         let events = EventBus::with_capacity(8);
         let engine = LibtorrentEngine::with_resume_store(events, store)?;
@@ -390,6 +503,10 @@ mod tests {
             resume_dir.exists(),
             "fast-resume store should ensure directory exists"
         );
+        assert!(
+            resume_dir.join("resume-00000001.log").exists(),
+            "packed store should open its first segment"
+        );
         Ok(())
     }
 
@@ -409,4 +526,46 @@ mod tests {
         assert_eq!(settings.proxy_password, None);
         Ok(())
     }
+
+    #[tokio::test]
+    async fn inspect_metadata_cache_starts_empty() -> Result<()> {
+        let events = EventBus::with_capacity(4);
+        let engine = LibtorrentEngine::new(events)?;
+
+        let stats = engine.inspect_metadata_cache().await?;
+
+        assert_eq!(stats.entries, 0);
+        assert_eq!(stats.bytes, 0);
+        assert_eq!(stats.hits, 0);
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn inspect_session_stats_aligns_values_with_metrics() -> Result<()> {
+        let events = EventBus::with_capacity(4);
+        let engine = LibtorrentEngine::new(events)?;
+
+        let stats = engine.inspect_session_stats().await?;
+
+        if stats.sequence > 0 {
+            assert_eq!(stats.values.len(), stats.metrics.len());
+        } else {
+            assert!(stats.values.is_empty());
+        }
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn inspect_timing_state_aligns_buckets_with_bounds() -> Result<()> {
+        let events = EventBus::with_capacity(4);
+        let engine = LibtorrentEngine::new(events)?;
+
+        let timing = engine.inspect_timing_state().await?;
+
+        for call in &timing.calls {
+            assert_eq!(call.buckets.len(), timing.bucket_bounds.len());
+            assert_eq!(call.buckets.iter().sum::<u64>(), call.calls);
+        }
+        Ok(())
+    }
 }
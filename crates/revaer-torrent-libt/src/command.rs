@@ -1,12 +1,14 @@
-use crate::types::{EngineRuntimeConfig, EngineSettingsSnapshot};
+use crate::types::{
+    EngineRuntimeConfig, EngineSettingsSnapshot, MetadataCacheStats, SessionStats, TimingState,
+};
 use revaer_torrent_core::{
     AddTorrent, FileSelectionUpdate, PeerSnapshot, RemoveTorrent, TorrentRateLimit, TorrentResult,
     model::{
-        TorrentAuthorRequest, TorrentAuthorResult, TorrentOptionsUpdate, TorrentTrackersUpdate,
-        TorrentWebSeedsUpdate,
+        TorrentAuthorProgress, TorrentAuthorRequest, TorrentAuthorResult, TorrentOptionsUpdate,
+        TorrentTrackersUpdate, TorrentWebSeedsUpdate,
     },
 };
-use tokio::sync::oneshot;
+use tokio::sync::{oneshot, watch};
 use uuid::Uuid;
 
 /// Command definitions and runtime configuration inputs for the libtorrent worker.
@@ -17,11 +19,20 @@ pub enum EngineCommand {
     Add(Box<AddTorrent>),
     /// Author a new `.torrent` metainfo payload.
     CreateTorrent {
+        /// Identifier used to track and cancel the authoring job.
+        job_id: Uuid,
         /// Authoring request parameters.
         request: TorrentAuthorRequest,
+        /// Channel updated as pieces are hashed.
+        progress: watch::Sender<TorrentAuthorProgress>,
         /// Channel used to return the authoring result.
         respond_to: oneshot::Sender<TorrentResult<TorrentAuthorResult>>,
     },
+    /// Cancel a running authoring job.
+    CancelCreateTorrent {
+        /// Identifier of the authoring job.
+        job_id: Uuid,
+    },
     /// Remove a torrent from the session, optionally deleting its data.
     Remove {
         /// Unique torrent identifier.
@@ -121,6 +132,21 @@ pub enum EngineCommand {
         /// Channel used to return the settings snapshot.
         respond_to: oneshot::Sender<TorrentResult<EngineSettingsSnapshot>>,
     },
+    /// Inspect parsed-metadata cache occupancy and memory accounting.
+    InspectMetadataCache {
+        /// Channel used to return the cache statistics.
+        respond_to: oneshot::Sender<TorrentResult<MetadataCacheStats>>,
+    },
+    /// Inspect the latest sample of session performance counters.
+    InspectSessionStats {
+        /// Channel used to return the counter sample.
+        respond_to: oneshot::Sender<TorrentResult<SessionStats>>,
+    },
+    /// Inspect per-method latency histograms for the native session entry points.
+    InspectTimingState {
+        /// Channel used to return the histograms.
+        respond_to: oneshot::Sender<TorrentResult<TimingState>>,
+    },
 }
 
 impl EngineCommand {
@@ -128,6 +154,7 @@ impl EngineCommand {
         match self {
             Self::Add(_) => "add_torrent",
             Self::CreateTorrent { .. } => "create_torrent",
+            Self::CancelCreateTorrent { .. } => "cancel_create_torrent",
             Self::Remove { .. } => "remove_torrent",
             Self::Pause { .. } => "pause_torrent",
             Self::Resume { .. } => "resume_torrent",
@@ -144,6 +171,9 @@ impl EngineCommand {
             Self::QueryPeers { .. } => "query_peers",
             Self::SetPieceDeadline { .. } => "set_piece_deadline",
             Self::InspectSettings { .. } => "inspect_settings",
+            Self::InspectMetadataCache { .. } => "inspect_metadata_cache",
+            Self::InspectSessionStats { .. } => "inspect_session_stats",
+            Self::InspectTimingState { .. } => "inspect_timing_state",
         }
     }
 
@@ -164,9 +194,13 @@ impl EngineCommand {
             | Self::QueryPeers { id, .. }
             | Self::SetPieceDeadline { id, .. } => Some(*id),
             Self::UpdateLimits { id, .. } => *id,
-            Self::CreateTorrent { .. } | Self::ApplyConfig(_) | Self::InspectSettings { .. } => {
-                None
-            }
+            Self::CreateTorrent { .. }
+            | Self::CancelCreateTorrent { .. }
+            | Self::ApplyConfig(_)
+            | Self::InspectSettings { .. }
+            | Self::InspectMetadataCache { .. }
+            | Self::InspectSessionStats { .. }
+            | Self::InspectTimingState { .. } => None,
         }
     }
 }
@@ -1,11 +1,269 @@
 //! Conversions between native libtorrent types and domain events.
 
 use revaer_events::TorrentState as EventState;
-use revaer_torrent_core::{EngineEvent, FilePriority, model::TrackerStatus};
+use revaer_torrent_core::{
+    EngineEvent, FilePriority, FileProgress,
+    model::{TorrentAuthorProgress, TrackerStatus},
+};
 use tracing::debug;
 use uuid::Uuid;
 
-use crate::ffi::ffi::{NativeEvent, NativeEventKind, NativeTorrentState, NativeTrackerStatus};
+use crate::ffi::ffi::{
+    NativeEvent, NativeEventBatch, NativeEventKind, NativeFile, NativeTorrentState,
+    NativeTorrentUpdate, NativeTrackerStatus, NativeUpdateKind, TorrentKey,
+};
+
+/// Binary form of a torrent id as passed across the native bridge.
+#[must_use]
+pub(crate) const fn torrent_key(id: Uuid) -> TorrentKey {
+    let (hi, lo) = id.as_u64_pair();
+    TorrentKey { hi, lo }
+}
+
+/// Torrent ids indexed by the slot the native session binds when a torrent is registered.
+#[derive(Debug, Default)]
+pub(crate) struct TorrentSlots {
+    ids: Vec<Option<Uuid>>,
+}
+
+impl TorrentSlots {
+    fn bind(&mut self, slot: u32, id: TorrentKey) {
+        let Ok(index) = usize::try_from(slot) else {
+            return;
+        };
+        if self.ids.len() <= index {
+            self.ids.resize(index + 1, None);
+        }
+        let id = Uuid::from_u64_pair(id.hi, id.lo);
+        self.ids[index] = (!id.is_nil()).then_some(id);
+    }
+
+    fn get(&self, slot: u32) -> Option<Uuid> {
+        usize::try_from(slot)
+            .ok()
+            .and_then(|index| self.ids.get(index).copied().flatten())
+    }
+}
+
+/// Consecutive `list_files` failures after which a file table is abandoned.
+const MAX_PAGE_FAILURES: u32 = 3;
+
+/// File tables announced by `FilesDiscovered` and still being paged out of the native session.
+///
+/// Events that refer to a torrent's files (`MetadataUpdated`, `Completed`, `FileProgress`) are
+/// held while its table is pending and released right after the assembled `FilesDiscovered`,
+/// so consumers never see them ahead of the file list.
+#[derive(Debug, Default)]
+pub(crate) struct FileTables {
+    pending: Vec<FileTable>,
+}
+
+#[derive(Debug)]
+struct FileTable {
+    torrent_id: Uuid,
+    total: u32,
+    files: Vec<revaer_torrent_core::TorrentFile>,
+    failures: u32,
+    held: Vec<EngineEvent>,
+}
+
+impl FileTables {
+    /// Start assembling the tables announced, by file count only, in `batch`.
+    ///
+    /// A repeated announcement restarts the table for that torrent.
+    pub(crate) fn announce(&mut self, batch: &NativeEventBatch) {
+        for event in &batch.events {
+            if event.kind != NativeEventKind::FilesDiscovered
+                || !event.files.is_empty()
+                || event.file_count == 0
+            {
+                continue;
+            }
+            let Some(torrent_id) = Uuid::parse_str(&event.id).ok().filter(|id| !id.is_nil()) else {
+                continue;
+            };
+            let held = self
+                .pending
+                .iter()
+                .position(|table| table.torrent_id == torrent_id)
+                .map(|index| self.pending.remove(index).held)
+                .unwrap_or_default();
+            self.pending.push(FileTable {
+                torrent_id,
+                total: event.file_count,
+                files: Vec::new(),
+                failures: 0,
+                held,
+            });
+        }
+    }
+
+    /// Pass `events` through, holding back those that depend on a table still pending.
+    #[must_use]
+    pub(crate) fn hold_dependents(&mut self, events: Vec<EngineEvent>) -> Vec<EngineEvent> {
+        if self.pending.is_empty() {
+            return events;
+        }
+        let mut released = Vec::with_capacity(events.len());
+        for event in events {
+            let dependent = match &event {
+                EngineEvent::MetadataUpdated { torrent_id, .. }
+                | EngineEvent::Completed { torrent_id, .. }
+                | EngineEvent::FileProgress { torrent_id, .. } => Some(*torrent_id),
+                _ => None,
+            };
+            match dependent
+                .and_then(|id| self.pending.iter_mut().find(|table| table.torrent_id == id))
+            {
+                Some(table) => table.held.push(event),
+                None => released.push(event),
+            }
+        }
+        released
+    }
+
+    /// Torrent and offset of the next page to fetch, oldest announcement first.
+    #[must_use]
+    pub(crate) fn next_request(&self) -> Option<(Uuid, u32)> {
+        self.pending.first().and_then(|table| {
+            u32::try_from(table.files.len())
+                .ok()
+                .map(|offset| (table.torrent_id, offset))
+        })
+    }
+
+    /// Append a page fetched for `torrent_id`. Once the table is complete, returns its
+    /// `FilesDiscovered` followed by the events held for it; until then returns nothing.
+    ///
+    /// An empty page means the torrent left the session, so its table is abandoned and only
+    /// the held events are returned.
+    #[must_use]
+    pub(crate) fn complete_page(
+        &mut self,
+        torrent_id: Uuid,
+        page: Vec<NativeFile>,
+    ) -> Vec<EngineEvent> {
+        let Some(index) = self
+            .pending
+            .iter()
+            .position(|table| table.torrent_id == torrent_id)
+        else {
+            return Vec::new();
+        };
+        if page.is_empty() {
+            debug!(%torrent_id, "dropped file table for torrent without metadata");
+            return self.pending.remove(index).held;
+        }
+        let table = &mut self.pending[index];
+        table.failures = 0;
+        table.files.extend(page.into_iter().map(map_file));
+        if u32::try_from(table.files.len()).is_ok_and(|len| len < table.total) {
+            return Vec::new();
+        }
+        let table = self.pending.remove(index);
+        let mut events = Vec::with_capacity(table.held.len() + 1);
+        events.push(EngineEvent::FilesDiscovered {
+            torrent_id,
+            files: table.files,
+        });
+        events.extend(table.held);
+        events
+    }
+
+    /// Record a failed page fetch for `torrent_id`; the page is retried on a later poll.
+    ///
+    /// Once the table has failed `MAX_PAGE_FAILURES` times in a row it is abandoned and the
+    /// events held for it are returned.
+    #[must_use]
+    pub(crate) fn fail_page(&mut self, torrent_id: Uuid) -> Option<Vec<EngineEvent>> {
+        let index = self
+            .pending
+            .iter()
+            .position(|table| table.torrent_id == torrent_id)?;
+        let table = &mut self.pending[index];
+        table.failures += 1;
+        if table.failures < MAX_PAGE_FAILURES {
+            return None;
+        }
+        Some(self.pending.remove(index).held)
+    }
+}
+
+/// Translate one native poll into domain events.
+///
+/// Bindings are applied first; compact updates are then replayed in their original order
+/// relative to the full events. Consecutive file updates for one torrent share one event.
+#[must_use]
+pub(crate) fn map_event_batch(
+    slots: &mut TorrentSlots,
+    batch: NativeEventBatch,
+) -> Vec<EngineEvent> {
+    for binding in &batch.bindings {
+        slots.bind(binding.slot, binding.id);
+    }
+    let mut events = Vec::with_capacity(batch.events.len() + batch.updates.len());
+    let mut updates = batch.updates.into_iter().peekable();
+    for (position, native) in batch.events.into_iter().enumerate() {
+        while let Some(update) = updates.next_if(|update| {
+            usize::try_from(update.position).is_ok_and(|before| before <= position)
+        }) {
+            push_update(&mut events, map_update(slots, &update));
+        }
+        let torrent_id = Uuid::parse_str(&native.id).ok().filter(|id| !id.is_nil());
+        events.extend(map_native_event(torrent_id, native));
+    }
+    for update in updates {
+        push_update(&mut events, map_update(slots, &update));
+    }
+    events
+}
+
+fn push_update(events: &mut Vec<EngineEvent>, event: Option<EngineEvent>) {
+    match event {
+        Some(EngineEvent::FileProgress { torrent_id, files }) => match events.last_mut() {
+            Some(EngineEvent::FileProgress {
+                torrent_id: last,
+                files: merged,
+            }) if *last == torrent_id => merged.extend(files),
+            _ => events.push(EngineEvent::FileProgress { torrent_id, files }),
+        },
+        Some(event) => events.push(event),
+        None => {}
+    }
+}
+
+fn map_update(slots: &TorrentSlots, update: &NativeTorrentUpdate) -> Option<EngineEvent> {
+    let Some(torrent_id) = slots.get(update.slot) else {
+        debug!(slot = update.slot, "dropped update for unbound slot");
+        return None;
+    };
+    match update.kind {
+        NativeUpdateKind::Progress => Some(map_progress_event(
+            torrent_id,
+            update.bytes_downloaded,
+            update.bytes_total,
+            update.download_bps,
+            update.upload_bps,
+            update.ratio,
+        )),
+        NativeUpdateKind::StateChanged => Some(EngineEvent::StateChanged {
+            torrent_id,
+            state: map_state(update.state),
+        }),
+        NativeUpdateKind::FileProgress => Some(EngineEvent::FileProgress {
+            torrent_id,
+            files: vec![FileProgress {
+                index: update.file_index,
+                bytes_completed: update.bytes_downloaded,
+                completed: update.bytes_downloaded >= update.bytes_total,
+            }],
+        }),
+        other => {
+            debug!(?other, %torrent_id, "ignored unsupported libtorrent update");
+            None
+        }
+    }
+}
 
 #[must_use]
 pub(crate) fn map_native_event(id: Option<Uuid>, event: NativeEvent) -> Vec<EngineEvent> {
@@ -17,30 +275,6 @@ pub(crate) fn map_native_event(id: Option<Uuid>, event: NativeEvent) -> Vec<Engi
             };
             map_files_event(torrent_id, event.files)
         }
-        NativeEventKind::Progress => {
-            let Some(torrent_id) = id else {
-                debug!("dropped progress event without torrent id");
-                return Vec::new();
-            };
-            vec![map_progress_event(
-                torrent_id,
-                event.bytes_downloaded,
-                event.bytes_total,
-                event.download_bps,
-                event.upload_bps,
-                event.ratio,
-            )]
-        }
-        NativeEventKind::StateChanged => {
-            let Some(torrent_id) = id else {
-                debug!("dropped state change without torrent id");
-                return Vec::new();
-            };
-            vec![EngineEvent::StateChanged {
-                torrent_id,
-                state: map_state(event.state),
-            }]
-        }
         NativeEventKind::Completed => {
             let Some(torrent_id) = id else {
                 debug!("dropped completion without torrent id");
@@ -96,6 +330,51 @@ pub(crate) fn map_native_event(id: Option<Uuid>, event: NativeEvent) -> Vec<Engi
             component: (!event.component.is_empty()).then_some(event.component),
             message: event.message,
         }],
+        NativeEventKind::AuthoringProgress => {
+            let Some(job_id) = id else {
+                debug!("dropped authoring progress without job id");
+                return Vec::new();
+            };
+            vec![EngineEvent::AuthoringProgress {
+                progress: TorrentAuthorProgress {
+                    job_id,
+                    bytes_hashed: event.bytes_downloaded,
+                    bytes_total: event.bytes_total,
+                    pieces_done: event.pieces_done,
+                    pieces_total: event.pieces_total,
+                    bytes_per_second: event.download_bps,
+                },
+            }]
+        }
+        NativeEventKind::AuthoringFinished => {
+            let Some(job_id) = id else {
+                debug!("dropped authoring completion without job id");
+                return Vec::new();
+            };
+            vec![EngineEvent::AuthoringFinished { job_id }]
+        }
+        NativeEventKind::RestoreFinished => vec![EngineEvent::RestoreFinished {
+            restored: event.restored,
+            failed: event.restore_submitted.saturating_sub(event.restored),
+        }],
+        NativeEventKind::VerifyProgress => {
+            let Some(torrent_id) = id else {
+                debug!("dropped pre-verify progress without torrent id");
+                return Vec::new();
+            };
+            vec![EngineEvent::VerifyProgress {
+                torrent_id,
+                pieces_done: event.pieces_done,
+                pieces_total: event.pieces_total,
+            }]
+        }
+        NativeEventKind::VerifyAdmitted => {
+            let Some(torrent_id) = id else {
+                debug!("dropped pre-verify admission without torrent id");
+                return Vec::new();
+            };
+            vec![EngineEvent::VerifyAdmitted { torrent_id }]
+        }
         other => {
             debug!(?other, torrent_id = ?id, "ignored unsupported libtorrent event");
             Vec::new()
@@ -103,27 +382,27 @@ pub(crate) fn map_native_event(id: Option<Uuid>, event: NativeEvent) -> Vec<Engi
     }
 }
 
-fn map_files_event(id: Uuid, files: Vec<crate::ffi::ffi::NativeFile>) -> Vec<EngineEvent> {
+fn map_files_event(id: Uuid, files: Vec<NativeFile>) -> Vec<EngineEvent> {
     if files.is_empty() {
         return Vec::new();
     }
-    let files = files
-        .into_iter()
-        .map(|file| revaer_torrent_core::TorrentFile {
-            index: file.index,
-            path: file.path,
-            size_bytes: file.size_bytes,
-            bytes_completed: 0,
-            priority: FilePriority::Normal,
-            selected: true,
-        })
-        .collect();
     vec![EngineEvent::FilesDiscovered {
         torrent_id: id,
-        files,
+        files: files.into_iter().map(map_file).collect(),
     }]
 }
 
+fn map_file(file: NativeFile) -> revaer_torrent_core::TorrentFile {
+    revaer_torrent_core::TorrentFile {
+        index: file.index,
+        path: file.path,
+        size_bytes: file.size_bytes,
+        bytes_completed: 0,
+        priority: FilePriority::Normal,
+        selected: true,
+    }
+}
+
 const fn map_progress_event(
     id: Uuid,
     bytes_downloaded: u64,
@@ -199,7 +478,6 @@ pub(crate) const fn map_priority(priority: FilePriority) -> u8 {
 #[cfg(test)]
 mod tests {
     use super::*;
-    use crate::ffi::ffi::{NativeEvent, NativeEventKind, NativeTorrentState, NativeTrackerStatus};
     use anyhow::{Result, anyhow};
 
     #[test]
@@ -225,6 +503,11 @@ mod tests {
             source: String::new(),
             private_flag: false,
             has_private: false,
+            pieces_done: 0,
+            pieces_total: 0,
+            file_count: 0,
+            restored: 0,
+            restore_submitted: 0,
         };
 
         let events = map_native_event(None, native);
@@ -268,6 +551,11 @@ mod tests {
             source: String::new(),
             private_flag: false,
             has_private: false,
+            pieces_done: 0,
+            pieces_total: 0,
+            file_count: 0,
+            restored: 0,
+            restore_submitted: 0,
         };
 
         let events = map_native_event(Some(uuid::Uuid::nil()), native);
@@ -310,6 +598,11 @@ mod tests {
             source: String::new(),
             private_flag: false,
             has_private: false,
+            pieces_done: 0,
+            pieces_total: 0,
+            file_count: 0,
+            restored: 0,
+            restore_submitted: 0,
         }
     }
 
@@ -321,7 +614,7 @@ mod tests {
             NativeEventKind::FilesDiscovered,
             NativeTorrentState::Downloading,
         );
-        native.files = vec![crate::ffi::ffi::NativeFile {
+        native.files = vec![NativeFile {
             index: 7,
             path: "season/episode.mkv".to_string(),
             size_bytes: 42,
@@ -341,21 +634,208 @@ mod tests {
         ));
     }
 
-    #[test]
-    fn progress_event_is_mapped() {
-        let torrent_id = uuid::Uuid::new_v4();
+    fn test_files(offset: u32, count: u32) -> Vec<NativeFile> {
+        (offset..offset + count)
+            .map(|index| NativeFile {
+                index,
+                path: format!("disc/{index}.flac"),
+                size_bytes: u64::from(index),
+            })
+            .collect()
+    }
+
+    fn files_announcement(torrent_id: uuid::Uuid, total: u32) -> NativeEventBatch {
         let mut native = test_native_event(
             torrent_id,
-            NativeEventKind::Progress,
+            NativeEventKind::FilesDiscovered,
             NativeTorrentState::Downloading,
         );
-        native.bytes_downloaded = 128;
-        native.bytes_total = 512;
-        native.download_bps = 4096;
-        native.upload_bps = 2048;
-        native.ratio = 1.5;
+        native.file_count = total;
+        NativeEventBatch {
+            bindings: Vec::new(),
+            updates: Vec::new(),
+            events: vec![native],
+        }
+    }
 
-        let progress = map_native_event(Some(torrent_id), native);
+    #[test]
+    fn file_tables_are_assembled_from_pages() -> Result<()> {
+        let torrent_id = uuid::Uuid::new_v4();
+        let mut tables = FileTables::default();
+        let batch = files_announcement(torrent_id, 5);
+        tables.announce(&batch);
+        assert!(map_event_batch(&mut TorrentSlots::default(), batch).is_empty());
+
+        assert_eq!(tables.next_request(), Some((torrent_id, 0)));
+        assert!(
+            tables
+                .complete_page(torrent_id, test_files(0, 3))
+                .is_empty()
+        );
+        assert_eq!(tables.next_request(), Some((torrent_id, 3)));
+        let event = tables
+            .complete_page(torrent_id, test_files(3, 2))
+            .pop()
+            .ok_or_else(|| anyhow!("expected completed file table"))?;
+        assert!(matches!(
+            event,
+            EngineEvent::FilesDiscovered { torrent_id: id, ref files }
+                if id == torrent_id
+                    && files.len() == 5
+                    && files[4].index == 4
+                    && files[4].path == "disc/4.flac"
+                    && files.iter().all(|file| file.selected)
+        ));
+        assert_eq!(tables.next_request(), None);
+        Ok(())
+    }
+
+    #[test]
+    fn file_tables_restart_on_reannouncement_and_drop_on_empty_pages() {
+        let first = uuid::Uuid::new_v4();
+        let second = uuid::Uuid::new_v4();
+        let mut tables = FileTables::default();
+        tables.announce(&files_announcement(first, 4));
+        tables.announce(&files_announcement(second, 2));
+        assert!(tables.complete_page(first, test_files(0, 2)).is_empty());
+
+        tables.announce(&files_announcement(first, 4));
+        assert_eq!(tables.next_request(), Some((second, 0)));
+        assert!(tables.complete_page(second, Vec::new()).is_empty());
+        assert_eq!(tables.next_request(), Some((first, 0)));
+        assert_eq!(tables.complete_page(first, test_files(0, 4)).len(), 1);
+        assert_eq!(tables.next_request(), None);
+    }
+
+    #[test]
+    fn file_tables_retry_failed_pages_then_give_up() {
+        let torrent_id = uuid::Uuid::new_v4();
+        let mut tables = FileTables::default();
+        tables.announce(&files_announcement(torrent_id, 4));
+        assert!(
+            tables
+                .complete_page(torrent_id, test_files(0, 2))
+                .is_empty()
+        );
+
+        assert!(tables.fail_page(torrent_id).is_none());
+        assert_eq!(tables.next_request(), Some((torrent_id, 2)));
+        assert!(
+            tables
+                .complete_page(torrent_id, test_files(2, 1))
+                .is_empty()
+        );
+
+        for _ in 1..MAX_PAGE_FAILURES {
+            assert!(tables.fail_page(torrent_id).is_none());
+        }
+        assert!(tables.fail_page(torrent_id).is_some());
+        assert_eq!(tables.next_request(), None);
+        assert!(tables.fail_page(torrent_id).is_none());
+    }
+
+    #[test]
+    fn file_tables_release_dependent_events_after_files_discovered() -> Result<()> {
+        let torrent_id = uuid::Uuid::new_v4();
+        let other = uuid::Uuid::new_v4();
+        let mut tables = FileTables::default();
+        let mut batch = files_announcement(torrent_id, 3);
+        for (id, kind) in [
+            (torrent_id, NativeEventKind::MetadataUpdated),
+            (torrent_id, NativeEventKind::Error),
+            (other, NativeEventKind::Completed),
+            (torrent_id, NativeEventKind::Completed),
+        ] {
+            batch
+                .events
+                .push(test_native_event(id, kind, NativeTorrentState::Seeding));
+        }
+        tables.announce(&batch);
+        let passed = tables.hold_dependents(map_event_batch(&mut TorrentSlots::default(), batch));
+        assert!(matches!(
+            passed.as_slice(),
+            [
+                EngineEvent::Error { torrent_id: error_id, .. },
+                EngineEvent::Completed { torrent_id: completed_id, .. },
+            ] if *error_id == torrent_id && *completed_id == other
+        ));
+
+        let later = tables.hold_dependents(vec![EngineEvent::FileProgress {
+            torrent_id,
+            files: Vec::new(),
+        }]);
+        assert!(later.is_empty());
+
+        let released = tables.complete_page(torrent_id, test_files(0, 3));
+        assert!(matches!(
+            released.as_slice(),
+            [
+                EngineEvent::FilesDiscovered { torrent_id: files_id, .. },
+                EngineEvent::MetadataUpdated { torrent_id: metadata_id, .. },
+                EngineEvent::Completed { torrent_id: completed_id, .. },
+                EngineEvent::FileProgress { torrent_id: progress_id, .. },
+            ] if [*files_id, *metadata_id, *completed_id, *progress_id] == [torrent_id; 4]
+        ));
+        let after = tables.hold_dependents(vec![EngineEvent::FileProgress {
+            torrent_id,
+            files: Vec::new(),
+        }]);
+        assert_eq!(
+            after.len(),
+            1,
+            "nothing is held once the table is published"
+        );
+        Ok(())
+    }
+
+    fn test_update(slot: u32, position: u32, kind: NativeUpdateKind) -> NativeTorrentUpdate {
+        NativeTorrentUpdate {
+            slot,
+            position,
+            kind,
+            state: NativeTorrentState::Downloading,
+            bytes_downloaded: 0,
+            bytes_total: 0,
+            download_bps: 0,
+            upload_bps: 0,
+            ratio: 0.0,
+            file_index: 0,
+        }
+    }
+
+    fn test_file_update(slot: u32, position: u32, index: u32, done: u64) -> NativeTorrentUpdate {
+        let mut update = test_update(slot, position, NativeUpdateKind::FileProgress);
+        update.file_index = index;
+        update.bytes_downloaded = done;
+        update.bytes_total = 1_024;
+        update
+    }
+
+    fn test_binding(slot: u32, id: uuid::Uuid) -> crate::ffi::ffi::NativeSlotBinding {
+        crate::ffi::ffi::NativeSlotBinding {
+            slot,
+            id: torrent_key(id),
+        }
+    }
+
+    #[test]
+    fn progress_update_is_mapped() {
+        let torrent_id = uuid::Uuid::new_v4();
+        let mut update = test_update(1, 0, NativeUpdateKind::Progress);
+        update.bytes_downloaded = 128;
+        update.bytes_total = 512;
+        update.download_bps = 4096;
+        update.upload_bps = 2048;
+        update.ratio = 1.5;
+
+        let progress = map_event_batch(
+            &mut TorrentSlots::default(),
+            NativeEventBatch {
+                bindings: vec![test_binding(1, torrent_id)],
+                updates: vec![update],
+                events: Vec::new(),
+            },
+        );
         assert!(matches!(
             progress.first(),
             Some(EngineEvent::Progress { torrent_id: id, progress, rates })
@@ -369,20 +849,203 @@ mod tests {
     }
 
     #[test]
-    fn state_changed_event_is_mapped() {
+    fn updates_keep_their_order_around_full_events() {
         let torrent_id = uuid::Uuid::new_v4();
-        let state = map_native_event(
+        let mut slots = TorrentSlots::default();
+        let mut state = test_update(1, 0, NativeUpdateKind::StateChanged);
+        state.state = NativeTorrentState::Completed;
+        let events = map_event_batch(
+            &mut slots,
+            NativeEventBatch {
+                bindings: vec![test_binding(1, torrent_id)],
+                updates: vec![state, test_update(1, 1, NativeUpdateKind::Progress)],
+                events: vec![test_native_event(
+                    torrent_id,
+                    NativeEventKind::Completed,
+                    NativeTorrentState::Completed,
+                )],
+            },
+        );
+        assert_eq!(events.len(), 3);
+        assert!(matches!(
+            events[0],
+            EngineEvent::StateChanged { torrent_id: id, state: EventState::Completed }
+                if id == torrent_id
+        ));
+        assert!(
+            matches!(events[1], EngineEvent::Completed { torrent_id: id, .. } if id == torrent_id)
+        );
+        assert!(
+            matches!(events[2], EngineEvent::Progress { torrent_id: id, .. } if id == torrent_id)
+        );
+    }
+
+    #[test]
+    fn file_updates_are_grouped_per_torrent_in_order() {
+        let first = uuid::Uuid::new_v4();
+        let second = uuid::Uuid::new_v4();
+        let events = map_event_batch(
+            &mut TorrentSlots::default(),
+            NativeEventBatch {
+                bindings: vec![test_binding(1, first), test_binding(2, second)],
+                updates: vec![
+                    test_file_update(1, 0, 0, 512),
+                    test_file_update(1, 0, 4, 1_024),
+                    test_file_update(2, 0, 1, 256),
+                    test_file_update(1, 1, 2, 128),
+                ],
+                events: vec![test_native_event(
+                    first,
+                    NativeEventKind::Completed,
+                    NativeTorrentState::Completed,
+                )],
+            },
+        );
+        assert_eq!(events.len(), 4);
+        assert!(matches!(
+            &events[0],
+            EngineEvent::FileProgress { torrent_id, files }
+                if *torrent_id == first
+                    && files.len() == 2
+                    && !files[0].completed
+                    && files[1].index == 4
+                    && files[1].completed
+        ));
+        assert!(matches!(
+            &events[1],
+            EngineEvent::FileProgress { torrent_id, files }
+                if *torrent_id == second && files.len() == 1 && files[0].bytes_completed == 256
+        ));
+        assert!(matches!(events[2], EngineEvent::Completed { .. }));
+        assert!(matches!(
+            &events[3],
+            EngineEvent::FileProgress { torrent_id, files }
+                if *torrent_id == first && files.len() == 1 && files[0].index == 2
+        ));
+    }
+
+    #[test]
+    fn slots_follow_rebinding_and_drop_unbound_updates() {
+        let first = uuid::Uuid::new_v4();
+        let second = uuid::Uuid::new_v4();
+        let mut slots = TorrentSlots::default();
+        let unbound = map_event_batch(
+            &mut slots,
+            NativeEventBatch {
+                bindings: Vec::new(),
+                updates: vec![test_update(3, 0, NativeUpdateKind::Progress)],
+                events: Vec::new(),
+            },
+        );
+        assert!(unbound.is_empty());
+
+        for (id, expected) in [(first, first), (second, second)] {
+            let events = map_event_batch(
+                &mut slots,
+                NativeEventBatch {
+                    bindings: vec![test_binding(3, id)],
+                    updates: vec![test_update(3, 0, NativeUpdateKind::Progress)],
+                    events: Vec::new(),
+                },
+            );
+            assert!(matches!(
+                events.first(),
+                Some(EngineEvent::Progress { torrent_id, .. }) if *torrent_id == expected
+            ));
+        }
+    }
+
+    #[test]
+    fn authoring_progress_event_is_mapped() {
+        let job_id = uuid::Uuid::new_v4();
+        let mut native = test_native_event(
+            job_id,
+            NativeEventKind::AuthoringProgress,
+            NativeTorrentState::Queued,
+        );
+        native.bytes_downloaded = 32_768;
+        native.bytes_total = 65_536;
+        native.download_bps = 8_192;
+        native.pieces_done = 2;
+        native.pieces_total = 4;
+
+        let progress = map_native_event(Some(job_id), native);
+        assert!(matches!(
+            progress.first(),
+            Some(EngineEvent::AuthoringProgress { progress })
+                if progress.job_id == job_id
+                    && progress.bytes_hashed == 32_768
+                    && progress.bytes_total == 65_536
+                    && progress.bytes_per_second == 8_192
+                    && progress.pieces_done == 2
+                    && progress.pieces_total == 4
+        ));
+
+        let finished = map_native_event(
+            Some(job_id),
+            test_native_event(
+                job_id,
+                NativeEventKind::AuthoringFinished,
+                NativeTorrentState::Queued,
+            ),
+        );
+        assert!(matches!(
+            finished.first(),
+            Some(EngineEvent::AuthoringFinished { job_id: id }) if *id == job_id
+        ));
+    }
+
+    #[test]
+    fn verify_events_are_mapped() {
+        let torrent_id = uuid::Uuid::new_v4();
+        let mut native = test_native_event(
+            torrent_id,
+            NativeEventKind::VerifyProgress,
+            NativeTorrentState::Queued,
+        );
+        native.pieces_done = 3;
+        native.pieces_total = 8;
+        let progress = map_native_event(Some(torrent_id), native);
+        assert!(matches!(
+            progress.first(),
+            Some(EngineEvent::VerifyProgress {
+                torrent_id: id,
+                pieces_done: 3,
+                pieces_total: 8,
+            }) if *id == torrent_id
+        ));
+
+        let admitted = map_native_event(
             Some(torrent_id),
             test_native_event(
                 torrent_id,
-                NativeEventKind::StateChanged,
-                NativeTorrentState::Completed,
+                NativeEventKind::VerifyAdmitted,
+                NativeTorrentState::Queued,
             ),
         );
         assert!(matches!(
-            state.first(),
-            Some(EngineEvent::StateChanged { torrent_id: id, state: EventState::Completed })
-                if *id == torrent_id
+            admitted.first(),
+            Some(EngineEvent::VerifyAdmitted { torrent_id: id }) if *id == torrent_id
+        ));
+    }
+
+    #[test]
+    fn restore_finished_event_reports_failures() {
+        let mut native = test_native_event(
+            uuid::Uuid::nil(),
+            NativeEventKind::RestoreFinished,
+            NativeTorrentState::Queued,
+        );
+        native.restored = 7;
+        native.restore_submitted = 9;
+
+        let finished = map_native_event(None, native);
+        assert!(matches!(
+            finished.first(),
+            Some(EngineEvent::RestoreFinished {
+                restored: 7,
+                failed: 2
+            })
         ));
     }
 
@@ -500,6 +1163,11 @@ mod tests {
                 source: String::new(),
                 private_flag: false,
                 has_private: false,
+                pieces_done: 0,
+                pieces_total: 0,
+                file_count: 0,
+                restored: 0,
+                restore_submitted: 0,
             },
         );
         assert!(unsupported.is_empty());
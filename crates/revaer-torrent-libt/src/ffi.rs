@@ -2,6 +2,9 @@
 
 /// Raw bindings to the libtorrent session exposed via CXX.
 pub mod bridge;
+/// Test-only bindings to the reference metainfo rewriter.
+#[cfg(test)]
+pub mod oracle;
 
 /// Errors returned when constructing FFI session handles.
 #[derive(Debug)]
@@ -90,11 +93,11 @@ mod tests {
 
         assert_eq!(network, 152, "{sizes}");
         assert_eq!(limits, 104, "{sizes}");
-        assert_eq!(storage, 88, "{sizes}");
+        assert_eq!(storage, 128, "{sizes}");
         assert_eq!(behavior, 5, "{sizes}");
         assert_eq!(proxy, 128, "{sizes}");
         assert_eq!(tracker, 544, "{sizes}");
-        assert_eq!(options, 944, "{sizes}");
+        assert_eq!(options, 984, "{sizes}");
     }
 
     #[test]
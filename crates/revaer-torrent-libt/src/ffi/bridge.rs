@@ -1,3 +1,6 @@
+use std::sync::Arc;
+use tokio::sync::Notify;
+
 #[cxx::bridge(namespace = "revaer")]
 /// Native bridge types and functions exposed to Rust.
 pub mod ffi {
@@ -160,6 +163,24 @@ pub mod ffi {
         coalesce_writes: bool,
         /// Whether to use the shared disk cache pool.
         use_disk_cache_pool: bool,
+        /// Disk I/O backend (0 = auto, 1 = mmap, 2 = posix).
+        disk_io_backend: u8,
+        /// Disk I/O thread count for threaded backends.
+        aio_threads: i32,
+        /// Whether a disk I/O thread count override was provided.
+        has_aio_threads: bool,
+        /// Piece hashing thread count.
+        hashing_threads: i32,
+        /// Whether a hashing thread count override was provided.
+        has_hashing_threads: bool,
+        /// Interval between resume-data checkpoint rounds in milliseconds.
+        resume_checkpoint_interval_ms: i32,
+        /// Whether a checkpoint interval override was provided.
+        has_resume_checkpoint_interval: bool,
+        /// Maximum resume-data saves outstanding at once.
+        resume_max_inflight_saves: i32,
+        /// Whether an in-flight save cap was provided.
+        has_resume_max_inflight_saves: bool,
     }
 
     /// Snapshot of cache-related storage settings in the native session.
@@ -177,6 +198,73 @@ pub mod ffi {
         disk_write_mode: i32,
         /// Whether piece hashes are verified.
         verify_piece_hashes: bool,
+        /// Disk I/O backend the session was constructed with.
+        disk_io_backend: u8,
+        /// Disk I/O thread count in use.
+        aio_threads: i32,
+        /// Piece hashing thread count in use.
+        hashing_threads: i32,
+    }
+
+    /// Occupancy and memory accounting for the native parsed-metadata cache.
+    #[derive(Debug)]
+    struct EngineMetadataCacheState {
+        /// Distinct info hashes with parsed metadata held.
+        entries: u32,
+        /// Entries used by more than one torrent.
+        shared_entries: u32,
+        /// Entries no torrent uses, kept for re-adds.
+        retained_entries: u32,
+        /// Approximate bytes held by all entries.
+        bytes: u64,
+        /// Approximate bytes held by retained entries.
+        retained_bytes: u64,
+        /// Adds that reused cached metadata instead of parsing.
+        hits: u64,
+        /// Adds that had to parse metainfo.
+        misses: u64,
+    }
+
+    /// Name and kind of one libtorrent session metric.
+    #[derive(Debug)]
+    struct NativeStatsMetric {
+        /// Dotted libtorrent metric name, e.g. `disk.queued_disk_jobs`.
+        name: String,
+        /// Whether the metric is a monotonic counter rather than a gauge.
+        counter: bool,
+    }
+
+    /// Latest sample of the session performance counters.
+    #[derive(Debug)]
+    struct EngineSessionStats {
+        /// Samples received since the session started; zero until the first arrives.
+        sequence: u64,
+        /// Values indexed like `session_stats_metrics`.
+        values: Vec<i64>,
+    }
+
+    /// Latency histogram for one `Session` entry point.
+    #[derive(Debug)]
+    struct NativeCallTiming {
+        /// `Session` method name, e.g. `poll_events`.
+        name: String,
+        /// Calls recorded since the session started.
+        calls: u64,
+        /// Summed wall time of all calls in nanoseconds.
+        total_ns: u64,
+        /// Slowest call in nanoseconds.
+        max_ns: u64,
+        /// Call counts indexed like `EngineTimingState::bucket_bounds_ns`.
+        buckets: Vec<u64>,
+    }
+
+    /// Latency histograms for every `Session` entry point.
+    #[derive(Debug)]
+    struct EngineTimingState {
+        /// Exclusive upper bound of each bucket in nanoseconds; the last is `u64::MAX`.
+        bucket_bounds_ns: Vec<u64>,
+        /// One histogram per entry point, in declaration order.
+        calls: Vec<NativeCallTiming>,
     }
 
     /// Snapshot of peer class configuration applied to the native session.
@@ -353,11 +441,20 @@ pub mod ffi {
         default_peer_classes: Vec<u8>,
     }
 
+    /// Binary torrent identifier: the UUID split into its big-endian halves.
+    #[derive(Debug, Clone, Copy)]
+    struct TorrentKey {
+        /// High 64 bits.
+        hi: u64,
+        /// Low 64 bits.
+        lo: u64,
+    }
+
     /// Request payload for adding a torrent to the native session.
     #[derive(Debug)]
     struct AddTorrentRequest {
         /// Torrent identifier.
-        id: String,
+        id: TorrentKey,
         /// Whether the source is magnet or metainfo.
         source_kind: SourceKind,
         /// Magnet URI when applicable.
@@ -396,6 +493,8 @@ pub mod ffi {
         hash_check_sample_pct: u8,
         /// Flag indicating whether a hash sample was requested.
         has_hash_check_sample: bool,
+        /// Whether every piece should be hashed against on-disk data before adding.
+        pre_verify: bool,
         /// Whether peer exchange is enabled for this torrent.
         pex_enabled: bool,
         /// Flag indicating whether PEX was explicitly overridden.
@@ -434,6 +533,19 @@ pub mod ffi {
         tracker_auth: TrackerAuthOptions,
     }
 
+    /// Stored torrent re-admitted from its fastresume payload during a bulk restore.
+    #[derive(Debug)]
+    struct RestoreTorrentRequest {
+        /// Torrent identifier.
+        id: TorrentKey,
+        /// Fastresume payload previously produced by libtorrent, lent without copying.
+        resume_data: Box<ResumePayload>,
+        /// Download directory recorded alongside the payload.
+        download_dir: String,
+        /// Whether a download directory was recorded.
+        has_download_dir: bool,
+    }
+
     /// Request payload for authoring a new `.torrent` metainfo payload.
     #[derive(Debug)]
     struct CreateTorrentRequest {
@@ -463,6 +575,21 @@ pub mod ffi {
         source: String,
         /// Whether a source label was provided.
         has_source: bool,
+        /// Number of piece hashing threads; zero selects the available parallelism.
+        hash_threads: u32,
+        /// Metainfo format to author.
+        format: AuthorFormat,
+    }
+
+    /// Metainfo formats produced by torrent authoring.
+    #[derive(Debug)]
+    enum AuthorFormat {
+        /// Combined v1 and v2 info dictionaries.
+        Hybrid,
+        /// v1 info dictionary only.
+        V1Only,
+        /// v2 info dictionary only.
+        V2Only,
     }
 
     /// File entry produced during torrent authoring.
@@ -483,6 +610,10 @@ pub mod ffi {
         magnet_uri: String,
         /// Best available info hash string.
         info_hash: String,
+        /// Hex SHA-1 info hash; empty when the metainfo has no v1 section.
+        info_hash_v1: String,
+        /// Hex SHA-256 info hash; empty when the metainfo has no v2 section.
+        info_hash_v2: String,
         /// Effective piece length in bytes.
         piece_length: u32,
         /// Total payload size in bytes.
@@ -510,8 +641,8 @@ pub mod ffi {
     struct LimitRequest {
         /// Whether the limit applies globally.
         apply_globally: bool,
-        /// Torrent identifier (empty when global).
-        id: String,
+        /// Torrent identifier (ignored when applied globally).
+        id: TorrentKey,
         /// Download cap in bytes per second.
         download_bps: i64,
         /// Upload cap in bytes per second.
@@ -522,7 +653,7 @@ pub mod ffi {
     #[derive(Debug)]
     struct MoveTorrentRequest {
         /// Torrent identifier.
-        id: String,
+        id: TorrentKey,
         /// Destination download directory.
         download_dir: String,
     }
@@ -531,7 +662,7 @@ pub mod ffi {
     #[derive(Debug)]
     struct UpdateOptionsRequest {
         /// Torrent identifier.
-        id: String,
+        id: TorrentKey,
         /// Optional per-torrent peer connection limit.
         max_connections: i32,
         /// Whether a per-torrent limit override was supplied.
@@ -570,7 +701,7 @@ pub mod ffi {
     #[derive(Debug)]
     struct UpdateTrackersRequest {
         /// Torrent identifier.
-        id: String,
+        id: TorrentKey,
         /// Trackers to apply.
         trackers: Vec<String>,
         /// Whether to replace existing trackers.
@@ -581,7 +712,7 @@ pub mod ffi {
     #[derive(Debug)]
     struct UpdateWebSeedsRequest {
         /// Torrent identifier.
-        id: String,
+        id: TorrentKey,
         /// Web seeds to apply.
         web_seeds: Vec<String>,
         /// Whether to replace existing web seeds.
@@ -601,7 +732,7 @@ pub mod ffi {
     #[derive(Debug)]
     struct SelectionRules {
         /// Torrent identifier.
-        id: String,
+        id: TorrentKey,
         /// Inclusion globs.
         include: Vec<String>,
         /// Exclusion globs.
@@ -626,7 +757,7 @@ pub mod ffi {
     /// Event envelope emitted by the native session.
     #[derive(Debug)]
     struct NativeEvent {
-        /// Torrent identifier.
+        /// Torrent identifier in hyphenated form (empty for session-wide events).
         id: String,
         /// Event kind.
         kind: NativeEventKind,
@@ -648,7 +779,8 @@ pub mod ffi {
         upload_bps: u64,
         /// Current share ratio.
         ratio: f64,
-        /// File list snapshot.
+        /// File list snapshot; `FilesDiscovered` leaves this empty and pages the table out
+        /// through `list_files` instead.
         files: Vec<NativeFile>,
         /// Serialized resume data.
         resume_data: Vec<u8>,
@@ -666,6 +798,75 @@ pub mod ffi {
         private_flag: bool,
         /// Whether a private flag was captured.
         has_private: bool,
+        /// Pieces hashed so far by an authoring job or pre-verify.
+        pieces_done: u32,
+        /// Total pieces for an authoring job or pre-verify.
+        pieces_total: u32,
+        /// Files in the table announced by `FilesDiscovered`.
+        file_count: u32,
+        /// Torrents admitted by the restore batch reported in `RestoreFinished`.
+        restored: u32,
+        /// Torrents submitted to the restore batch reported in `RestoreFinished`.
+        restore_submitted: u32,
+    }
+
+    /// Numeric progress or state update for a registered torrent.
+    ///
+    /// Sent instead of a full [`NativeEvent`] for the per-poll hot path: no strings, and the
+    /// torrent is named by its slot rather than its UUID.
+    #[derive(Debug)]
+    struct NativeTorrentUpdate {
+        /// Slot bound to the torrent by a [`NativeSlotBinding`].
+        slot: u32,
+        /// Index of the event in [`NativeEventBatch::events`] this update precedes.
+        position: u32,
+        /// Which update this is.
+        kind: NativeUpdateKind,
+        /// Torrent state after the update.
+        state: NativeTorrentState,
+        /// Bytes downloaded so far; verified bytes of the file for `FileProgress`.
+        bytes_downloaded: u64,
+        /// Total bytes expected; the file size for `FileProgress`.
+        bytes_total: u64,
+        /// Current download rate.
+        download_bps: u64,
+        /// Current upload rate.
+        upload_bps: u64,
+        /// Current share ratio.
+        ratio: f64,
+        /// File the update describes, for `FileProgress`.
+        file_index: u32,
+    }
+
+    /// Tag for [`NativeTorrentUpdate`].
+    #[derive(Debug)]
+    enum NativeUpdateKind {
+        /// Byte counters or rates changed.
+        Progress,
+        /// State transition.
+        StateChanged,
+        /// Verified bytes of one file changed.
+        FileProgress,
+    }
+
+    /// Binds a numeric slot to a torrent id; sent once when the session first tracks the torrent.
+    #[derive(Debug)]
+    struct NativeSlotBinding {
+        /// Slot number, reused only after the previous torrent was dropped.
+        slot: u32,
+        /// Torrent identifier.
+        id: TorrentKey,
+    }
+
+    /// Everything one poll produced.
+    #[derive(Debug)]
+    struct NativeEventBatch {
+        /// Slots bound during this poll; apply before reading `updates`.
+        bindings: Vec<NativeSlotBinding>,
+        /// Hot-path progress and state updates.
+        updates: Vec<NativeTorrentUpdate>,
+        /// Remaining events, which keep the full envelope.
+        events: Vec<NativeEvent>,
     }
 
     /// Event kinds surfaced by the native bridge.
@@ -673,10 +874,6 @@ pub mod ffi {
     enum NativeEventKind {
         /// Newly discovered files.
         FilesDiscovered,
-        /// Progress update.
-        Progress,
-        /// State transition.
-        StateChanged,
         /// Completion notification.
         Completed,
         /// Metadata update.
@@ -689,6 +886,16 @@ pub mod ffi {
         TrackerUpdate,
         /// Session-level error not tied to a specific torrent.
         SessionError,
+        /// Hashing progress for a background authoring job.
+        AuthoringProgress,
+        /// Background authoring job finished, failed, or was cancelled.
+        AuthoringFinished,
+        /// Every torrent submitted through `restore_torrents` was admitted or rejected.
+        RestoreFinished,
+        /// Pieces checked so far by a torrent's pre-verify, before it is admitted.
+        VerifyProgress,
+        /// A torrent held back by pre-verify was admitted into the session.
+        VerifyAdmitted,
     }
 
     /// Torrent lifecycle states emitted by libtorrent.
@@ -768,27 +975,48 @@ pub mod ffi {
         /// Add a torrent to the session.
         #[must_use]
         fn add_torrent(self: Pin<&mut Session>, request: &AddTorrentRequest) -> String;
-        /// Create a new `.torrent` metainfo payload.
+        /// Submit several torrents through async adds, returning one error per request
+        /// (empty when submitted); admission results arrive through `poll_events`.
         #[must_use]
-        fn create_torrent(
+        fn add_torrents(self: Pin<&mut Session>, requests: &[AddTorrentRequest]) -> Vec<String>;
+        /// Start authoring on a background hashing thread keyed by `job_id`.
+        #[must_use]
+        fn start_create_torrent(
             self: Pin<&mut Session>,
+            job_id: &str,
             request: &CreateTorrentRequest,
-        ) -> CreateTorrentResult;
+        ) -> String;
+        /// Ask a running authoring job to stop after its current piece.
+        #[must_use]
+        fn cancel_create_torrent(self: Pin<&mut Session>, job_id: &str) -> String;
+        /// Whether an authoring job has stopped hashing; unknown jobs count as finished.
+        #[must_use]
+        fn authoring_finished(self: Pin<&mut Session>, job_id: &str) -> bool;
+        /// Collect the result of a finished authoring job and release it.
+        #[must_use]
+        fn take_create_torrent_result(self: Pin<&mut Session>, job_id: &str)
+        -> CreateTorrentResult;
         /// Remove a torrent and optionally its data.
         #[must_use]
-        fn remove_torrent(self: Pin<&mut Session>, id: &str, with_data: bool) -> String;
+        fn remove_torrent(self: Pin<&mut Session>, id: TorrentKey, with_data: bool) -> String;
         /// Pause a torrent in the session.
         #[must_use]
-        fn pause_torrent(self: Pin<&mut Session>, id: &str) -> String;
+        fn pause_torrent(self: Pin<&mut Session>, id: TorrentKey) -> String;
         /// Resume a paused torrent.
         #[must_use]
-        fn resume_torrent(self: Pin<&mut Session>, id: &str) -> String;
+        fn resume_torrent(self: Pin<&mut Session>, id: TorrentKey) -> String;
         /// Toggle sequential mode for a torrent.
         #[must_use]
-        fn set_sequential(self: Pin<&mut Session>, id: &str, sequential: bool) -> String;
+        fn set_sequential(self: Pin<&mut Session>, id: TorrentKey, sequential: bool) -> String;
         /// Load fast-resume payload for a torrent.
         #[must_use]
-        fn load_fastresume(self: Pin<&mut Session>, id: &str, payload: &[u8]) -> String;
+        fn load_fastresume(self: Pin<&mut Session>, id: TorrentKey, payload: &[u8]) -> String;
+        /// Decode stored torrents in parallel and admit them asynchronously.
+        ///
+        /// Per-torrent failures surface as error events; completion of the whole batch is
+        /// reported once through a `RestoreFinished` event.
+        #[must_use]
+        fn restore_torrents(self: Pin<&mut Session>, requests: &[RestoreTorrentRequest]) -> String;
         /// Apply rate limits to the session or a specific torrent.
         #[must_use]
         fn update_limits(self: Pin<&mut Session>, request: &LimitRequest) -> String;
@@ -809,15 +1037,15 @@ pub mod ffi {
         fn move_torrent(self: Pin<&mut Session>, request: &MoveTorrentRequest) -> String;
         /// Trigger tracker reannounce.
         #[must_use]
-        fn reannounce(self: Pin<&mut Session>, id: &str) -> String;
+        fn reannounce(self: Pin<&mut Session>, id: TorrentKey) -> String;
         /// Recheck on-disk data for a torrent.
         #[must_use]
-        fn recheck(self: Pin<&mut Session>, id: &str) -> String;
+        fn recheck(self: Pin<&mut Session>, id: TorrentKey) -> String;
         /// Set or clear a deadline for a piece.
         #[must_use]
         fn set_piece_deadline(
             self: Pin<&mut Session>,
-            id: &str,
+            id: TorrentKey,
             piece: u32,
             deadline_ms: i32,
             has_deadline: bool,
@@ -825,17 +1053,103 @@ pub mod ffi {
         /// Inspect cache-related storage settings applied to the session.
         #[must_use]
         fn inspect_storage_state(self: &Session) -> EngineStorageState;
+        /// Inspect parsed-metadata cache occupancy and memory accounting.
+        #[must_use]
+        fn inspect_metadata_cache_state(self: &Session) -> EngineMetadataCacheState;
+        /// Names and kinds of the session metrics, ordered like the sampled values.
+        #[must_use]
+        fn session_stats_metrics(self: &Session) -> Vec<NativeStatsMetric>;
+        /// Inspect the latest sample of session performance counters.
+        #[must_use]
+        fn inspect_session_stats(self: &Session) -> EngineSessionStats;
+        /// Inspect per-method latency histograms for the session entry points.
+        #[must_use]
+        fn inspect_timing_state(self: &Session) -> EngineTimingState;
         /// Inspect peer class configuration applied to the session.
         #[must_use]
         fn inspect_peer_class_state(self: &Session) -> EnginePeerClassState;
         /// Inspect applied session settings used by native integration tests.
         #[must_use]
         fn inspect_settings_state(self: &Session) -> EngineSettingsState;
+        /// Request resume data for every dirty torrent, ignoring the checkpoint budget.
+        ///
+        /// Returns the number of saves still outstanding.
+        fn flush_resume_data(self: Pin<&mut Session>) -> u32;
         /// Poll pending events from the session.
         #[must_use]
-        fn poll_events(self: Pin<&mut Session>) -> Vec<NativeEvent>;
+        fn poll_events(self: Pin<&mut Session>) -> NativeEventBatch;
+        /// Retrieve up to `limit` entries of a torrent's file table starting at `offset`.
+        ///
+        /// Returns an empty list once the torrent is gone or its metadata is unknown.
+        #[must_use]
+        fn list_files(
+            self: Pin<&mut Session>,
+            id: TorrentKey,
+            offset: u32,
+            limit: u32,
+        ) -> Vec<NativeFile>;
         /// Retrieve connected peers for a torrent.
         #[must_use]
-        fn list_peers(self: Pin<&mut Session>, id: &str) -> Vec<NativePeerInfo>;
+        fn list_peers(self: Pin<&mut Session>, id: TorrentKey) -> Vec<NativePeerInfo>;
+        /// Register the waker invoked when libtorrent queues new alerts.
+        fn set_alert_waker(self: Pin<&mut Session>, waker: Box<AlertWaker>);
+    }
+
+    extern "Rust" {
+        /// Rust-side signal raised by the native alert notification callback.
+        type AlertWaker;
+        /// Wake the worker; called from libtorrent's network thread.
+        fn wake(self: &AlertWaker);
+        /// Copy a native byte buffer into a Rust vector with a single bulk copy.
+        fn bytes_to_vec(data: &[u8]) -> Vec<u8>;
+        /// Cached fastresume payload shared with the engine worker.
+        type ResumePayload;
+        /// Borrow the payload bytes; safe to call from native decode threads.
+        fn bytes(self: &ResumePayload) -> &[u8];
+    }
+}
+
+/// Bulk-copies native buffers (resume data, authored metainfo) into Rust-owned vectors.
+///
+/// `rust::Vec` only grows one element at a time from C++, crossing the bridge per byte.
+fn bytes_to_vec(data: &[u8]) -> Vec<u8> {
+    data.to_vec()
+}
+
+/// Fastresume payload handed to a bulk restore.
+///
+/// It shares the worker's cached buffer, so native code decodes the stored bytes in place.
+#[derive(Debug)]
+pub struct ResumePayload(Arc<Vec<u8>>);
+
+impl ResumePayload {
+    /// Share `bytes` with the native session.
+    #[must_use]
+    pub const fn new(bytes: Arc<Vec<u8>>) -> Self {
+        Self(bytes)
+    }
+
+    fn bytes(&self) -> &[u8] {
+        &self.0
+    }
+}
+
+/// Wakes the engine worker when the native session queues new alerts.
+///
+/// libtorrent invokes the callback from its own thread, so waking must never block or
+/// call back into the session.
+pub struct AlertWaker {
+    notify: Arc<Notify>,
+}
+
+impl AlertWaker {
+    /// Wrap the notifier awaited by the engine worker.
+    #[must_use]
+    pub const fn new(notify: Arc<Notify>) -> Self {
+        Self { notify }
+    }
+
+    fn wake(&self) {
+        self.notify.notify_one();
     }
 }
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+
+#include <libtorrent/span.hpp>
+
+namespace revaer {
+
+// Metainfo fields an add request may override before the torrent is parsed.
+struct MetainfoOverrides {
+    bool has_comment{false};
+    std::string comment;
+    bool has_source{false};
+    std::string source;
+    bool has_private{false};
+    bool private_flag{false};
+};
+
+// Applies the overrides by splicing the original buffer: only `comment`, `info.private` and
+// `info.source` are re-encoded, and only the info dictionary is decoded. For canonical
+// (key-sorted) metainfo the output matches an entry round trip byte for byte; otherwise
+// untouched keys keep their original encoding. Returns false with `error` set on rejection.
+bool splice_with_overrides(lt::span<const char> buffer,
+                           const MetainfoOverrides& overrides,
+                           std::string& out,
+                           std::string& error);
+
+}  // namespace revaer
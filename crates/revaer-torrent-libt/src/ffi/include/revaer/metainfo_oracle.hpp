@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+#include "rust/cxx.h"
+
+namespace revaer {
+
+struct MetainfoOverrideCase;
+
+::rust::String metainfo_override_parity(rust::Slice<const std::uint8_t> metainfo,
+                                        const MetainfoOverrideCase& overrides);
+
+}  // namespace revaer
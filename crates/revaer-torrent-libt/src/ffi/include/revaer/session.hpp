@@ -12,7 +12,9 @@ namespace revaer {
 
 struct SessionOptions;
 struct EngineOptions;
+struct TorrentKey;
 struct AddTorrentRequest;
+struct RestoreTorrentRequest;
 struct CreateTorrentRequest;
 struct CreateTorrentResult;
 struct LimitRequest;
@@ -22,11 +24,18 @@ struct UpdateWebSeedsRequest;
 struct MoveTorrentRequest;
 struct SelectionRules;
 struct NativeEvent;
+struct NativeEventBatch;
 struct EngineStorageState;
+struct EngineMetadataCacheState;
+struct EngineSessionStats;
+struct EngineTimingState;
+struct NativeStatsMetric;
 struct EnginePeerClassState;
 struct EngineSettingsState;
+struct NativeFile;
 struct NativePeerInfo;
 struct NativePeerInfo;
+struct AlertWaker;
 
 class Session {
 public:
@@ -35,26 +44,38 @@ public:
 
     ::rust::String apply_engine_profile(const EngineOptions& options);
     ::rust::String add_torrent(const AddTorrentRequest& request);
-    CreateTorrentResult create_torrent(const CreateTorrentRequest& request);
-    ::rust::String remove_torrent(::rust::Str id, bool with_data);
-    ::rust::String pause_torrent(::rust::Str id);
-    ::rust::String resume_torrent(::rust::Str id);
-    ::rust::String set_sequential(::rust::Str id, bool sequential);
-    ::rust::String load_fastresume(::rust::Str id, rust::Slice<const std::uint8_t> data);
+    rust::Vec<::rust::String> add_torrents(rust::Slice<const AddTorrentRequest> requests);
+    ::rust::String start_create_torrent(::rust::Str job_id, const CreateTorrentRequest& request);
+    ::rust::String cancel_create_torrent(::rust::Str job_id);
+    bool authoring_finished(::rust::Str job_id);
+    CreateTorrentResult take_create_torrent_result(::rust::Str job_id);
+    ::rust::String remove_torrent(TorrentKey id, bool with_data);
+    ::rust::String pause_torrent(TorrentKey id);
+    ::rust::String resume_torrent(TorrentKey id);
+    ::rust::String set_sequential(TorrentKey id, bool sequential);
+    ::rust::String load_fastresume(TorrentKey id, rust::Slice<const std::uint8_t> data);
+    ::rust::String restore_torrents(rust::Slice<const RestoreTorrentRequest> requests);
     ::rust::String update_limits(const LimitRequest& request);
     ::rust::String update_selection(const SelectionRules& request);
     ::rust::String update_options(const UpdateOptionsRequest& request);
     ::rust::String update_trackers(const UpdateTrackersRequest& request);
     ::rust::String update_web_seeds(const UpdateWebSeedsRequest& request);
     ::rust::String move_torrent(const MoveTorrentRequest& request);
-    ::rust::String reannounce(::rust::Str id);
-    ::rust::String recheck(::rust::Str id);
-    ::rust::String set_piece_deadline(::rust::Str id, std::uint32_t piece, std::int32_t deadline_ms, bool has_deadline);
+    ::rust::String reannounce(TorrentKey id);
+    ::rust::String recheck(TorrentKey id);
+    ::rust::String set_piece_deadline(TorrentKey id, std::uint32_t piece, std::int32_t deadline_ms, bool has_deadline);
+    [[nodiscard]] EngineMetadataCacheState inspect_metadata_cache_state() const;
+    [[nodiscard]] rust::Vec<NativeStatsMetric> session_stats_metrics() const;
+    [[nodiscard]] EngineSessionStats inspect_session_stats() const;
+    [[nodiscard]] EngineTimingState inspect_timing_state() const;
     [[nodiscard]] EngineStorageState inspect_storage_state() const;
     [[nodiscard]] EnginePeerClassState inspect_peer_class_state() const;
     [[nodiscard]] EngineSettingsState inspect_settings_state() const;
-    rust::Vec<NativePeerInfo> list_peers(::rust::Str id);
-    rust::Vec<NativeEvent> poll_events();
+    rust::Vec<NativeFile> list_files(TorrentKey id, std::uint32_t offset, std::uint32_t limit);
+    rust::Vec<NativePeerInfo> list_peers(TorrentKey id);
+    std::uint32_t flush_resume_data();
+    NativeEventBatch poll_events();
+    void set_alert_waker(::rust::Box<AlertWaker> waker);
 
 private:
     class Impl;
@@ -0,0 +1,211 @@
+#include "revaer/metainfo.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <libtorrent/bdecode.hpp>
+#include <libtorrent/error_code.hpp>
+
+namespace revaer {
+
+namespace {
+
+// Returns the offset just past the bencoded value starting at `pos`, or npos if the buffer
+// ends first. Iterative so hostile nesting cannot exhaust the stack.
+std::size_t skip_bencoded(std::string_view buffer, std::size_t pos) {
+    std::size_t depth = 0;
+    do {
+        if (pos >= buffer.size()) {
+            return std::string_view::npos;
+        }
+        const char token = buffer[pos];
+        if (token == 'd' || token == 'l') {
+            ++depth;
+            ++pos;
+        } else if (token == 'e') {
+            if (depth == 0) {
+                return std::string_view::npos;
+            }
+            --depth;
+            ++pos;
+        } else if (token == 'i') {
+            const auto end = buffer.find('e', pos);
+            if (end == std::string_view::npos) {
+                return end;
+            }
+            pos = end + 1;
+        } else {
+            const auto colon = buffer.find(':', pos);
+            if (colon == std::string_view::npos || colon == pos) {
+                return std::string_view::npos;
+            }
+            std::size_t length = 0;
+            for (std::size_t digit = pos; digit < colon; ++digit) {
+                const char ch = buffer[digit];
+                if (ch < '0' || ch > '9' || length > buffer.size()) {
+                    return std::string_view::npos;
+                }
+                length = length * 10 + static_cast<std::size_t>(ch - '0');
+            }
+            if (length > buffer.size() - colon - 1) {
+                return std::string_view::npos;
+            }
+            pos = colon + 1 + length;
+        }
+    } while (depth > 0);
+    return pos;
+}
+
+// One key rewrite within a dictionary: replace the value, or drop the key when `remove`.
+struct DictEdit {
+    std::string_view key;
+    bool remove{false};
+    std::string value;
+};
+
+void append_bencoded_string(std::string& out, std::string_view value) {
+    out += std::to_string(value.size());
+    out += ':';
+    out.append(value.data(), value.size());
+}
+
+void append_dict_edit(std::string& out, const DictEdit& edit) {
+    append_bencoded_string(out, edit.key);
+    out += edit.value;
+}
+
+// Copies the dictionary at `begin` into `out`, applying `edits` (sorted by key). Untouched
+// entries are copied as raw spans, so large values such as `pieces` are never re-encoded.
+// Missing keys are inserted in sorted position. When `nested_key` holds a dictionary,
+// `nested` is invoked with its span to emit it instead of a raw copy, and `nested_found` is set.
+template <typename Nested>
+bool splice_dict(std::string_view buffer,
+                 std::size_t begin,
+                 const std::vector<DictEdit>& edits,
+                 std::string_view nested_key,
+                 Nested&& nested,
+                 std::string& out,
+                 bool& nested_found,
+                 std::size_t& end) {
+    if (begin >= buffer.size() || buffer[begin] != 'd') {
+        return false;
+    }
+    out += 'd';
+    std::size_t pos = begin + 1;
+    std::size_t next_edit = 0;
+    while (pos < buffer.size() && buffer[pos] != 'e') {
+        if (buffer[pos] < '0' || buffer[pos] > '9') {
+            return false;
+        }
+        const auto colon = buffer.find(':', pos);
+        const auto value_begin = skip_bencoded(buffer, pos);
+        if (colon == std::string_view::npos || value_begin == std::string_view::npos) {
+            return false;
+        }
+        const auto key = buffer.substr(colon + 1, value_begin - colon - 1);
+        const auto value_end = skip_bencoded(buffer, value_begin);
+        if (value_end == std::string_view::npos) {
+            return false;
+        }
+        while (next_edit < edits.size() && edits[next_edit].key < key) {
+            if (!edits[next_edit].remove) {
+                append_dict_edit(out, edits[next_edit]);
+            }
+            ++next_edit;
+        }
+        if (next_edit < edits.size() && edits[next_edit].key == key) {
+            if (!edits[next_edit].remove) {
+                append_dict_edit(out, edits[next_edit]);
+            }
+            ++next_edit;
+        } else if (!nested_key.empty() && key == nested_key && buffer[value_begin] == 'd') {
+            out.append(buffer.data() + pos, value_begin - pos);
+            if (!nested(value_begin, value_end)) {
+                return false;
+            }
+            nested_found = true;
+        } else {
+            out.append(buffer.data() + pos, value_end - pos);
+        }
+        pos = value_end;
+    }
+    if (pos >= buffer.size()) {
+        return false;
+    }
+    for (; next_edit < edits.size(); ++next_edit) {
+        if (!edits[next_edit].remove) {
+            append_dict_edit(out, edits[next_edit]);
+        }
+    }
+    out += 'e';
+    end = pos + 1;
+    return true;
+}
+
+}  // namespace
+
+bool splice_with_overrides(lt::span<const char> buffer,
+                           const MetainfoOverrides& overrides,
+                           std::string& out,
+                           std::string& error) {
+    const std::string_view view(buffer.data(), static_cast<std::size_t>(buffer.size()));
+    if (view.empty() || view.front() != 'd') {
+        error = "metainfo root must be a dictionary";
+        return false;
+    }
+
+    std::vector<DictEdit> root_edits;
+    if (overrides.has_comment) {
+        DictEdit edit{"comment", overrides.comment.empty(), {}};
+        append_bencoded_string(edit.value, overrides.comment);
+        root_edits.push_back(std::move(edit));
+    }
+    // Keys are listed in sorted order: "private" < "source".
+    std::vector<DictEdit> info_edits;
+    if (overrides.has_private) {
+        info_edits.push_back(DictEdit{"private", !overrides.private_flag, "i1e"});
+    }
+    if (overrides.has_source) {
+        DictEdit edit{"source", overrides.source.empty(), {}};
+        append_bencoded_string(edit.value, overrides.source);
+        info_edits.push_back(std::move(edit));
+    }
+
+    std::string& spliced = out;
+    spliced.clear();
+    spliced.reserve(view.size() + overrides.comment.size() + overrides.source.size() + 32);
+    const auto splice_info = [&](std::size_t info_begin, std::size_t info_end) {
+        // Only the info dictionary is decoded, bounded to its own span. Root keys are
+        // framed by the scanner and copied without building a node tree.
+        lt::error_code decode_ec;
+        lt::bdecode_node info;
+        const int decode_result =
+            lt::bdecode(view.data() + info_begin, view.data() + info_end, info, decode_ec);
+        if (decode_result != 0 || decode_ec) {
+            error = "metainfo decode failed: " + decode_ec.message();
+            return false;
+        }
+        bool unused_nested = false;
+        std::size_t unused_end = 0;
+        return splice_dict(
+            view, info_begin, info_edits, {}, [](std::size_t, std::size_t) { return false; },
+            spliced, unused_nested, unused_end);
+    };
+    bool info_found = false;
+    std::size_t root_end = 0;
+    if (!splice_dict(view, 0, root_edits, "info", splice_info, spliced, info_found, root_end)) {
+        if (error.empty()) {
+            error = "metainfo decode failed: malformed bencoding";
+        }
+        return false;
+    }
+    if (!info_found) {
+        error = "metainfo is missing an info dictionary";
+        return false;
+    }
+    return true;
+}
+
+}  // namespace revaer
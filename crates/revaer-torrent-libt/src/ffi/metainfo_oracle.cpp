@@ -0,0 +1,129 @@
+// Test-only reference for the metainfo splice rewriter. Nothing in the production bridge
+// calls into this file; it is linked only by the crate's tests.
+
+#include "revaer/metainfo_oracle.hpp"
+#include "revaer/metainfo.hpp"
+
+#include "revaer-torrent-libt/src/ffi/oracle.rs.h"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <libtorrent/bdecode.hpp>
+#include <libtorrent/bencode.hpp>
+#include <libtorrent/entry.hpp>
+#include <libtorrent/error_code.hpp>
+
+namespace revaer {
+
+namespace {
+
+// Reference implementation of the overrides: a full bdecode -> entry -> bencode round trip.
+bool reencode_with_overrides(lt::span<const char> buffer,
+                             const MetainfoOverrides& overrides,
+                             std::vector<char>& out,
+                             std::string& error) {
+    lt::error_code decode_ec;
+    lt::bdecode_node decoded;
+    const int decode_result =
+        lt::bdecode(buffer.data(), buffer.data() + buffer.size(), decoded, decode_ec);
+    if (decode_result != 0 || decode_ec) {
+        error = "metainfo decode failed: " + decode_ec.message();
+        return false;
+    }
+    lt::entry metainfo(decoded);
+    if (metainfo.type() != lt::entry::dictionary_t) {
+        error = "metainfo root must be a dictionary";
+        return false;
+    }
+    auto& root = metainfo.dict();
+    auto info_it = root.find("info");
+    if (info_it == root.end() || info_it->second.type() != lt::entry::dictionary_t) {
+        error = "metainfo is missing an info dictionary";
+        return false;
+    }
+    auto& info = info_it->second.dict();
+
+    if (overrides.has_private) {
+        if (overrides.private_flag) {
+            info["private"] = 1;
+        } else {
+            info.erase("private");
+        }
+    }
+    if (overrides.has_comment) {
+        if (!overrides.comment.empty()) {
+            root["comment"] = overrides.comment;
+        } else {
+            root.erase("comment");
+        }
+    }
+    if (overrides.has_source) {
+        if (!overrides.source.empty()) {
+            info["source"] = overrides.source;
+        } else {
+            info.erase("source");
+        }
+    }
+
+    out.clear();
+    lt::bencode(std::back_inserter(out), metainfo);
+    return true;
+}
+
+MetainfoOverrides to_overrides(const MetainfoOverrideCase& request) {
+    MetainfoOverrides overrides{};
+    overrides.has_comment = request.has_comment;
+    if (request.has_comment) {
+        overrides.comment = std::string(request.comment);
+    }
+    overrides.has_source = request.has_source;
+    if (request.has_source) {
+        overrides.source = std::string(request.source);
+    }
+    overrides.has_private = request.has_private;
+    overrides.private_flag = request.has_private && request.private_flag;
+    return overrides;
+}
+
+}  // namespace
+
+::rust::String metainfo_override_parity(rust::Slice<const std::uint8_t> metainfo,
+                                        const MetainfoOverrideCase& request) {
+    try {
+        const auto overrides = to_overrides(request);
+        const lt::span<const char> buffer(
+            reinterpret_cast<const char*>(metainfo.data()), static_cast<long>(metainfo.size()));
+        std::vector<char> expected;
+        std::string expected_error;
+        const bool expected_ok = reencode_with_overrides(buffer, overrides, expected, expected_error);
+        std::string actual;
+        std::string actual_error;
+        const bool actual_ok = splice_with_overrides(buffer, overrides, actual, actual_error);
+        if (expected_ok != actual_ok || expected_error != actual_error) {
+            return ::rust::String(
+                "error mismatch: round trip '" + expected_error + "', splice '" + actual_error
+                + "'");
+        }
+        if (!expected_ok) {
+            return ::rust::String();
+        }
+        const auto mismatch = std::mismatch(
+            expected.begin(), expected.end(), actual.begin(), actual.end());
+        if (mismatch.first != expected.end() || mismatch.second != actual.end()) {
+            return ::rust::String(
+                "output differs at byte "
+                + std::to_string(std::distance(expected.begin(), mismatch.first))
+                + " (round trip " + std::to_string(expected.size()) + " bytes, splice "
+                + std::to_string(actual.size()) + " bytes)");
+        }
+    } catch (const std::exception& ex) {
+        return ::rust::String(ex.what());
+    }
+    return ::rust::String();
+}
+
+}  // namespace revaer
@@ -0,0 +1,34 @@
+//! Test-only bridge to the reference metainfo rewriter.
+//!
+//! The C++ side lives in `metainfo_oracle.cpp`, which no production code references, so the
+//! entry round trip it carries never reaches a shipped binary.
+
+#[cxx::bridge(namespace = "revaer")]
+/// Bindings used by the splice rewriter's parity tests.
+pub mod ffi {
+    /// Metainfo overrides applied by both rewriters.
+    #[derive(Debug, Default)]
+    struct MetainfoOverrideCase {
+        /// Comment override; empty removes the key.
+        comment: String,
+        /// Whether the comment override applies.
+        has_comment: bool,
+        /// Source override; empty removes the key.
+        source: String,
+        /// Whether the source override applies.
+        has_source: bool,
+        /// Private flag override.
+        private_flag: bool,
+        /// Whether the private flag override applies.
+        has_private: bool,
+    }
+
+    unsafe extern "C++" {
+        include!("revaer/metainfo_oracle.hpp");
+
+        /// Apply the overrides through both the splice rewriter and a full entry round
+        /// trip; returns the first difference, or an empty string when they agree.
+        #[must_use]
+        fn metainfo_override_parity(metainfo: &[u8], overrides: &MetainfoOverrideCase) -> String;
+    }
+}
@@ -1,22 +1,31 @@
 #include "revaer/session.hpp"
+#include "revaer/metainfo.hpp"
 
 #include "revaer-torrent-libt/src/ffi/bridge.rs.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <cstring>
+#include <deque>
+#include <exception>
 #include <sstream>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <iomanip>
-#include <regex>
+#include <string_view>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <unordered_set>
 #include <set>
 #include <utility>
@@ -29,6 +38,7 @@
 #include <libtorrent/alert_types.hpp>
 #include <libtorrent/bdecode.hpp>
 #include <libtorrent/bencode.hpp>
+#include <libtorrent/bitfield.hpp>
 #include <libtorrent/create_torrent.hpp>
 #include <libtorrent/download_priority.hpp>
 #include <libtorrent/error_code.hpp>
@@ -39,12 +49,16 @@
 #include <libtorrent/peer_class_type_filter.hpp>
 #include <libtorrent/socket_type.hpp>
 #include <libtorrent/file_storage.hpp>
+#include <libtorrent/hasher.hpp>
 #include <libtorrent/info_hash.hpp>
 #include <libtorrent/magnet_uri.hpp>
+#include <libtorrent/mmap_disk_io.hpp>
 #include <libtorrent/peer_info.hpp>
+#include <libtorrent/posix_disk_io.hpp>
 #include <libtorrent/read_resume_data.hpp>
 #include <libtorrent/session.hpp>
 #include <libtorrent/session_params.hpp>
+#include <libtorrent/session_stats.hpp>
 #include <libtorrent/settings_pack.hpp>
 #include <libtorrent/session_types.hpp>
 #include <libtorrent/storage_defs.hpp>
@@ -55,6 +69,11 @@
 #include <libtorrent/write_resume_data.hpp>
 #include <openssl/evp.h>
 
+#if defined(__linux__)
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#endif
+
 namespace revaer {
 
 namespace {
@@ -68,6 +87,38 @@ constexpr std::array<const char*, 5> kSkipFluffPatterns = {
 };
 constexpr const char* kInvalidHandleMessage = "invalid torrent handle used";
 constexpr std::size_t kMaxCreatePathLength = 4096;
+constexpr lt::status_flags_t kStatusQueryFlags =
+    lt::torrent_handle::query_name | lt::torrent_handle::query_save_path |
+    lt::torrent_handle::query_pieces | lt::torrent_handle::query_torrent_file;
+// Status batches follow the worker's 200 ms poll. The spacing check allows a little slack
+// so tick jitter never skips a batch.
+constexpr std::chrono::milliseconds kStatusUpdateInterval{200};
+constexpr std::chrono::milliseconds kStatusUpdateSlack{20};
+constexpr std::chrono::milliseconds kSessionStatsInterval{5000};
+// An unanswered post_file_progress is given up after this, so a lost alert cannot stop
+// per-file updates for good.
+constexpr std::chrono::milliseconds kFileProgressTimeout{5000};
+constexpr std::chrono::milliseconds kDefaultResumeCheckpointInterval{30000};
+constexpr int kDefaultResumeMaxInflightSaves = 8;
+constexpr std::uint32_t kMaxHashThreads = 64;
+constexpr const char* kAuthoringCancelled = "torrent authoring cancelled";
+constexpr std::size_t kMinSamplePiecesPerThread = 4;
+// BEP 52 merkle leaf size.
+constexpr std::int64_t kV2BlockSize = 16 * 1024;
+constexpr std::size_t kRotationalVerifyThreads = 1;
+constexpr std::size_t kMinRestoresPerThread = 16;
+constexpr std::uint8_t kDiskIoAuto = 0;
+constexpr std::uint8_t kDiskIoMmap = 1;
+constexpr std::uint8_t kDiskIoPosix = 2;
+// Unused parsed metadata kept for re-adds, evicted oldest first beyond this many bytes.
+constexpr std::size_t kMetadataRetainBudget = 32 * 1024 * 1024;
+// Call latency buckets: everything under 2^kTimingMinShift ns lands in bucket 0, then each
+// power of two up to 2^(kTimingMinShift + kTimingOctaves) ns is split into 2^kTimingSubBucketBits
+// linear sub-buckets. The last bucket also absorbs anything slower.
+constexpr std::size_t kTimingMinShift = 10;
+constexpr std::size_t kTimingSubBucketBits = 2;
+constexpr std::size_t kTimingOctaves = 26;
+constexpr std::size_t kTimingBucketCount = 1 + (kTimingOctaves << kTimingSubBucketBits);
 
 std::string to_std_string(::rust::Str value) {
     return std::string(value.data(), value.length());
@@ -77,40 +128,169 @@ std::string to_std_string(const ::rust::String& value) {
     return static_cast<std::string>(value);
 }
 
-std::string glob_to_regex(const std::string& pattern) {
-    std::string regex;
-    regex.reserve(pattern.size() * 2);
-    regex.push_back('^');
-    for (char ch : pattern) {
-        switch (ch) {
-            case '*':
-                regex.append(".*");
-                break;
-            case '?':
-                regex.push_back('.');
-                break;
-            case '.':
-            case '^':
-            case '$':
-            case '|':
-            case '(':
-            case ')':
-            case '[':
-            case ']':
-            case '{':
-            case '}':
-            case '+':
-            case '\\':
-                regex.push_back('\\');
-                regex.push_back(ch);
-                break;
-            default:
-                regex.push_back(ch);
-                break;
+// Case-insensitive glob patterns compiled once into a single NFA. `**/` matches zero or more
+// whole directories, any other `*` matches any run of characters including `/`, `?` matches
+// exactly one, and everything else is literal. `matches` walks a path once, advancing the
+// live states of every pattern together.
+class GlobSet {
+public:
+    void add(std::string_view pattern) {
+        starts_.push_back(static_cast<std::uint32_t>(tokens_.size()));
+        for (std::size_t pos = 0; pos < pattern.size(); ++pos) {
+            const char ch = pattern[pos];
+            if (pattern.compare(pos, 3, "**/") == 0) {
+                tokens_.push_back(Token{Op::Dirs, '\0'});
+                tokens_.push_back(Token{Op::DirChars, '\0'});
+                pos += 2;
+            } else if (ch == '*') {
+                if (tokens_.size() == starts_.back() || tokens_.back().op != Op::Star) {
+                    tokens_.push_back(Token{Op::Star, '\0'});
+                }
+            } else if (ch == '?') {
+                tokens_.push_back(Token{Op::Any, '\0'});
+            } else {
+                tokens_.push_back(Token{Op::Literal, fold(ch)});
+            }
+        }
+        tokens_.push_back(Token{Op::Accept, '\0'});
+    }
+
+    [[nodiscard]] bool empty() const { return starts_.empty(); }
+
+    [[nodiscard]] bool matches(std::string_view path) const {
+        if (starts_.empty()) {
+            return false;
+        }
+        // Scratch space is per thread so the shared fluff set can be used by authoring jobs.
+        thread_local Scratch scratch;
+        scratch.reset(tokens_.size());
+        for (std::uint32_t start : starts_) {
+            enter(scratch, scratch.current, start);
+        }
+
+        for (char raw : path) {
+            const char ch = fold(raw);
+            scratch.advance();
+            for (std::uint32_t state : scratch.current) {
+                const Token& token = tokens_[state];
+                switch (token.op) {
+                    case Op::Literal:
+                        if (token.ch == ch) {
+                            enter(scratch, scratch.next, state + 1);
+                        }
+                        break;
+                    case Op::Any:
+                        enter(scratch, scratch.next, state + 1);
+                        break;
+                    case Op::Star:
+                        enter(scratch, scratch.next, state);
+                        break;
+                    case Op::DirChars:
+                        // Stays inside the directory run, which only ends after a `/`.
+                        enter(scratch, scratch.next, state);
+                        if (ch == '/') {
+                            enter(scratch, scratch.next, state + 1);
+                        }
+                        break;
+                    case Op::Dirs:
+                    case Op::Accept:
+                        break;
+                }
+            }
+            scratch.current.swap(scratch.next);
+            if (scratch.current.empty()) {
+                return false;
+            }
+        }
+
+        return std::any_of(scratch.current.begin(), scratch.current.end(),
+                           [this](std::uint32_t state) {
+                               return tokens_[state].op == Op::Accept;
+                           });
+    }
+
+private:
+    // `**/` compiles to `Dirs`, which either skips the run or enters it, followed by the
+    // `DirChars` loop that consumes it.
+    enum class Op : std::uint8_t { Literal, Any, Star, Dirs, DirChars, Accept };
+
+    struct Token {
+        Op op;
+        char ch;
+    };
+
+    // Live state lists plus a generation stamp per state, so de-duplicating a step never
+    // has to clear a per-state array.
+    struct Scratch {
+        std::vector<std::uint32_t> current;
+        std::vector<std::uint32_t> next;
+        std::vector<std::uint32_t> stamps;
+        std::uint32_t generation{0};
+
+        void reset(std::size_t states) {
+            current.clear();
+            if (stamps.size() < states) {
+                stamps.resize(states, 0);
+            }
+            bump();
+        }
+
+        void advance() {
+            next.clear();
+            bump();
+        }
+
+        void bump() {
+            if (++generation == 0) {
+                std::fill(stamps.begin(), stamps.end(), 0);
+                generation = 1;
+            }
+        }
+    };
+
+    static char fold(char ch) {
+        return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+    }
+
+    // Adds `state` to `list`, following the empty transition past a star or a directory run.
+    void enter(Scratch& scratch, std::vector<std::uint32_t>& list, std::uint32_t state) const {
+        if (scratch.stamps[state] == scratch.generation) {
+            return;
         }
+        scratch.stamps[state] = scratch.generation;
+        list.push_back(state);
+        if (tokens_[state].op == Op::Star || tokens_[state].op == Op::Dirs) {
+            enter(scratch, list, state + 1);
+        }
+        if (tokens_[state].op == Op::Dirs) {
+            enter(scratch, list, state + 2);
+        }
+    }
+
+    std::vector<Token> tokens_;
+    std::vector<std::uint32_t> starts_;
+};
+
+GlobSet compile_globs(const rust::Vec<rust::String>& patterns) {
+    GlobSet globs;
+    for (const auto& pattern : patterns) {
+        globs.add(std::string_view(pattern.data(), pattern.size()));
     }
-    regex.push_back('$');
-    return regex;
+    return globs;
+}
+
+// Hands a native buffer to Rust as one bulk copy instead of per-byte `push_back` calls.
+rust::Vec<std::uint8_t> to_rust_bytes(const std::vector<char>& buffer) {
+    return bytes_to_vec(rust::Slice<const std::uint8_t>(
+        reinterpret_cast<const std::uint8_t*>(buffer.data()), buffer.size()));
+}
+
+int resolve_hash_threads(std::uint32_t requested) {
+    std::uint32_t threads = requested;
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    return static_cast<int>(std::min(threads, kMaxHashThreads));
 }
 
 std::vector<int> pick_sample_pieces(int total_pieces, int sample_count) {
@@ -152,14 +332,35 @@ lt::storage_mode_t to_storage_mode(int mode) {
     return lt::storage_mode_sparse;
 }
 
-struct MetainfoOverrides {
-    bool has_comment{false};
-    std::string comment;
-    bool has_source{false};
-    std::string source;
-    bool has_private{false};
-    bool private_flag{false};
-};
+// Backend a request will actually get: mmap falls back to posix where libtorrent was built
+// without memory-mapped file support, and unknown values mean auto.
+std::uint8_t resolve_disk_io_backend(std::uint8_t requested) {
+    switch (requested) {
+    case kDiskIoMmap:
+#if TORRENT_HAVE_MMAP || TORRENT_HAVE_MAP_VIEW_OF_FILE
+        return kDiskIoMmap;
+#else
+        return kDiskIoPosix;
+#endif
+    case kDiskIoPosix:
+        return kDiskIoPosix;
+    default:
+        return kDiskIoAuto;
+    }
+}
+
+lt::disk_io_constructor_type disk_io_constructor(std::uint8_t backend) {
+    switch (backend) {
+#if TORRENT_HAVE_MMAP || TORRENT_HAVE_MAP_VIEW_OF_FILE
+    case kDiskIoMmap:
+        return lt::mmap_disk_io_constructor;
+#endif
+    case kDiskIoPosix:
+        return lt::posix_disk_io_constructor;
+    default:
+        return lt::default_disk_io_constructor;
+    }
+}
 
 struct MetainfoDetails {
     std::string comment;
@@ -206,44 +407,467 @@ MetainfoDetails extract_metainfo_details(const lt::torrent_info& info) {
     return details;
 }
 
-bool apply_metainfo_overrides(lt::entry& metainfo,
-                              const MetainfoOverrides& overrides,
-                              std::string& error) {
-    if (metainfo.type() != lt::entry::dictionary_t) {
-        error = "metainfo root must be a dictionary";
-        return false;
+// Metadata derived once when a torrent's info dictionary becomes known. It never changes
+// afterwards, so events and selection read it instead of re-querying the torrent_info.
+struct TorrentMetadata {
+    MetainfoDetails details;
+    std::vector<std::string> file_paths;
+    std::vector<std::uint64_t> file_sizes;
+};
+
+std::shared_ptr<const TorrentMetadata> build_torrent_metadata(const lt::torrent_info& info) {
+    auto metadata = std::make_shared<TorrentMetadata>();
+    metadata->details = extract_metainfo_details(info);
+    const auto& files = info.files();
+    metadata->file_paths.reserve(static_cast<std::size_t>(files.num_files()));
+    metadata->file_sizes.reserve(static_cast<std::size_t>(files.num_files()));
+    for (lt::file_index_t idx : files.file_range()) {
+        metadata->file_paths.push_back(files.file_path(idx));
+        metadata->file_sizes.push_back(static_cast<std::uint64_t>(files.file_size(idx)));
     }
-    auto& root = metainfo.dict();
-    auto info_it = root.find("info");
-    if (info_it == root.end() || info_it->second.type() != lt::entry::dictionary_t) {
-        error = "metainfo is missing an info dictionary";
-        return false;
+    return metadata;
+}
+
+// Approximate bytes held by the derived metadata of one cache entry.
+std::size_t metadata_bytes(const TorrentMetadata& metadata) {
+    std::size_t bytes = metadata.details.comment.size() + metadata.details.source.size()
+        + metadata.file_sizes.size() * (sizeof(std::string) + sizeof(std::uint64_t));
+    for (const auto& path : metadata.file_paths) {
+        bytes += path.size();
     }
-    auto& info = info_it->second.dict();
+    return bytes;
+}
 
-    if (overrides.has_private) {
-        if (overrides.private_flag) {
-            info["private"] = 1;
-        } else {
-            info.erase("private");
+// Approximate bytes held by an owned torrent_info: the info section it keeps.
+std::size_t info_bytes(const lt::torrent_info& info) {
+    return static_cast<std::size_t>(std::max(info.metadata_size(), 0));
+}
+
+// Torrent UUIDs are random, so folding the halves spreads keys evenly across buckets.
+struct TorrentKeyHash {
+    std::size_t operator()(const TorrentKey& key) const noexcept {
+        return static_cast<std::size_t>(key.hi ^ (key.lo * 0x9e3779b97f4a7c15ULL));
+    }
+};
+
+struct TorrentKeyEqual {
+    bool operator()(const TorrentKey& left, const TorrentKey& right) const noexcept {
+        return left.hi == right.hi && left.lo == right.lo;
+    }
+};
+
+template <typename Value>
+using TorrentKeyMap = std::unordered_map<TorrentKey, Value, TorrentKeyHash, TorrentKeyEqual>;
+using TorrentKeySet = std::unordered_set<TorrentKey, TorrentKeyHash, TorrentKeyEqual>;
+
+// Hyphenated lowercase form of a torrent key, as carried by events.
+std::string format_torrent_key(const TorrentKey& key) {
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+    std::string out;
+    out.reserve(36);
+    for (int idx = 0; idx < 32; ++idx) {
+        if (idx == 8 || idx == 12 || idx == 16 || idx == 20) {
+            out.push_back('-');
         }
+        const std::uint64_t half = idx < 16 ? key.hi : key.lo;
+        out.push_back(kHexDigits[(half >> (60 - 4 * (idx % 16))) & 0xF]);
     }
-    if (overrides.has_comment) {
-        if (!overrides.comment.empty()) {
-            root["comment"] = overrides.comment;
-        } else {
-            root.erase("comment");
+    return out;
+}
+
+// Parsed metadata keyed by info hash, shared by every torrent with that hash. Details are
+// derived once per entry instead of on each event. While a torrent uses an entry, only the
+// derived metadata and a weak reference to libtorrent's torrent_info are held. When the
+// last torrent releases it, the info is copied and retained within kMetadataRetainBudget so
+// re-adding the same metainfo skips the parse; reuse() hands that copy back to libtorrent
+// rather than copying again, so at most one torrent_info per hash is resident.
+class MetadataCache {
+public:
+    struct Entry {
+        // Owned copy, held only while no torrent uses the entry; moved out by reuse().
+        std::shared_ptr<lt::torrent_info> retained_info;
+        // Object the entry was built from or last handed out. Tracked by ownership so
+        // acquiring it again keeps the derived metadata, and copied on the last release.
+        std::weak_ptr<const lt::torrent_info> source;
+        std::shared_ptr<const TorrentMetadata> metadata;
+        // Derived metadata plus the retained copy, if any.
+        std::size_t bytes{0};
+        TorrentKeySet owners;
+        lt::sha1_hash digest;
+        std::uint64_t retained_seq{0};
+    };
+
+    // The retained torrent_info for a metainfo buffer seen before, or null. Ownership moves
+    // to the caller, which hands it to libtorrent; entries still in use report a miss.
+    std::shared_ptr<lt::torrent_info> reuse(const lt::sha1_hash& digest) {
+        const auto indexed = by_digest_.find(digest);
+        if (indexed != by_digest_.end()) {
+            const auto entry = entries_.find(indexed->second);
+            if (entry != entries_.end() && entry->second.retained_info) {
+                ++hits_;
+                auto info = std::move(entry->second.retained_info);
+                // Same content, so acquiring the object keeps metadata and digest.
+                entry->second.source = info;
+                set_bytes(entry->second, metadata_bytes(*entry->second.metadata));
+                return info;
+            }
+            // A reused copy whose add never completed leaves only metadata behind.
+            if (entry != entries_.end() && entry->second.owners.empty()
+                && entry->second.source.expired()) {
+                erase(entry);
+            }
         }
+        ++misses_;
+        return nullptr;
     }
-    if (overrides.has_source) {
-        if (!overrides.source.empty()) {
-            info["source"] = overrides.source;
-        } else {
-            info.erase("source");
+
+    // Records freshly parsed metadata for `digest` without assigning an owner yet.
+    // A live torrent's entry is left alone: libtorrent rejects the duplicate hash anyway.
+    void remember(const lt::sha1_hash& digest, const std::shared_ptr<const lt::torrent_info>& info) {
+        const auto key = info->info_hashes().get_best();
+        const auto existing = entries_.find(key);
+        if (existing != entries_.end() && !existing->second.owners.empty()) {
+            return;
+        }
+        auto& entry = upsert(info);
+        entry.digest = digest;
+        by_digest_[digest] = key;
+        if (entry.retained_seq == 0) {
+            retain(key, entry);
         }
     }
 
-    return true;
+    // Marks `id` as using `info`. An object the entry was not built from replaces it.
+    const Entry& acquire(const TorrentKey& id, const std::shared_ptr<const lt::torrent_info>& info) {
+        const auto key = info->info_hashes().get_best();
+        const auto current = by_id_.find(id);
+        if (current != by_id_.end() && current->second != key) {
+            release(id);
+        }
+        auto& entry = upsert(info);
+        if (entry.retained_seq != 0) {
+            retained_bytes_ -= entry.bytes;
+            entry.retained_seq = 0;
+        }
+        if (entry.retained_info) {
+            entry.retained_info.reset();
+            set_bytes(entry, metadata_bytes(*entry.metadata));
+        }
+        entry.owners.insert(id);
+        by_id_[id] = key;
+        return entry;
+    }
+
+    const Entry* find(const TorrentKey& id) const {
+        const auto key = by_id_.find(id);
+        if (key == by_id_.end()) {
+            return nullptr;
+        }
+        const auto entry = entries_.find(key->second);
+        return entry == entries_.end() ? nullptr : &entry->second;
+    }
+
+    void release(const TorrentKey& id) {
+        const auto key = by_id_.find(id);
+        if (key == by_id_.end()) {
+            return;
+        }
+        const auto entry = entries_.find(key->second);
+        by_id_.erase(key);
+        if (entry == entries_.end()) {
+            return;
+        }
+        entry->second.owners.erase(id);
+        if (!entry->second.owners.empty()) {
+            return;
+        }
+        // The torrent is going away; copy its info now, while libtorrent still holds it.
+        // Without one the entry could never be reused, so it is dropped.
+        const auto live = entry->second.source.lock();
+        if (!live) {
+            erase(entry);
+            return;
+        }
+        entry->second.retained_info = std::make_shared<lt::torrent_info>(*live);
+        entry->second.source = entry->second.retained_info;
+        set_bytes(entry->second,
+                  metadata_bytes(*entry->second.metadata)
+                      + info_bytes(*entry->second.retained_info));
+        retain(entry->first, entry->second);
+    }
+
+    EngineMetadataCacheState state() const {
+        EngineMetadataCacheState state{};
+        state.entries = static_cast<std::uint32_t>(entries_.size());
+        state.bytes = static_cast<std::uint64_t>(bytes_);
+        state.retained_bytes = static_cast<std::uint64_t>(retained_bytes_);
+        state.hits = hits_;
+        state.misses = misses_;
+        for (const auto& entry : entries_) {
+            if (entry.second.owners.size() > 1) {
+                ++state.shared_entries;
+            }
+            if (entry.second.owners.empty()) {
+                ++state.retained_entries;
+            }
+        }
+        return state;
+    }
+
+private:
+    static bool same_object(const std::weak_ptr<const lt::torrent_info>& tracked,
+                            const std::shared_ptr<const lt::torrent_info>& info) {
+        return !tracked.owner_before(info) && !info.owner_before(tracked);
+    }
+
+    // Rebuilds the entry's metadata from `info` without copying it. A different object may
+    // carry different top-level fields (comment, trackers) for the same info hash, so the
+    // metadata is rebuilt, any retained copy dropped, and the old object's digest forgotten.
+    Entry& upsert(const std::shared_ptr<const lt::torrent_info>& info) {
+        auto& entry = entries_[info->info_hashes().get_best()];
+        if (entry.metadata && same_object(entry.source, info)) {
+            return entry;
+        }
+        if (!entry.digest.is_all_zeros()) {
+            by_digest_.erase(entry.digest);
+            entry.digest.clear();
+        }
+        entry.source = info;
+        entry.retained_info.reset();
+        entry.metadata = build_torrent_metadata(*info);
+        set_bytes(entry, metadata_bytes(*entry.metadata));
+        return entry;
+    }
+
+    // Updates an entry's accounted size, keeping the cache and retained totals in step.
+    void set_bytes(Entry& entry, std::size_t bytes) {
+        bytes_ = bytes_ - entry.bytes + bytes;
+        if (entry.retained_seq != 0) {
+            retained_bytes_ = retained_bytes_ - entry.bytes + bytes;
+        }
+        entry.bytes = bytes;
+    }
+
+    void erase(std::unordered_map<lt::sha1_hash, Entry>::iterator entry) {
+        if (entry->second.retained_seq != 0) {
+            retained_bytes_ -= entry->second.bytes;
+        }
+        bytes_ -= entry->second.bytes;
+        if (!entry->second.digest.is_all_zeros()) {
+            by_digest_.erase(entry->second.digest);
+        }
+        entries_.erase(entry);
+    }
+
+    void retain(const lt::sha1_hash& key, Entry& entry) {
+        entry.retained_seq = ++retain_seq_;
+        retained_bytes_ += entry.bytes;
+        retained_.emplace_back(key, entry.retained_seq);
+        while (retained_bytes_ > kMetadataRetainBudget && !retained_.empty()) {
+            const auto [oldest, seq] = retained_.front();
+            retained_.pop_front();
+            const auto evicted = entries_.find(oldest);
+            // Entries re-acquired or retained again since were queued under another sequence.
+            if (evicted == entries_.end() || evicted->second.retained_seq != seq) {
+                continue;
+            }
+            erase(evicted);
+        }
+    }
+
+    std::unordered_map<lt::sha1_hash, Entry> entries_;
+    TorrentKeyMap<lt::sha1_hash> by_id_;
+    std::unordered_map<lt::sha1_hash, lt::sha1_hash> by_digest_;
+    std::deque<std::pair<lt::sha1_hash, std::uint64_t>> retained_;
+    std::uint64_t retain_seq_{0};
+    std::size_t bytes_{0};
+    std::size_t retained_bytes_{0};
+    std::uint64_t hits_{0};
+    std::uint64_t misses_{0};
+};
+
+bool has_metainfo_overrides(const MetainfoOverrides& overrides) {
+    return overrides.has_comment || overrides.has_source || overrides.has_private;
+}
+
+// Reads whole pieces of a payload into one reused buffer. Files stay open across pieces
+// and pad-file slices read as zeros.
+class PieceReader {
+public:
+    PieceReader(const lt::file_storage& files, const std::filesystem::path& root)
+        : files_(files),
+          root_(root),
+          buffer_(static_cast<std::size_t>(files.piece_length())) {}
+
+    // Reads `piece` and returns what went wrong, if anything. The bytes stay valid until the
+    // next read.
+    std::optional<std::string> read(int piece) {
+        const lt::piece_index_t index{piece};
+        const int piece_size = files_.piece_size(index);
+        filled_ = 0;
+        for (const auto& slice : files_.map_block(index, 0, piece_size)) {
+            const auto length = static_cast<std::size_t>(slice.size);
+            char* target = buffer_.data() + filled_;
+            if (files_.pad_file_at(slice.file_index)) {
+                std::fill_n(target, length, '\0');
+            } else {
+                std::ifstream* file = open(slice.file_index);
+                if (file == nullptr) {
+                    return "missing file " + path_for(slice.file_index).string();
+                }
+                file->seekg(static_cast<std::streamoff>(slice.offset), std::ios::beg);
+                file->read(target, static_cast<std::streamsize>(length));
+                if (file->gcount() != static_cast<std::streamsize>(length)) {
+                    return "truncated file " + path_for(slice.file_index).string();
+                }
+            }
+            filled_ += length;
+        }
+        return std::nullopt;
+    }
+
+    const char* data() const {
+        return buffer_.data();
+    }
+
+    std::size_t size() const {
+        return filled_;
+    }
+
+private:
+    std::filesystem::path path_for(lt::file_index_t index) const {
+        return root_ / files_.file_path(index);
+    }
+
+    std::ifstream* open(lt::file_index_t index) {
+        const int key = static_cast<int>(index);
+        auto it = streams_.find(key);
+        if (it == streams_.end()) {
+            auto stream = std::make_unique<std::ifstream>();
+            // Reads land directly in buffer_; the stream's own buffer would only add a copy.
+            stream->rdbuf()->pubsetbuf(nullptr, 0);
+            stream->open(path_for(index), std::ios::binary);
+            if (!*stream) {
+                return nullptr;
+            }
+            it = streams_.emplace(key, std::move(stream)).first;
+        }
+        it->second->clear();
+        return it->second.get();
+    }
+
+    const lt::file_storage& files_;
+    std::filesystem::path root_;
+    std::vector<char> buffer_;
+    std::size_t filled_{0};
+    std::unordered_map<int, std::unique_ptr<std::ifstream>> streams_;
+};
+
+// Hashes sampled pieces for one thread. The reader and digest context are allocated once,
+// so the per-piece cost is reads plus one digest.
+class PieceSampler {
+public:
+    PieceSampler(const lt::torrent_info& info, const std::filesystem::path& root)
+        : info_(info),
+          reader_(info.files(), root),
+          sha_ctx_(EVP_MD_CTX_new(), &EVP_MD_CTX_free) {}
+
+    std::optional<std::string> check(int piece) {
+        if (!sha_ctx_) {
+            return std::string("seed-mode sample failed: unable to allocate sha1 ctx");
+        }
+        if (EVP_DigestInit_ex(sha_ctx_.get(), EVP_sha1(), nullptr) != 1) {
+            return std::string("seed-mode sample failed: unable to init sha1 digest");
+        }
+        if (auto error = reader_.read(piece)) {
+            return "seed-mode sample failed: " + *error;
+        }
+
+        if (EVP_DigestUpdate(sha_ctx_.get(),
+                             reinterpret_cast<const unsigned char*>(reader_.data()),
+                             reader_.size()) != 1) {
+            return std::string("seed-mode sample failed: digest update error for piece ")
+                + std::to_string(piece);
+        }
+        std::array<unsigned char, lt::sha1_hash::size()> digest{};
+        unsigned int digest_len = 0;
+        if (EVP_DigestFinal_ex(sha_ctx_.get(), digest.data(), &digest_len) != 1) {
+            return std::string("seed-mode sample failed: unable to finalize digest");
+        }
+        if (digest_len != lt::sha1_hash::size()) {
+            return std::string("seed-mode sample failed: digest length mismatch");
+        }
+
+        const auto expected = info_.hash_for_piece(lt::piece_index_t{piece});
+        if (std::memcmp(expected.data(), digest.data(), lt::sha1_hash::size()) != 0) {
+            return std::string("seed-mode sample failed: hash mismatch for piece ")
+                + std::to_string(piece);
+        }
+        return std::nullopt;
+    }
+
+private:
+    const lt::torrent_info& info_;
+    PieceReader reader_;
+    std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> sha_ctx_;
+};
+
+// Splits `count` work items into contiguous ranges across `workers` threads, each with its
+// own state from `make_state()`. `fn(state, worker, idx)` returning false stops every worker
+// early; the first exception thrown by any worker is rethrown once all threads have joined.
+template <typename MakeState, typename Fn>
+void run_piece_workers(std::size_t count, std::size_t workers, MakeState&& make_state, Fn&& fn) {
+    if (count == 0) {
+        return;
+    }
+    workers = std::max<std::size_t>(1, std::min(workers, count));
+    const std::size_t chunk = (count + workers - 1) / workers;
+    std::vector<std::exception_ptr> failures(workers);
+    std::atomic<bool> stop{false};
+
+    const auto run = [&](std::size_t worker) {
+        try {
+            auto state = make_state();
+            const std::size_t begin = worker * chunk;
+            const std::size_t end = std::min(begin + chunk, count);
+            for (std::size_t idx = begin; idx < end; ++idx) {
+                if (stop.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                if (!fn(state, worker, idx)) {
+                    stop.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        } catch (...) {
+            failures[worker] = std::current_exception();
+            stop.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    try {
+        for (std::size_t worker = 1; worker < workers; ++worker) {
+            threads.emplace_back(run, worker);
+        }
+    } catch (...) {
+        stop.store(true, std::memory_order_relaxed);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+    run(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
 }
 
 std::optional<std::string> hash_sample(
@@ -258,68 +882,204 @@ std::optional<std::string> hash_sample(
     if (total_pieces <= 0) {
         return std::nullopt;
     }
+    if (!info.v1()) {
+        return std::string("seed-mode sample failed: metainfo has no v1 piece hashes");
+    }
 
     const auto sample_count = std::max(
         1,
         static_cast<int>(std::ceil(
             static_cast<double>(total_pieces) * static_cast<double>(sample_pct) / 100.0)));
-    const auto pieces = pick_sample_pieces(total_pieces, sample_count);
-    const auto& files = info.files();
+    auto pieces = pick_sample_pieces(total_pieces, sample_count);
+    // Ascending order keeps each thread's reads moving forward through the payload.
+    std::sort(pieces.begin(), pieces.end());
     const std::filesystem::path root(save_path);
 
-    for (int piece : pieces) {
-        const int piece_size = info.piece_size(piece);
-        std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> sha_ctx(
-            EVP_MD_CTX_new(),
-            &EVP_MD_CTX_free);
-        if (!sha_ctx) {
-            return std::string("seed-mode sample failed: unable to allocate sha1 ctx");
+    const std::size_t workers = std::min<std::size_t>(
+        static_cast<std::size_t>(resolve_hash_threads(0)),
+        std::max<std::size_t>(1, pieces.size() / kMinSamplePiecesPerThread));
+    std::vector<std::optional<std::string>> errors(workers);
+
+    try {
+        run_piece_workers(
+            pieces.size(), workers, [&] { return PieceSampler(info, root); },
+            [&](PieceSampler& sampler, std::size_t worker, std::size_t idx) {
+                if (auto error = sampler.check(pieces[idx])) {
+                    errors[worker] = std::move(error);
+                    return false;
+                }
+                return true;
+            });
+    } catch (const std::exception& ex) {
+        return std::string("seed-mode sample failed: ") + ex.what();
+    }
+
+    for (auto& error : errors) {
+        if (error) {
+            return error;
         }
-        if (EVP_DigestInit_ex(sha_ctx.get(), EVP_sha1(), nullptr) != 1) {
-            return std::string("seed-mode sample failed: unable to init sha1 digest");
+    }
+    return std::nullopt;
+}
+
+// Picks the pre-verify thread count for the device backing `save_path`. Rotational disks
+// get a single reader because concurrent seeks cost more than the extra hashing buys.
+std::size_t verify_parallelism(const std::string& save_path) {
+    const auto threads = static_cast<std::size_t>(resolve_hash_threads(0));
+#if defined(__linux__)
+    struct stat info {};
+    if (::stat(save_path.c_str(), &info) != 0) {
+        return threads;
+    }
+    const std::string device = "/sys/dev/block/" + std::to_string(major(info.st_dev)) + ":"
+        + std::to_string(minor(info.st_dev));
+    // Partitions expose the queue attributes on their parent device.
+    constexpr std::array<const char*, 2> kRotationalPaths = {
+        "/queue/rotational",
+        "/../queue/rotational",
+    };
+    for (const char* suffix : kRotationalPaths) {
+        std::ifstream rotational(device + suffix);
+        char flag = '\0';
+        if (rotational >> flag) {
+            return flag == '1' ? kRotationalVerifyThreads : threads;
         }
-        const auto slices = files.map_block(piece, 0, piece_size);
-        for (const auto& slice : slices) {
-            const auto path = root / files.file_path(slice.file_index);
-            std::ifstream file(path, std::ios::binary);
-            if (!file) {
-                return std::string("seed-mode sample failed: missing file ")
-                    + path.string();
-            }
-            file.seekg(static_cast<std::streamoff>(slice.offset), std::ios::beg);
-            std::vector<char> buffer;
-            buffer.resize(static_cast<std::size_t>(slice.size));
-            file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
-            if (file.gcount() != static_cast<std::streamsize>(buffer.size())) {
-                return std::string("seed-mode sample failed: truncated file ")
-                    + path.string();
-            }
-            if (EVP_DigestUpdate(
-                    sha_ctx.get(),
-                    reinterpret_cast<const unsigned char*>(buffer.data()),
-                    buffer.size()) != 1) {
-                return std::string("seed-mode sample failed: digest update error for file ")
-                    + path.string();
-            }
+    }
+#endif
+    return threads;
+}
+
+// Identifies the device backing `save_path`, probing the nearest existing ancestor when the
+// directory has not been created yet. Unknown devices share id 0.
+std::uint64_t storage_device(const std::string& save_path) {
+#if defined(__linux__)
+    std::filesystem::path probe(save_path);
+    while (!probe.empty()) {
+        struct stat info {};
+        if (::stat(probe.c_str(), &info) == 0) {
+            return static_cast<std::uint64_t>(info.st_dev);
+        }
+        if (probe == probe.parent_path()) {
+            break;
         }
+        probe = probe.parent_path();
+    }
+#endif
+    return 0;
+}
 
-        std::array<unsigned char, lt::sha1_hash::size()> digest{};
-        unsigned int digest_len = 0;
-        if (EVP_DigestFinal_ex(sha_ctx.get(), digest.data(), &digest_len) != 1) {
-            return std::string("seed-mode sample failed: unable to finalize digest");
+// Hashes every piece of existing data under `save_path` and returns the pieces that match.
+// Missing, truncated, or mismatched pieces are simply left unset for libtorrent to fetch.
+// Workers stop between pieces once `cancel` is set, and count each checked piece in `done`.
+lt::typed_bitfield<lt::piece_index_t> verify_all_pieces(
+    const lt::torrent_info& info,
+    const std::string& save_path,
+    const std::atomic<bool>& cancel,
+    std::atomic<std::uint32_t>& done) {
+    const int total_pieces = info.num_pieces();
+    lt::typed_bitfield<lt::piece_index_t> verified(total_pieces, false);
+    if (total_pieces <= 0 || !info.v1()) {
+        return verified;
+    }
+
+    const auto pieces = static_cast<std::size_t>(total_pieces);
+    const std::size_t workers = std::min(
+        verify_parallelism(save_path),
+        std::max<std::size_t>(1, pieces / kMinSamplePiecesPerThread));
+    // One byte per piece so workers never share a bitfield word.
+    std::vector<char> matched(pieces, 0);
+    const std::filesystem::path root(save_path);
+    run_piece_workers(
+        pieces, workers, [&] { return PieceSampler(info, root); },
+        [&](PieceSampler& sampler, std::size_t, std::size_t idx) {
+            if (cancel.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            matched[idx] = sampler.check(static_cast<int>(idx)).has_value() ? 0 : 1;
+            done.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        });
+
+    for (std::size_t idx = 0; idx < pieces; ++idx) {
+        if (matched[idx] != 0) {
+            verified.set_bit(lt::piece_index_t(static_cast<int>(idx)));
         }
-        if (digest_len != lt::sha1_hash::size()) {
-            return std::string("seed-mode sample failed: digest length mismatch");
+    }
+    return verified;
+}
+
+struct DecodedResume {
+    lt::add_torrent_params params;
+    std::string error;
+};
+
+// Decodes stored resume blobs on a small pool. Blobs that embed metainfo build their
+// torrent_info here, which dominates cold-start cost. Items are claimed one at a time
+// because their sizes vary widely.
+std::vector<DecodedResume> decode_resume_batch(
+    rust::Slice<const RestoreTorrentRequest> requests) {
+    std::vector<DecodedResume> decoded(requests.size());
+    std::atomic<std::size_t> next{0};
+    const auto run = [&]() {
+        for (std::size_t idx = next.fetch_add(1, std::memory_order_relaxed);
+             idx < requests.size();
+             idx = next.fetch_add(1, std::memory_order_relaxed)) {
+            auto& slot = decoded[idx];
+            try {
+                const auto data = requests[idx].resume_data->bytes();
+                lt::error_code resume_ec;
+                slot.params = lt::read_resume_data(
+                    lt::span<const char>(reinterpret_cast<const char*>(data.data()),
+                                         static_cast<long>(data.size())),
+                    resume_ec);
+                if (resume_ec) {
+                    slot.error = "resume data parse failed: " + resume_ec.message();
+                }
+            } catch (const std::exception& ex) {
+                slot.error = ex.what();
+            }
         }
+    };
 
-        const auto expected = info.hash_for_piece(piece);
-        if (std::memcmp(expected.data(), digest.data(), lt::sha1_hash::size()) != 0) {
-            return std::string("seed-mode sample failed: hash mismatch for piece ")
-                + std::to_string(piece);
+    const std::size_t workers = std::min<std::size_t>(
+        static_cast<std::size_t>(resolve_hash_threads(0)),
+        (requests.size() + kMinRestoresPerThread - 1) / kMinRestoresPerThread);
+    std::vector<std::thread> threads;
+    if (workers > 1) {
+        threads.reserve(workers - 1);
+    }
+    try {
+        for (std::size_t worker = 1; worker < workers; ++worker) {
+            threads.emplace_back(run);
         }
+    } catch (const std::system_error&) {
+        // Fewer threads only slow the batch down; this thread drains whatever is left.
     }
+    run();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return decoded;
+}
 
-    return std::nullopt;
+// Address of the torrent object behind `handle`: stable for the torrent's lifetime and
+// null once libtorrent has released it.
+const void* torrent_identity(const lt::torrent_handle& handle) {
+    return handle.native_handle().get();
+}
+
+// Matches an async_add_torrent submission to the add_torrent_alert that answers it.
+lt::sha1_hash async_add_key(const lt::add_torrent_params& params) {
+    return params.ti ? params.ti->info_hashes().get_best() : params.info_hashes.get_best();
+}
+
+NativeEvent add_error_event(const TorrentKey& id, const std::string& message) {
+    NativeEvent evt{};
+    evt.id = format_torrent_key(id);
+    evt.kind = NativeEventKind::Error;
+    evt.state = NativeTorrentState::Failed;
+    evt.message = message;
+    return evt;
 }
 
 NativeTorrentState map_state(lt::torrent_status::state_t state) {
@@ -354,24 +1114,453 @@ lt::download_priority_t to_priority(std::uint8_t value) {
     }
 }
 
-struct SelectionEntry {
-    std::vector<std::regex> include;
-    std::vector<std::regex> exclude;
-    std::vector<FilePriorityOverride> overrides;
-    bool skip_fluff{false};
-};
+struct SelectionEntry {
+    GlobSet include;
+    GlobSet exclude;
+    std::vector<FilePriorityOverride> overrides;
+    bool skip_fluff{false};
+};
+
+struct TorrentSnapshot {
+    NativeTorrentState state{NativeTorrentState::Queued};
+    std::uint64_t bytes_downloaded{0};
+    std::uint64_t bytes_total{0};
+    bool metadata_applied{false};
+    bool metadata_emitted{false};
+    bool completed_emitted{false};
+    bool resume_requested{false};
+    // libtorrent reported unsaved resume state; cleared once a save is requested.
+    bool resume_dirty{false};
+    std::uint64_t resume_saved_bytes{0};
+    std::string last_name;
+    std::string last_download_dir;
+    // Memoized once the info dictionary is known; shared with the metadata cache.
+    std::shared_ptr<const TorrentMetadata> metadata;
+    // Verified bytes per file as last reported through FileProgress updates.
+    std::vector<std::int64_t> file_progress;
+    // A post_file_progress request is outstanding; cleared by its file_progress_alert, after
+    // kFileProgressTimeout, or with the snapshot when the torrent is removed.
+    bool file_progress_posted{false};
+    std::chrono::steady_clock::time_point file_progress_deadline{};
+};
+
+// A torrent submitted through async_add_torrent, waiting for its add_torrent_alert.
+struct PendingAdd {
+    TorrentKey id{};
+    int queue_position{-1};
+    bool restore{false};
+    // Set for adds held back by a payload check, whose admission is reported explicitly.
+    bool verified{false};
+};
+
+// A change to an admitted torrent, held back while its admission is still pending.
+using HandleUpdate = std::function<void(lt::torrent_handle&)>;
+
+// Bulk restore in progress; it finishes once none of its submissions is pending.
+struct RestoreBatch {
+    bool active{false};
+    std::uint32_t submitted{0};
+    std::uint32_t restored{0};
+    std::uint32_t pending{0};
+};
+
+// Per-slot values that only a few rows ever hold, kept out of the dense columns so empty rows
+// pay nothing for them.
+template <typename Value>
+class SparseColumn {
+public:
+    Value* find(std::uint32_t slot) {
+        const auto it = values_.find(slot);
+        return it == values_.end() ? nullptr : &it->second;
+    }
+
+    bool contains(std::uint32_t slot) const {
+        return values_.count(slot) != 0;
+    }
+
+    Value& assign(std::uint32_t slot, Value value) {
+        return values_.insert_or_assign(slot, std::move(value)).first->second;
+    }
+
+    void erase(std::uint32_t slot) {
+        values_.erase(slot);
+    }
+
+private:
+    std::unordered_map<std::uint32_t, Value> values_;
+};
+
+// Torrents known to the session, stored column-wise and addressed by a dense slot that also
+// keys compact updates. A row lives while it holds a handle, pending resume data, selection
+// rules or a pending admission; `snapshots` is meaningful only while `handles` is set. Slot 0
+// is never assigned, so its zero key doubles as "no torrent".
+class TorrentTable {
+public:
+    TorrentTable() {
+        grow();
+    }
+
+    std::uint32_t find(const TorrentKey& key) const {
+        const auto it = slots_.find(key);
+        return it == slots_.end() ? 0 : it->second;
+    }
+
+    // Slot for `key`, assigning one on first use and queueing its binding for the next poll.
+    std::uint32_t acquire(const TorrentKey& key) {
+        if (const auto existing = find(key); existing != 0) {
+            return existing;
+        }
+        std::uint32_t slot = 0;
+        if (free_.empty()) {
+            slot = static_cast<std::uint32_t>(keys.size());
+            grow();
+        } else {
+            slot = free_.back();
+            free_.pop_back();
+        }
+        keys[slot] = key;
+        slots_.emplace(key, slot);
+        NativeSlotBinding binding{};
+        binding.slot = slot;
+        binding.id = key;
+        bindings_.push_back(binding);
+        return slot;
+    }
+
+    std::uint32_t end() const {
+        return static_cast<std::uint32_t>(keys.size());
+    }
+
+    bool loaded(std::uint32_t slot) const {
+        return slot != 0 && handles[slot].has_value();
+    }
+
+    // Drops the handle and snapshot, then the row itself once nothing else refers to it.
+    void unload(std::uint32_t slot) {
+        handles[slot].reset();
+        identities[slot] = nullptr;
+        snapshots[slot] = TorrentSnapshot{};
+        release_if_unused(slot);
+    }
+
+    // Frees the row once it holds nothing. Freed slots are reused only after the current
+    // poll, so every binding in a batch precedes any update naming the slot's new owner.
+    void release_if_unused(std::uint32_t slot) {
+        if (slot == 0 || handles[slot] || pending_resume.contains(slot)
+            || selection_rules.contains(slot) || pending_updates.contains(slot)) {
+            return;
+        }
+        slots_.erase(keys[slot]);
+        keys[slot] = TorrentKey{};
+        retired_.push_back(slot);
+    }
+
+    // Hands queued bindings to the poll and makes slots freed since the last poll reusable.
+    void finish_poll(rust::Vec<NativeSlotBinding>& bindings) {
+        bindings.reserve(bindings_.size());
+        for (const auto& binding : bindings_) {
+            bindings.push_back(binding);
+        }
+        bindings_.clear();
+        free_.insert(free_.end(), retired_.begin(), retired_.end());
+        retired_.clear();
+    }
+
+    // Hyphenated id for the events that carry string ids, formatted on demand.
+    std::string id(std::uint32_t slot) const {
+        return format_torrent_key(keys[slot]);
+    }
+
+    std::vector<TorrentKey> keys;
+    std::vector<std::optional<lt::torrent_handle>> handles;
+    // Torrent object behind `handles`, captured at registration so the row can be unindexed
+    // after libtorrent releases the torrent.
+    std::vector<const void*> identities;
+    std::vector<TorrentSnapshot> snapshots;
+    SparseColumn<lt::add_torrent_params> pending_resume;
+    SparseColumn<SelectionEntry> selection_rules;
+    // Held while a pre-verified add waits for admission; handle updates made meanwhile
+    // queue here and are replayed once the handle is registered.
+    SparseColumn<std::vector<HandleUpdate>> pending_updates;
+
+private:
+    void grow() {
+        keys.emplace_back();
+        handles.emplace_back();
+        identities.emplace_back();
+        snapshots.emplace_back();
+    }
+
+    TorrentKeyMap<std::uint32_t> slots_;
+    std::vector<NativeSlotBinding> bindings_;
+    std::vector<std::uint32_t> free_;
+    std::vector<std::uint32_t> retired_;
+};
+
+// Shared between a background authoring thread and the poll thread. The hashing thread
+// only touches the atomics until it publishes `result` through `finished`.
+struct AuthoringJob {
+    std::atomic<bool> cancel{false};
+    std::atomic<bool> finished{false};
+    std::atomic<std::uint32_t> pieces_done{0};
+    std::atomic<std::uint32_t> pieces_total{0};
+    std::atomic<std::uint32_t> piece_length{0};
+    std::atomic<std::uint64_t> bytes_total{0};
+    std::chrono::steady_clock::time_point started{std::chrono::steady_clock::now()};
+    std::uint32_t reported_pieces{0};
+    bool finish_reported{false};
+    CreateTorrentResult result{};
+    std::thread worker;
+};
+
+// A payload check submitted by an add: a seed-mode hash sample when `sample_pct` is set,
+// then a full pre-verify when `verify_pieces` is. The device runner reads `params` and
+// writes `verified` and `error` before publishing them through `finished`, counting pieces
+// in `pieces_done` as it goes; the engine thread owns the rest.
+struct VerifyJob {
+    TorrentKey id{};
+    lt::add_torrent_params params;
+    int queue_position{-1};
+    std::uint8_t sample_pct{0};
+    bool verify_pieces{false};
+    const AlertWaker* waker{nullptr};
+    std::uint32_t pieces_total{0};
+    std::uint32_t reported_pieces{0};
+    std::atomic<bool> cancel{false};
+    std::atomic<bool> finished{false};
+    std::atomic<std::uint32_t> pieces_done{0};
+    lt::typed_bitfield<lt::piece_index_t> verified;
+    std::string error;
+};
+
+// Runs payload checks from one FIFO queue per storage device, each drained by its own
+// runner thread. A bulk re-import therefore reads each disk one torrent at a time while
+// separate disks proceed in parallel; within a job, pieces fan out per verify_parallelism.
+class VerifyScheduler {
+public:
+    VerifyScheduler() = default;
+    VerifyScheduler(const VerifyScheduler&) = delete;
+    VerifyScheduler& operator=(const VerifyScheduler&) = delete;
+
+    ~VerifyScheduler() {
+        shutdown();
+    }
+
+    void submit(std::shared_ptr<VerifyJob> job) {
+        const auto device = storage_device(job->params.save_path);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& queue = devices_[device];
+        if (!queue) {
+            auto created = std::make_unique<DeviceQueue>();
+            DeviceQueue* target = created.get();
+            created->runner = std::thread([this, target] { run(*target); });
+            queue = std::move(created);
+        }
+        queue->jobs.push_back(std::move(job));
+        wake_.notify_all();
+    }
+
+    // Joins every runner. Queued jobs are dropped; a running job finishes once its cancel
+    // flag is set, so callers cancel their jobs first.
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& entry : devices_) {
+            if (entry.second && entry.second->runner.joinable()) {
+                entry.second->runner.join();
+            }
+        }
+    }
+
+private:
+    struct DeviceQueue {
+        std::deque<std::shared_ptr<VerifyJob>> jobs;
+        std::thread runner;
+    };
+
+    void run(DeviceQueue& queue) {
+        for (;;) {
+            std::shared_ptr<VerifyJob> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stopping_ || !queue.jobs.empty(); });
+                if (stopping_) {
+                    return;
+                }
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+            }
+            if (!job->cancel.load(std::memory_order_relaxed)) {
+                check(*job);
+            }
+            job->finished.store(true, std::memory_order_release);
+            if (job->waker != nullptr) {
+                job->waker->wake();
+            }
+        }
+    }
+
+    // Leaves a failure in `job.error` with the prefix the add reports it under.
+    static void check(VerifyJob& job) {
+        const auto& info = *job.params.ti;
+        try {
+            if (auto failure = hash_sample(info, job.params.save_path, job.sample_pct)) {
+                job.error = std::move(*failure);
+                return;
+            }
+            if (job.verify_pieces) {
+                job.verified =
+                    verify_all_pieces(info, job.params.save_path, job.cancel, job.pieces_done);
+            }
+        } catch (const std::exception& ex) {
+            job.error = std::string(job.verify_pieces ? "pre-verify failed: "
+                                                      : "seed-mode sample failed: ")
+                + ex.what();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_{false};
+    std::unordered_map<std::uint64_t, std::unique_ptr<DeviceQueue>> devices_;
+};
+
+// Root of a complete binary merkle tree over `leaves`, whose size is a power of two. The
+// leaves are overwritten level by level.
+lt::sha256_hash merkle_root(std::vector<lt::sha256_hash>& leaves) {
+    for (std::size_t width = leaves.size(); width > 1; width /= 2) {
+        for (std::size_t idx = 0; idx < width / 2; ++idx) {
+            lt::hasher256 parent;
+            parent.update(leaves[2 * idx].data(), static_cast<int>(lt::sha256_hash::size()));
+            parent.update(leaves[2 * idx + 1].data(),
+                          static_cast<int>(lt::sha256_hash::size()));
+            leaves[idx] = parent.final();
+        }
+    }
+    return leaves.front();
+}
+
+// Where a piece falls in the v2 per-file hash trees.
+struct V2Piece {
+    lt::file_index_t file{};
+    int index_in_file{0};
+    // Merkle leaves for the piece root; blocks past the data hash as zeros.
+    int leaves{0};
+};
+
+// Maps each piece to the file whose v2 tree it belongs to. Files are piece-aligned, so a
+// piece holds data from at most one file; pieces made only of padding stay unset.
+std::vector<std::optional<V2Piece>> map_v2_pieces(const lt::file_storage& files) {
+    std::vector<std::optional<V2Piece>> pieces(static_cast<std::size_t>(files.num_pieces()));
+    const std::int64_t piece_length = files.piece_length();
+    const int blocks_per_piece = static_cast<int>(piece_length / kV2BlockSize);
+    for (const auto file : files.file_range()) {
+        const std::int64_t size = files.file_size(file);
+        if (files.pad_file_at(file) || size == 0) {
+            continue;
+        }
+        // Files shorter than a piece pad their block hashes to the next power of two rather
+        // than to the piece boundary.
+        int leaves = blocks_per_piece;
+        if (size < piece_length) {
+            const auto blocks = static_cast<int>((size + kV2BlockSize - 1) / kV2BlockSize);
+            leaves = 1;
+            while (leaves < blocks) {
+                leaves *= 2;
+            }
+        }
+        const auto first = static_cast<std::size_t>(files.file_offset(file) / piece_length);
+        const auto count = static_cast<int>((size + piece_length - 1) / piece_length);
+        for (int idx = 0; idx < count; ++idx) {
+            pieces[first + static_cast<std::size_t>(idx)] = V2Piece{file, idx, leaves};
+        }
+    }
+    return pieces;
+}
+
+// Hashes the payload of `builder` under `root` on `threads` workers and stores the v1 piece
+// hashes and v2 piece-layer roots it needs. Workers own their reads and stop between
+// pieces once `job` is cancelled, so nothing is left running when this returns. Hashes
+// are handed to the builder only after every worker has joined. Returns an error message,
+// or an empty string on success.
+std::string hash_authored_pieces(lt::create_torrent& builder,
+                                 const std::filesystem::path& root,
+                                 std::size_t threads,
+                                 AuthoringJob* job) {
+    const auto& files = builder.files();
+    const auto pieces = static_cast<std::size_t>(builder.num_pieces());
+    const bool v1 = !builder.is_v2_only();
+    const bool v2 = !builder.is_v1_only();
+    std::vector<lt::sha1_hash> v1_hashes(v1 ? pieces : 0);
+    std::vector<lt::sha256_hash> v2_roots(v2 ? pieces : 0);
+    const auto v2_pieces =
+        v2 ? map_v2_pieces(files) : std::vector<std::optional<V2Piece>>();
+    const auto piece_length = static_cast<std::size_t>(files.piece_length());
+    std::vector<std::optional<std::string>> errors(std::max<std::size_t>(1, threads));
+
+    run_piece_workers(
+        pieces, threads, [&] { return PieceReader(files, root); },
+        [&](PieceReader& reader, std::size_t worker, std::size_t idx) {
+            if (job != nullptr && job->cancel.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            if (auto error = reader.read(static_cast<int>(idx))) {
+                errors[worker] = std::move(error);
+                return false;
+            }
+            if (v1) {
+                v1_hashes[idx] =
+                    lt::hasher(reader.data(), static_cast<int>(reader.size())).final();
+            }
+            if (v2 && v2_pieces[idx]) {
+                // The piece's own bytes precede any padding that follows the file.
+                const auto bytes = std::min(
+                    reader.size(),
+                    static_cast<std::size_t>(
+                        files.file_size(v2_pieces[idx]->file)
+                        - static_cast<std::int64_t>(v2_pieces[idx]->index_in_file)
+                            * static_cast<std::int64_t>(piece_length)));
+                std::vector<lt::sha256_hash> leaves(
+                    static_cast<std::size_t>(v2_pieces[idx]->leaves));
+                const auto block_size = static_cast<std::size_t>(kV2BlockSize);
+                for (std::size_t offset = 0, block = 0; offset < bytes;
+                     offset += block_size, ++block) {
+                    const auto length = std::min(block_size, bytes - offset);
+                    leaves[block] =
+                        lt::hasher256(reader.data() + offset, static_cast<int>(length)).final();
+                }
+                v2_roots[idx] = merkle_root(leaves);
+            }
+            if (job != nullptr) {
+                job->pieces_done.fetch_add(1, std::memory_order_relaxed);
+            }
+            return true;
+        });
 
-struct TorrentSnapshot {
-    NativeTorrentState state{NativeTorrentState::Queued};
-    std::uint64_t bytes_downloaded{0};
-    std::uint64_t bytes_total{0};
-    bool metadata_applied{false};
-    bool metadata_emitted{false};
-    bool completed_emitted{false};
-    bool resume_requested{false};
-    std::string last_name;
-    std::string last_download_dir;
-};
+    if (job != nullptr && job->cancel.load(std::memory_order_relaxed)) {
+        return kAuthoringCancelled;
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            return "hashing failed: " + *error;
+        }
+    }
+    for (std::size_t idx = 0; idx < pieces; ++idx) {
+        const lt::piece_index_t piece{static_cast<int>(idx)};
+        if (v1) {
+            builder.set_hash(piece, v1_hashes[idx]);
+        }
+        if (v2 && v2_pieces[idx]) {
+            builder.set_hash2(v2_pieces[idx]->file,
+                              lt::piece_index_t::diff_type{v2_pieces[idx]->index_in_file},
+                              v2_roots[idx]);
+        }
+    }
+    return {};
+}
 
 bool set_bool_setting(lt::settings_pack& pack, const char* name, bool value) {
     const int index = lt::setting_by_name(name);
@@ -427,6 +1616,197 @@ bool set_str_setting(lt::settings_pack& pack, const char* name, const std::strin
 void set_strict_super_seeding(lt::settings_pack& pack, bool value) {
     set_bool_setting(pack, "strict_super_seeding", value);
 }
+
+// Entry points on `Session`, in declaration order; each one is timed into its own histogram.
+enum class SessionCall : std::size_t {
+    kApplyEngineProfile,
+    kAddTorrent,
+    kAddTorrents,
+    kStartCreateTorrent,
+    kCancelCreateTorrent,
+    kAuthoringFinished,
+    kTakeCreateTorrentResult,
+    kRemoveTorrent,
+    kPauseTorrent,
+    kResumeTorrent,
+    kSetSequential,
+    kLoadFastresume,
+    kRestoreTorrents,
+    kUpdateLimits,
+    kUpdateSelection,
+    kUpdateOptions,
+    kUpdateTrackers,
+    kUpdateWebSeeds,
+    kMoveTorrent,
+    kReannounce,
+    kRecheck,
+    kSetPieceDeadline,
+    kListFiles,
+    kListPeers,
+    kInspectMetadataCacheState,
+    kSessionStatsMetrics,
+    kInspectSessionStats,
+    kInspectStorageState,
+    kInspectPeerClassState,
+    kInspectSettingsState,
+    kInspectTimingState,
+    kFlushResumeData,
+    kPollEvents,
+    kSetAlertWaker,
+    kCount,
+};
+
+constexpr std::size_t kSessionCallCount = static_cast<std::size_t>(SessionCall::kCount);
+constexpr std::array<const char*, kSessionCallCount> kSessionCallNames = {
+    "apply_engine_profile",
+    "add_torrent",
+    "add_torrents",
+    "start_create_torrent",
+    "cancel_create_torrent",
+    "authoring_finished",
+    "take_create_torrent_result",
+    "remove_torrent",
+    "pause_torrent",
+    "resume_torrent",
+    "set_sequential",
+    "load_fastresume",
+    "restore_torrents",
+    "update_limits",
+    "update_selection",
+    "update_options",
+    "update_trackers",
+    "update_web_seeds",
+    "move_torrent",
+    "reannounce",
+    "recheck",
+    "set_piece_deadline",
+    "list_files",
+    "list_peers",
+    "inspect_metadata_cache_state",
+    "session_stats_metrics",
+    "inspect_session_stats",
+    "inspect_storage_state",
+    "inspect_peer_class_state",
+    "inspect_settings_state",
+    "inspect_timing_state",
+    "flush_resume_data",
+    "poll_events",
+    "set_alert_waker",
+};
+
+std::size_t floor_log2(std::uint64_t value) {
+    std::size_t shift = 0;
+    for (std::size_t step = 32; step > 0; step >>= 1) {
+        if ((value >> step) != 0) {
+            value >>= step;
+            shift += step;
+        }
+    }
+    return shift;
+}
+
+std::size_t timing_bucket(std::uint64_t nanos) {
+    if (nanos < (std::uint64_t{1} << kTimingMinShift)) {
+        return 0;
+    }
+    const std::size_t shift = floor_log2(nanos);
+    const std::size_t octave = shift - kTimingMinShift;
+    if (octave >= kTimingOctaves) {
+        return kTimingBucketCount - 1;
+    }
+    const std::size_t sub_mask = (std::size_t{1} << kTimingSubBucketBits) - 1;
+    const std::size_t sub =
+        static_cast<std::size_t>(nanos >> (shift - kTimingSubBucketBits)) & sub_mask;
+    return 1 + (octave << kTimingSubBucketBits) + sub;
+}
+
+// Exclusive upper bound of a bucket in nanoseconds; the overflow bucket is unbounded.
+std::uint64_t timing_bucket_bound(std::size_t bucket) {
+    if (bucket == 0) {
+        return std::uint64_t{1} << kTimingMinShift;
+    }
+    if (bucket == kTimingBucketCount - 1) {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+    const std::size_t octave = (bucket - 1) >> kTimingSubBucketBits;
+    const std::size_t sub = (bucket - 1) & ((std::size_t{1} << kTimingSubBucketBits) - 1);
+    const std::uint64_t leading = (std::uint64_t{1} << kTimingSubBucketBits) + sub + 1;
+    return leading << (octave + kTimingMinShift - kTimingSubBucketBits);
+}
+
+// Fixed-bucket latency histograms for every `Session` entry point. Recording is a handful of
+// relaxed atomic increments, so timing stays lock-free for whichever thread drives the session
+// and `snapshot` can read it at any time without stopping the engine.
+class CallTimings {
+public:
+    void record(SessionCall call, std::uint64_t nanos) {
+        auto& histogram = histograms_[static_cast<std::size_t>(call)];
+        histogram.calls.fetch_add(1, std::memory_order_relaxed);
+        histogram.total_ns.fetch_add(nanos, std::memory_order_relaxed);
+        histogram.buckets[timing_bucket(nanos)].fetch_add(1, std::memory_order_relaxed);
+        auto slowest = histogram.max_ns.load(std::memory_order_relaxed);
+        while (nanos > slowest
+               && !histogram.max_ns.compare_exchange_weak(
+                   slowest, nanos, std::memory_order_relaxed)) {
+        }
+    }
+
+    EngineTimingState snapshot() const {
+        EngineTimingState state{};
+        state.bucket_bounds_ns.reserve(kTimingBucketCount);
+        for (std::size_t bucket = 0; bucket < kTimingBucketCount; ++bucket) {
+            state.bucket_bounds_ns.push_back(timing_bucket_bound(bucket));
+        }
+        state.calls.reserve(histograms_.size());
+        for (std::size_t index = 0; index < histograms_.size(); ++index) {
+            const auto& histogram = histograms_[index];
+            NativeCallTiming timing{};
+            timing.name = kSessionCallNames[index];
+            timing.calls = histogram.calls.load(std::memory_order_relaxed);
+            timing.total_ns = histogram.total_ns.load(std::memory_order_relaxed);
+            timing.max_ns = histogram.max_ns.load(std::memory_order_relaxed);
+            timing.buckets.reserve(kTimingBucketCount);
+            for (const auto& bucket : histogram.buckets) {
+                timing.buckets.push_back(bucket.load(std::memory_order_relaxed));
+            }
+            state.calls.push_back(std::move(timing));
+        }
+        return state;
+    }
+
+private:
+    struct Histogram {
+        std::atomic<std::uint64_t> calls{0};
+        std::atomic<std::uint64_t> total_ns{0};
+        std::atomic<std::uint64_t> max_ns{0};
+        std::array<std::atomic<std::uint64_t>, kTimingBucketCount> buckets{};
+    };
+
+    std::array<Histogram, kSessionCallCount> histograms_{};
+};
+
+// Records the wall time of the enclosing `Session` call when it goes out of scope.
+class CallTimer {
+public:
+    CallTimer(CallTimings& timings, SessionCall call)
+        : timings_(timings), call_(call), start_(std::chrono::steady_clock::now()) {}
+
+    ~CallTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        timings_.record(
+            call_,
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    CallTimer(const CallTimer&) = delete;
+    CallTimer& operator=(const CallTimer&) = delete;
+
+private:
+    CallTimings& timings_;
+    SessionCall call_;
+    std::chrono::steady_clock::time_point start_;
+};
 }  // namespace
 
 class Session::Impl {
@@ -460,8 +1840,66 @@ public:
         }
     }
 
+    ~Impl() {
+        // Authoring threads hold pointers into their jobs and the waker; stop them first.
+        for (auto& entry : authoring_jobs_) {
+            entry.second->cancel.store(true, std::memory_order_relaxed);
+        }
+        for (auto& entry : authoring_jobs_) {
+            if (entry.second->worker.joinable()) {
+                entry.second->worker.join();
+            }
+        }
+        for (auto& job : verify_jobs_) {
+            job->cancel.store(true, std::memory_order_relaxed);
+        }
+        verifier_.shutdown();
+        // The notify callback points at alert_waker_; detach it before members unwind.
+        if (session_) {
+            session_->set_alert_notify(std::function<void()>{});
+        }
+    }
+
+    void set_alert_waker(::rust::Box<AlertWaker> waker) {
+        alert_waker_.emplace(std::move(waker));
+        install_alert_notify();
+    }
+
+    void install_alert_notify() {
+        if (!alert_waker_) {
+            return;
+        }
+        const AlertWaker* target = &**alert_waker_;
+        session_->set_alert_notify([target]() { target->wake(); });
+    }
+
+    // libtorrent fixes the disk subsystem when a session is constructed, so a backend change
+    // rebuilds the session from its saved state. That is only safe while nothing is attached:
+    // the first profile applied, before stored torrents are restored. Otherwise the running
+    // backend stays until the next start.
+    void switch_disk_io_backend(std::uint8_t requested) {
+        const auto backend = resolve_disk_io_backend(requested);
+        if (backend == disk_io_backend_ || !torrent_slots_.empty() || !pending_adds_.empty()
+            || !verify_jobs_.empty() || restore_batch_.active) {
+            return;
+        }
+        lt::session_params params = session_->session_state();
+        params.disk_io_constructor = disk_io_constructor(backend);
+        session_->set_alert_notify(std::function<void()>{});
+        session_.reset();
+        session_ = std::make_unique<lt::session>(std::move(params));
+        disk_io_backend_ = backend;
+        // Peer classes lived in the old session; configure_peer_classes recreates them.
+        custom_peer_classes_.clear();
+        peer_class_map_.fill(lt::peer_class_t{0});
+        last_status_post_ = {};
+        last_stats_post_ = {};
+        install_alert_notify();
+    }
+
     ::rust::String apply_engine_profile(const EngineOptions& options) {
         try {
+            switch_disk_io_backend(options.storage.disk_io_backend);
             lt::settings_pack pack;
             pack.set_bool(lt::settings_pack::enable_dht, options.network.enable_dht);
             pack.set_bool(lt::settings_pack::enable_lsd, options.network.enable_lsd);
@@ -610,6 +2048,12 @@ public:
                 }
             }
             default_storage_mode_ = to_storage_mode(options.storage.storage_mode);
+            resume_checkpoint_interval_ = options.storage.has_resume_checkpoint_interval
+                ? std::chrono::milliseconds(options.storage.resume_checkpoint_interval_ms)
+                : kDefaultResumeCheckpointInterval;
+            resume_max_inflight_saves_ = options.storage.has_resume_max_inflight_saves
+                ? options.storage.resume_max_inflight_saves
+                : kDefaultResumeMaxInflightSaves;
             set_bool_setting(pack, "use_partfile", options.storage.use_partfile);
             if (options.storage.has_disk_read_mode) {
                 set_int_setting(pack, "disk_io_read_mode", options.storage.disk_read_mode);
@@ -628,6 +2072,12 @@ public:
             set_bool_setting(pack, "coalesce_reads", options.storage.coalesce_reads);
             set_bool_setting(pack, "coalesce_writes", options.storage.coalesce_writes);
             set_bool_setting(pack, "use_disk_cache_pool", options.storage.use_disk_cache_pool);
+            if (options.storage.has_aio_threads) {
+                pack.set_int(lt::settings_pack::aio_threads, options.storage.aio_threads);
+            }
+            if (options.storage.has_hashing_threads) {
+                pack.set_int(lt::settings_pack::hashing_threads, options.storage.hashing_threads);
+            }
 
             sequential_default_ = options.behavior.sequential_default;
             auto_managed_default_ = options.behavior.auto_managed;
@@ -858,7 +2308,73 @@ public:
         session_->set_peer_class_type_filter(filter);
     }
 
-    CreateTorrentResult create_torrent(const CreateTorrentRequest& request) {
+    ::rust::String start_create_torrent(const std::string& job_id,
+                                        const CreateTorrentRequest& request) {
+        if (job_id.empty()) {
+            return ::rust::String("authoring job id is required");
+        }
+        try {
+            auto [it, inserted] =
+                authoring_jobs_.emplace(job_id, std::make_unique<AuthoringJob>());
+            if (!inserted) {
+                return ::rust::String("authoring job already exists: " + job_id);
+            }
+            AuthoringJob* job = it->second.get();
+            const AlertWaker* waker = alert_waker_ ? &**alert_waker_ : nullptr;
+            try {
+                job->worker = std::thread([job, waker, owned = request]() {
+                    job->result = author_torrent(owned, job);
+                    job->finished.store(true, std::memory_order_release);
+                    if (waker != nullptr) {
+                        waker->wake();
+                    }
+                });
+            } catch (...) {
+                authoring_jobs_.erase(it);
+                throw;
+            }
+        } catch (const std::exception& ex) {
+            return ::rust::String(ex.what());
+        }
+        return ::rust::String();
+    }
+
+    ::rust::String cancel_create_torrent(const std::string& job_id) {
+        auto it = authoring_jobs_.find(job_id);
+        if (it == authoring_jobs_.end()) {
+            return ::rust::String("unknown authoring job: " + job_id);
+        }
+        it->second->cancel.store(true, std::memory_order_relaxed);
+        return ::rust::String();
+    }
+
+    bool authoring_finished(const std::string& job_id) const {
+        auto it = authoring_jobs_.find(job_id);
+        return it == authoring_jobs_.end()
+            || it->second->finished.load(std::memory_order_acquire);
+    }
+
+    CreateTorrentResult take_create_torrent_result(const std::string& job_id) {
+        CreateTorrentResult result{};
+        auto it = authoring_jobs_.find(job_id);
+        if (it == authoring_jobs_.end()) {
+            result.error = "unknown authoring job: " + job_id;
+            return result;
+        }
+        if (!it->second->finished.load(std::memory_order_acquire)) {
+            result.error = "authoring job is still running: " + job_id;
+            return result;
+        }
+        it->second->worker.join();
+        result = std::move(it->second->result);
+        authoring_jobs_.erase(it);
+        return result;
+    }
+
+private:
+    // Runs on an authoring job thread, so it must not touch session state.
+    static CreateTorrentResult author_torrent(const CreateTorrentRequest& request,
+                                              AuthoringJob* job) {
         CreateTorrentResult result{};
         result.metainfo = rust::Vec<std::uint8_t>();
         result.files = rust::Vec<CreateTorrentFile>();
@@ -867,6 +2383,8 @@ public:
         result.web_seeds = rust::Vec<rust::String>();
         result.magnet_uri = ::rust::String();
         result.info_hash = ::rust::String();
+        result.info_hash_v1 = ::rust::String();
+        result.info_hash_v2 = ::rust::String();
         result.error = ::rust::String();
         result.private_flag = request.private_flag;
         result.comment = request.has_comment ? to_std_string(request.comment) : std::string();
@@ -894,17 +2412,8 @@ public:
                 warnings.push_back(message);
             };
 
-            auto compile_patterns = [](const rust::Vec<rust::String>& patterns) {
-                std::vector<std::regex> compiled;
-                compiled.reserve(patterns.size());
-                for (const auto& pattern : patterns) {
-                    compiled.emplace_back(glob_to_regex(to_std_string(pattern)), std::regex::icase);
-                }
-                return compiled;
-            };
-
-            const auto include_patterns = compile_patterns(request.include);
-            const auto exclude_patterns = compile_patterns(request.exclude);
+            const auto include_patterns = compile_globs(request.include);
+            const auto exclude_patterns = compile_globs(request.exclude);
 
             struct FileEntry {
                 std::string path;
@@ -932,11 +2441,11 @@ public:
                     record_skip(rel_path);
                     return false;
                 }
-                if (!exclude_patterns.empty() && matches_any(exclude_patterns, rel_path)) {
+                if (exclude_patterns.matches(rel_path)) {
                     record_skip(rel_path);
                     return false;
                 }
-                if (!include_patterns.empty() && !matches_any(include_patterns, rel_path)) {
+                if (!include_patterns.empty() && !include_patterns.matches(rel_path)) {
                     record_skip(rel_path);
                     return false;
                 }
@@ -1076,7 +2585,26 @@ public:
 
             const int piece_length_value =
                 request.has_piece_length ? static_cast<int>(piece_length) : 0;
-            lt::create_torrent builder(storage, piece_length_value);
+            // Hybrid (no flags) is opt-in: one pass over the data produces the v1 SHA-1 pieces
+            // and the v2 per-file SHA-256 merkle trees and piece layers together.
+            lt::create_flags_t create_flags{};
+            if (request.format == AuthorFormat::V1Only) {
+                create_flags = lt::create_torrent::v1_only;
+            } else if (request.format == AuthorFormat::V2Only) {
+                create_flags = lt::create_torrent::v2_only;
+            }
+            lt::create_torrent builder(storage, piece_length_value, create_flags);
+            if (job != nullptr) {
+                job->piece_length.store(static_cast<std::uint32_t>(builder.piece_length()),
+                                        std::memory_order_relaxed);
+                job->pieces_total.store(static_cast<std::uint32_t>(builder.num_pieces()),
+                                        std::memory_order_relaxed);
+                job->bytes_total.store(total_size, std::memory_order_relaxed);
+                if (job->cancel.load(std::memory_order_relaxed)) {
+                    result.error = kAuthoringCancelled;
+                    return result;
+                }
+            }
             if (request.private_flag) {
                 builder.set_priv(true);
             }
@@ -1092,10 +2620,15 @@ public:
 
             const auto hash_root =
                 is_file ? root_path.parent_path().string() : root_path.string();
-            lt::error_code hash_ec;
-            lt::set_piece_hashes(builder, hash_root, hash_ec);
-            if (hash_ec) {
-                result.error = "hashing failed: " + hash_ec.message();
+            // Pieces are split across hash_threads workers; hashes land in the builder by
+            // piece index, so the output does not depend on completion order.
+            const auto hash_error = hash_authored_pieces(
+                builder,
+                hash_root,
+                static_cast<std::size_t>(resolve_hash_threads(request.hash_threads)),
+                job);
+            if (!hash_error.empty()) {
+                result.error = hash_error;
                 return result;
             }
 
@@ -1115,13 +2648,16 @@ public:
                 return result;
             }
 
-            result.metainfo.reserve(buffer.size());
-            for (char byte : buffer) {
-                result.metainfo.push_back(static_cast<std::uint8_t>(byte));
-            }
+            result.metainfo = to_rust_bytes(buffer);
             result.magnet_uri = lt::make_magnet_uri(info);
-            result.info_hash =
-                lt::aux::to_hex(info.info_hashes().get_best().to_string());
+            const auto& hashes = info.info_hashes();
+            result.info_hash = lt::aux::to_hex(hashes.get_best().to_string());
+            if (hashes.has_v1()) {
+                result.info_hash_v1 = lt::aux::to_hex(hashes.v1.to_string());
+            }
+            if (hashes.has_v2()) {
+                result.info_hash_v2 = lt::aux::to_hex(hashes.v2.to_string());
+            }
             const int effective_piece_length = builder.piece_length();
             result.piece_length =
                 effective_piece_length > 0
@@ -1154,245 +2690,418 @@ public:
         return result;
     }
 
+public:
     ::rust::String add_torrent(const AddTorrentRequest& request) {
         try {
             lt::add_torrent_params params;
-            const auto overrides = overrides_from_request(request);
-            std::vector<char> metainfo_buffer;
-            const auto request_id = to_std_string(request.id);
-            const auto download_dir = to_std_string(request.download_dir);
-            auto resume_it = pending_resume_.find(request_id);
-            if (resume_it != pending_resume_.end()) {
-                lt::error_code resume_ec;
-                auto resume_params = lt::read_resume_data(resume_it->second, resume_ec);
-                pending_resume_.erase(resume_it);
-                if (resume_ec) {
-                    return ::rust::String(
-                        "resume data parse failed: " + resume_ec.message());
-                }
-                params = std::move(resume_params);
-                if (params.save_path.empty()) {
-                    params.save_path =
-                        request.has_download_dir ? download_dir : default_download_root_;
-                } else if (request.has_download_dir) {
-                    params.save_path = download_dir;
+            const auto error = prepare_add(request, params);
+            if (!error.empty()) {
+                return ::rust::String(error);
+            }
+            if (needs_payload_check(request)) {
+                submit_verify(request, std::move(params));
+                return ::rust::String();
+            }
+            lt::torrent_handle handle = session_->add_torrent(params);
+            register_handle(request.id, handle, queue_position_for(request), params.ti);
+        } catch (const std::exception& ex) {
+            return ::rust::String(ex.what());
+        }
+        return ::rust::String();
+    }
+
+    rust::Vec<::rust::String> add_torrents(rust::Slice<const AddTorrentRequest> requests) {
+        rust::Vec<::rust::String> results;
+        results.reserve(requests.size());
+        for (const auto& request : requests) {
+            std::string error;
+            try {
+                lt::add_torrent_params params;
+                error = prepare_add(request, params);
+                if (error.empty() && needs_payload_check(request)) {
+                    submit_verify(request, std::move(params));
+                } else if (error.empty()) {
+                    const auto key = async_add_key(params);
+                    if (pending_adds_.count(key) != 0) {
+                        error = "info hash already being added";
+                    } else {
+                        session_->async_add_torrent(std::move(params));
+                        pending_adds_.emplace(
+                            key,
+                            PendingAdd{request.id, queue_position_for(request), false});
+                        // Updates issued before add_torrent_alert queue here and replay in
+                        // register_handle, as they do for restores and verifies.
+                        torrents_.pending_updates.assign(torrents_.acquire(request.id), {});
+                    }
                 }
+            } catch (const std::exception& ex) {
+                error = ex.what();
+            }
+            results.push_back(::rust::String(error));
+        }
+        return results;
+    }
+
+private:
+    // Builds the add_torrent_params for a request. Returns a rejection message, or an empty
+    // string once `params` is ready to submit.
+    std::string prepare_add(const AddTorrentRequest& request, lt::add_torrent_params& params) {
+        const auto overrides = overrides_from_request(request);
+        std::string metainfo_buffer;
+        const auto download_dir = to_std_string(request.download_dir);
+        const auto slot = torrents_.find(request.id);
+        if (torrents_.pending_updates.contains(slot)) {
+            return "torrent admission is already pending";
+        }
+        if (auto* resume = torrents_.pending_resume.find(slot)) {
+            params = std::move(*resume);
+            torrents_.pending_resume.erase(slot);
+            torrents_.release_if_unused(slot);
+            if (params.save_path.empty()) {
+                params.save_path =
+                    request.has_download_dir ? download_dir : default_download_root_;
+            } else if (request.has_download_dir) {
+                params.save_path = download_dir;
+            }
+        } else {
+            params.save_path = request.has_download_dir ? download_dir : default_download_root_;
+            if (params.save_path.empty()) {
+                return "download directory not configured";
+            }
+
+            if (request.source_kind == SourceKind::Magnet) {
+                auto parsed = lt::parse_magnet_uri(to_std_string(request.magnet_uri));
+                parsed.save_path =
+                    request.has_download_dir ? download_dir : default_download_root_;
+                params = std::move(parsed);
             } else {
-                params.save_path = request.has_download_dir ? download_dir : default_download_root_;
-                if (params.save_path.empty()) {
-                    return "download directory not configured";
+                if (request.metainfo.empty()) {
+                    return "metainfo payload empty";
                 }
-
-                if (request.source_kind == SourceKind::Magnet) {
-                    auto parsed = lt::parse_magnet_uri(to_std_string(request.magnet_uri));
-                    parsed.save_path =
-                        request.has_download_dir ? download_dir : default_download_root_;
-                    params = std::move(parsed);
-                } else {
-                    if (request.metainfo.empty()) {
-                        return "metainfo payload empty";
-                    }
-                    metainfo_buffer.resize(request.metainfo.size());
-                    std::transform(
-                        request.metainfo.begin(),
-                        request.metainfo.end(),
-                        metainfo_buffer.begin(),
-                        [](std::uint8_t byte) { return static_cast<char>(byte); });
-                    if (overrides.has_comment || overrides.has_source || overrides.has_private) {
-                        lt::error_code decode_ec;
-                        lt::bdecode_node decoded;
-                        const int decode_result = lt::bdecode(
-                            metainfo_buffer.data(),
-                            metainfo_buffer.data() + metainfo_buffer.size(),
-                            decoded,
-                            decode_ec);
-                        if (decode_result != 0 || decode_ec) {
-                            return ::rust::String(
-                                "metainfo decode failed: " + decode_ec.message());
-                        }
-                        lt::entry metainfo_entry(decoded);
-                        std::string override_error;
-                        if (!apply_metainfo_overrides(metainfo_entry, overrides, override_error)) {
-                            return ::rust::String(override_error);
-                        }
-                        std::vector<char> updated;
-                        lt::bencode(std::back_inserter(updated), metainfo_entry);
-                        metainfo_buffer = std::move(updated);
+                // Parse straight from the Rust-owned payload; only overrides need a copy.
+                lt::span<const char> buffer(
+                    reinterpret_cast<const char*>(request.metainfo.data()),
+                    static_cast<long>(request.metainfo.size()));
+                if (has_metainfo_overrides(overrides)) {
+                    std::string override_error;
+                    if (!splice_with_overrides(
+                            buffer, overrides, metainfo_buffer, override_error)) {
+                        return override_error;
                     }
-
-                    lt::span<const char> buffer(
+                    buffer = lt::span<const char>(
                         metainfo_buffer.data(),
                         static_cast<long>(metainfo_buffer.size()));
+                }
+
+                const auto digest = lt::hasher(buffer).final();
+                params.ti = metadata_.reuse(digest);
+                if (!params.ti) {
                     lt::error_code parse_ec;
                     params.ti = std::make_shared<lt::torrent_info>(
                         buffer,
                         parse_ec,
                         lt::from_span);
                     if (parse_ec) {
-                        return ::rust::String(
+                        return std::string(
                             "metainfo parse failed (bytes="
-                            + std::to_string(metainfo_buffer.size())
+                            + std::to_string(buffer.size())
                             + "): " + parse_ec.message());
                     }
+                    metadata_.remember(digest, params.ti);
                 }
             }
+        }
 
-            const bool seed_mode_requested = request.has_seed_mode && request.seed_mode;
-            const bool hash_sample_requested =
-                request.has_hash_check_sample && request.hash_check_sample_pct > 0;
+        const bool seed_mode_requested = request.has_seed_mode && request.seed_mode;
+        const bool hash_sample_requested =
+            request.has_hash_check_sample && request.hash_check_sample_pct > 0;
 
-            if (seed_mode_requested && !params.ti) {
-                return "seed_mode requires metainfo payload";
-            }
+        if (seed_mode_requested && !params.ti) {
+            return "seed_mode requires metainfo payload";
+        }
 
-            if (hash_sample_requested) {
-                if (!params.ti) {
-                    return "hash sample requires metainfo payload";
-                }
-                const auto sample_result =
-                    hash_sample(*params.ti, params.save_path, request.hash_check_sample_pct);
-                if (sample_result.has_value()) {
-                    return ::rust::String(*sample_result);
-                }
-            }
+        // Sampled and pre-verified pieces are hashed by a background job; see submit_verify.
+        if (hash_sample_requested && !params.ti) {
+            return "hash sample requires metainfo payload";
+        }
+        if (request.pre_verify && !params.ti) {
+            return "pre_verify requires metainfo payload";
+        }
 
-            const bool auto_managed = request.has_auto_managed
-                ? request.auto_managed
-                : (request.has_queue_position ? false : auto_managed_default_);
-            const bool pex_enabled =
-                request.has_pex_enabled ? request.pex_enabled : pex_enabled_;
-            const bool super_seeding = request.has_super_seeding
-                ? request.super_seeding
-                : super_seeding_default_;
-            if (auto_managed) {
-                params.flags |= lt::torrent_flags::auto_managed;
-            } else {
-                params.flags &= ~lt::torrent_flags::auto_managed;
-            }
-            if (pex_enabled) {
-                params.flags &= ~lt::torrent_flags::disable_pex;
-            } else {
-                params.flags |= lt::torrent_flags::disable_pex;
-            }
-            if (seed_mode_requested) {
-                params.flags |= lt::torrent_flags::seed_mode;
-            } else {
-                params.flags &= ~lt::torrent_flags::seed_mode;
+        const bool auto_managed = request.has_auto_managed
+            ? request.auto_managed
+            : (request.has_queue_position ? false : auto_managed_default_);
+        const bool pex_enabled =
+            request.has_pex_enabled ? request.pex_enabled : pex_enabled_;
+        const bool super_seeding = request.has_super_seeding
+            ? request.super_seeding
+            : super_seeding_default_;
+        if (auto_managed) {
+            params.flags |= lt::torrent_flags::auto_managed;
+        } else {
+            params.flags &= ~lt::torrent_flags::auto_managed;
+        }
+        if (pex_enabled) {
+            params.flags &= ~lt::torrent_flags::disable_pex;
+        } else {
+            params.flags |= lt::torrent_flags::disable_pex;
+        }
+        if (seed_mode_requested) {
+            params.flags |= lt::torrent_flags::seed_mode;
+        } else {
+            params.flags &= ~lt::torrent_flags::seed_mode;
+        }
+        if (super_seeding) {
+            params.flags |= lt::torrent_flags::super_seeding;
+        } else {
+            params.flags &= ~lt::torrent_flags::super_seeding;
+        }
+        if (request.has_start_paused && request.start_paused) {
+            params.flags |= lt::torrent_flags::paused;
+        }
+        if (request.has_max_connections && request.max_connections > 0) {
+            params.max_connections = request.max_connections;
+        } else if (default_max_connections_per_torrent_ > 0) {
+            params.max_connections = default_max_connections_per_torrent_;
+        }
+
+        const AuthView auth = resolve_auth_view(request.tracker_auth);
+
+        std::vector<std::string> trackers;
+        if (!replace_default_trackers_) {
+            trackers.insert(trackers.end(), default_trackers_.begin(), default_trackers_.end());
+            trackers.insert(trackers.end(), extra_trackers_.begin(), extra_trackers_.end());
+        }
+        if (request.replace_trackers) {
+            trackers.clear();
+            trackers.reserve(request.trackers.size());
+            for (const auto& tracker : request.trackers) {
+                trackers.push_back(to_std_string(tracker));
             }
-            if (super_seeding) {
-                params.flags |= lt::torrent_flags::super_seeding;
-            } else {
-                params.flags &= ~lt::torrent_flags::super_seeding;
+        } else {
+            for (const auto& tracker : request.trackers) {
+                trackers.push_back(to_std_string(tracker));
             }
-            if (request.has_start_paused && request.start_paused) {
-                params.flags |= lt::torrent_flags::paused;
+        }
+        if (!trackers.empty()) {
+            params.trackers = apply_tracker_auth(trackers, auth);
+        }
+
+        if (overrides.has_private && overrides.private_flag) {
+            bool has_tracker = !params.trackers.empty();
+            if (!has_tracker && params.ti) {
+                has_tracker = !params.ti->trackers().empty();
             }
-            if (request.has_max_connections && request.max_connections > 0) {
-                params.max_connections = request.max_connections;
-            } else if (default_max_connections_per_torrent_ > 0) {
-                params.max_connections = default_max_connections_per_torrent_;
+            if (!has_tracker) {
+                return std::string("private torrents require at least one tracker");
             }
+        }
 
-            const AuthView auth = resolve_auth_view(request.tracker_auth);
+        if (request.tracker_auth.has_cookie) {
+            params.trackerid = to_std_string(request.tracker_auth.cookie);
+        } else if (has_tracker_cookie_) {
+            params.trackerid = tracker_cookie_;
+        }
 
-            std::vector<std::string> trackers;
-            if (!replace_default_trackers_) {
-                trackers.insert(trackers.end(), default_trackers_.begin(), default_trackers_.end());
-                trackers.insert(trackers.end(), extra_trackers_.begin(), extra_trackers_.end());
-            }
-            if (request.replace_trackers) {
-                trackers.clear();
-                trackers.reserve(request.trackers.size());
-                for (const auto& tracker : request.trackers) {
-                    trackers.push_back(to_std_string(tracker));
+        if (!request.web_seeds.empty()) {
+            std::vector<std::string> seeds;
+            seeds.reserve(request.web_seeds.size());
+            for (const auto& seed : request.web_seeds) {
+                seeds.push_back(to_std_string(seed));
+            }
+            if (request.replace_web_seeds) {
+                params.url_seeds = std::move(seeds);
+            } else if (!params.url_seeds.empty()) {
+                std::unordered_set<std::string> seen;
+                for (const auto& existing : params.url_seeds) {
+                    seen.insert(existing);
                 }
-            } else {
-                for (const auto& tracker : request.trackers) {
-                    trackers.push_back(to_std_string(tracker));
+                for (const auto& seed : seeds) {
+                    if (seen.insert(seed).second) {
+                        params.url_seeds.push_back(seed);
+                    }
                 }
+            } else {
+                params.url_seeds = std::move(seeds);
             }
-            if (!trackers.empty()) {
-                params.trackers = apply_tracker_auth(trackers, auth);
-            }
+        }
 
-            if (overrides.has_private && overrides.private_flag) {
-                bool has_tracker = !params.trackers.empty();
-                if (!has_tracker && params.ti) {
-                    has_tracker = !params.ti->trackers().empty();
-                }
-                if (!has_tracker) {
-                    return ::rust::String("private torrents require at least one tracker");
-                }
-            }
+        if (request.has_storage_mode) {
+            params.storage_mode = to_storage_mode(request.storage_mode);
+        } else {
+            params.storage_mode = default_storage_mode_;
+        }
 
-            if (request.tracker_auth.has_cookie) {
-                params.trackerid = to_std_string(request.tracker_auth.cookie);
-            } else if (has_tracker_cookie_) {
-                params.trackerid = tracker_cookie_;
-            }
+        const bool sequential =
+            request.has_sequential_override ? request.sequential : sequential_default_;
+        if (sequential) {
+            params.flags |= lt::torrent_flags::sequential_download;
+        } else {
+            params.flags &= ~lt::torrent_flags::sequential_download;
+        }
 
-            if (!request.web_seeds.empty()) {
-                std::vector<std::string> seeds;
-                seeds.reserve(request.web_seeds.size());
-                for (const auto& seed : request.web_seeds) {
-                    seeds.push_back(to_std_string(seed));
-                }
-                if (request.replace_web_seeds) {
-                    params.url_seeds = std::move(seeds);
-                } else if (!params.url_seeds.empty()) {
-                    std::unordered_set<std::string> seen;
-                    for (const auto& existing : params.url_seeds) {
-                        seen.insert(existing);
-                    }
-                    for (const auto& seed : seeds) {
-                        if (seen.insert(seed).second) {
-                            params.url_seeds.push_back(seed);
-                        }
-                    }
-                } else {
-                    params.url_seeds = std::move(seeds);
+        (void)request.tags;
+        return {};
+    }
+
+    static int queue_position_for(const AddTorrentRequest& request) {
+        return request.has_queue_position && request.queue_position >= 0
+            ? request.queue_position
+            : -1;
+    }
+
+    // Indexes a newly admitted handle under its torrent slot and queues its first status pull.
+    void register_handle(const TorrentKey& id,
+                         const lt::torrent_handle& handle,
+                         int queue_position,
+                         const std::shared_ptr<lt::torrent_info>& info) {
+        const auto slot = torrents_.acquire(id);
+        forget_handle(slot);
+        torrents_.handles[slot] = handle;
+        const auto* identity = torrent_identity(handle);
+        torrents_.identities[slot] = identity;
+        if (identity != nullptr) {
+            torrent_slots_[identity] = slot;
+        }
+        auto& snapshot = torrents_.snapshots[slot];
+        snapshot = TorrentSnapshot{};
+        status_refresh_.insert(slot);
+        if (info && info->is_valid()) {
+            snapshot.metadata = metadata_.acquire(id, info).metadata;
+        }
+        if (queue_position >= 0) {
+            handle.queue_position_set(lt::queue_position_t{queue_position});
+        }
+        if (auto* pending = torrents_.pending_updates.find(slot)) {
+            for (auto& update : *pending) {
+                // Each update was accepted when it was made, so a failure now is reported on
+                // the next poll rather than failing the admission.
+                try {
+                    update(*torrents_.handles[slot]);
+                } catch (const std::exception& ex) {
+                    deferred_events_.push_back(add_error_event(
+                        id, std::string("queued update failed after admission: ") + ex.what()));
                 }
             }
+            torrents_.pending_updates.erase(slot);
+        }
+    }
 
-            if (request.has_storage_mode) {
-                params.storage_mode = to_storage_mode(request.storage_mode);
-            } else {
-                params.storage_mode = default_storage_mode_;
-            }
+    // Adds whose payload is read before admission: a seed-mode hash sample or a pre-verify.
+    static bool needs_payload_check(const AddTorrentRequest& request) {
+        return request.pre_verify
+            || (request.has_hash_check_sample && request.hash_check_sample_pct > 0);
+    }
 
-            lt::torrent_handle handle = session_->add_torrent(params);
-            handles_[request_id] = handle;
-            snapshots_[request_id] = TorrentSnapshot{};
+    // Queues the payload check for `params` on its device. The torrent is admitted from
+    // poll_events once the check passes; until then handle updates wait on its slot.
+    void submit_verify(const AddTorrentRequest& request, lt::add_torrent_params params) {
+        const TorrentKey id = request.id;
+        auto job = std::make_shared<VerifyJob>();
+        job->id = id;
+        job->params = std::move(params);
+        job->queue_position = queue_position_for(request);
+        job->sample_pct = request.has_hash_check_sample ? request.hash_check_sample_pct : 0;
+        job->verify_pieces = request.pre_verify;
+        job->waker = alert_waker_ ? &**alert_waker_ : nullptr;
+        job->pieces_total = static_cast<std::uint32_t>(std::max(0, job->params.ti->num_pieces()));
+        verify_jobs_.push_back(job);
+        try {
+            verifier_.submit(job);
+        } catch (...) {
+            verify_jobs_.pop_back();
+            throw;
+        }
+        torrents_.pending_updates.assign(torrents_.acquire(id), {});
+    }
 
-            if (request.has_queue_position && request.queue_position >= 0) {
-                handle.queue_position_set(lt::queue_position_t{request.queue_position});
+    // Reports how far each running pre-verify has hashed, once per change.
+    void collect_verify_progress(rust::Vec<NativeEvent>& events) {
+        for (auto& job : verify_jobs_) {
+            if (job->cancel.load(std::memory_order_relaxed)) {
+                continue;
             }
-
-            if (request.has_max_connections && request.max_connections > 0) {
-                handle.set_max_connections(request.max_connections);
+            const auto done = job->pieces_done.load(std::memory_order_relaxed);
+            if (done == job->reported_pieces) {
+                continue;
             }
+            job->reported_pieces = done;
+            NativeEvent evt{};
+            evt.id = format_torrent_key(job->id);
+            evt.kind = NativeEventKind::VerifyProgress;
+            evt.state = NativeTorrentState::Queued;
+            evt.pieces_done = done;
+            evt.pieces_total = job->pieces_total;
+            events.push_back(std::move(evt));
+        }
+    }
 
-            bool sequential = sequential_default_;
-            if (request.has_sequential_override) {
-                sequential = request.sequential;
+    // Admits torrents whose payload check has finished. Verified pieces become resume data
+    // so libtorrent skips its own check, and a fully verified payload starts in seed mode.
+    void admit_verified(rust::Vec<NativeEvent>& events) {
+        for (auto it = verify_jobs_.begin(); it != verify_jobs_.end();) {
+            auto& job = **it;
+            if (!job.finished.load(std::memory_order_acquire)) {
+                ++it;
+                continue;
             }
-            if (sequential) {
-                handle.set_flags(lt::torrent_flags::sequential_download);
-            } else {
-                handle.unset_flags(lt::torrent_flags::sequential_download);
+            const auto slot = torrents_.find(job.id);
+            if (!job.cancel.load(std::memory_order_relaxed)
+                && torrents_.pending_updates.contains(slot)) {
+                std::string error = job.error;
+                if (error.empty()) {
+                    auto params = std::move(job.params);
+                    if (job.verify_pieces) {
+                        const bool fully_verified =
+                            job.verified.size() > 0 && job.verified.all_set();
+                        params.have_pieces = std::move(job.verified);
+                        if (fully_verified) {
+                            params.flags |= lt::torrent_flags::seed_mode;
+                        }
+                    }
+                    const auto key = async_add_key(params);
+                    if (pending_adds_.count(key) != 0) {
+                        error = "add failed: info hash already being added";
+                    } else {
+                        try {
+                            session_->async_add_torrent(std::move(params));
+                            pending_adds_.emplace(
+                                key, PendingAdd{job.id, job.queue_position, false, true});
+                        } catch (const std::exception& ex) {
+                            error = std::string("add failed: ") + ex.what();
+                        }
+                    }
+                }
+                if (!error.empty()) {
+                    events.push_back(add_error_event(job.id, error));
+                    abandon_admission(slot);
+                }
             }
+            it = verify_jobs_.erase(it);
+        }
+    }
 
-            (void)request.tags;
-        } catch (const std::exception& ex) {
-            return ::rust::String(ex.what());
+    // Drops the updates and selection held for an admission that will not happen.
+    void abandon_admission(std::uint32_t slot) {
+        if (!torrents_.pending_updates.contains(slot)) {
+            return;
         }
-        return ::rust::String();
+        torrents_.pending_updates.erase(slot);
+        torrents_.selection_rules.erase(slot);
+        torrents_.release_if_unused(slot);
     }
 
-    ::rust::String remove_torrent(::rust::Str id, bool with_data) {
-        const std::string key = to_std_string(id);
-        auto it = handles_.find(key);
-        if (it == handles_.end()) {
+public:
+    ::rust::String remove_torrent(TorrentKey id, bool with_data) {
+        const auto slot = torrents_.find(id);
+        if (!torrents_.loaded(slot)) {
+            // A torrent still being verified is simply never admitted.
+            for (auto& job : verify_jobs_) {
+                if (TorrentKeyEqual{}(job->id, id)) {
+                    job->cancel.store(true, std::memory_order_relaxed);
+                }
+            }
+            abandon_admission(slot);
             return ::rust::String();
         }
         try {
@@ -1400,32 +3109,33 @@ public:
             if (with_data) {
                 flags = lt::session::delete_files;
             }
-            session_->remove_torrent(it->second, flags);
-            handles_.erase(it);
-            snapshots_.erase(key);
-            selection_rules_.erase(key);
+            session_->remove_torrent(*torrents_.handles[slot], flags);
+            forget_handle(slot);
+            status_refresh_.erase(slot);
+            torrents_.selection_rules.erase(slot);
+            torrents_.unload(slot);
         } catch (const std::exception& ex) {
             return ::rust::String(ex.what());
         }
         return ::rust::String();
     }
 
-    ::rust::String pause_torrent(::rust::Str id) {
-        return mutate_handle(to_std_string(id), [](lt::torrent_handle& handle) {
+    ::rust::String pause_torrent(TorrentKey id) {
+        return mutate_handle(id, [](lt::torrent_handle& handle) {
             handle.unset_flags(lt::torrent_flags::auto_managed);
             handle.pause();
         });
     }
 
-    ::rust::String resume_torrent(::rust::Str id) {
-        return mutate_handle(to_std_string(id), [](lt::torrent_handle& handle) {
+    ::rust::String resume_torrent(TorrentKey id) {
+        return mutate_handle(id, [](lt::torrent_handle& handle) {
             handle.set_flags(lt::torrent_flags::auto_managed);
             handle.resume();
         });
     }
 
-    ::rust::String set_sequential(::rust::Str id, bool sequential) {
-        return mutate_handle(to_std_string(id), [sequential](lt::torrent_handle& handle) {
+    ::rust::String set_sequential(TorrentKey id, bool sequential) {
+        return mutate_handle(id, [sequential](lt::torrent_handle& handle) {
             if (sequential) {
                 handle.set_flags(lt::torrent_flags::sequential_download);
             } else {
@@ -1434,12 +3144,66 @@ public:
         });
     }
 
-    ::rust::String load_fastresume(::rust::Str id,
+    ::rust::String load_fastresume(TorrentKey id,
                                    rust::Slice<const std::uint8_t> data) {
-        std::vector<char> buffer;
-        buffer.resize(data.size());
-        std::copy(data.begin(), data.end(), buffer.begin());
-        pending_resume_[to_std_string(id)] = std::move(buffer);
+        // Decode straight from the borrowed slice so the blob is never buffered on this side.
+        lt::error_code resume_ec;
+        auto params = lt::read_resume_data(
+            lt::span<const char>(reinterpret_cast<const char*>(data.data()),
+                                 static_cast<long>(data.size())),
+            resume_ec);
+        if (resume_ec) {
+            return ::rust::String("resume data parse failed: " + resume_ec.message());
+        }
+        torrents_.pending_resume.assign(torrents_.acquire(id), std::move(params));
+        return ::rust::String();
+    }
+
+    ::rust::String restore_torrents(rust::Slice<const RestoreTorrentRequest> requests) {
+        try {
+            auto decoded = decode_resume_batch(requests);
+            restore_batch_.active = true;
+            for (std::size_t idx = 0; idx < requests.size(); ++idx) {
+                const auto& request = requests[idx];
+                const auto& id = request.id;
+                const auto slot = torrents_.find(id);
+                auto& entry = decoded[idx];
+                auto& params = entry.params;
+                ++restore_batch_.submitted;
+                if (entry.error.empty() && torrents_.loaded(slot)) {
+                    entry.error = "torrent already present in session";
+                }
+                if (entry.error.empty()) {
+                    if (request.has_download_dir) {
+                        params.save_path = to_std_string(request.download_dir);
+                    } else if (params.save_path.empty()) {
+                        params.save_path = default_download_root_;
+                    }
+                    if (params.save_path.empty()) {
+                        entry.error = "download directory not configured";
+                    }
+                }
+                if (entry.error.empty()
+                    && !pending_adds_.emplace(async_add_key(params), PendingAdd{id, -1, true})
+                            .second) {
+                    entry.error = "info hash already being added";
+                }
+                if (!entry.error.empty()) {
+                    deferred_events_.push_back(
+                        add_error_event(id, "restore failed: " + entry.error));
+                    continue;
+                }
+                // Selection, sequential and limit updates the worker re-applies from its
+                // resume metadata wait on the slot until the add_torrent_alert arrives.
+                const auto pending_slot = torrents_.acquire(id);
+                torrents_.pending_resume.erase(pending_slot);
+                torrents_.pending_updates.assign(pending_slot, {});
+                ++restore_batch_.pending;
+                session_->async_add_torrent(std::move(params));
+            }
+        } catch (const std::exception& ex) {
+            return ::rust::String(ex.what());
+        }
         return ::rust::String();
     }
 
@@ -1457,21 +3221,15 @@ public:
                                  : -1);
                 session_->apply_settings(pack);
             } else {
-                const auto key = to_std_string(request.id);
-                auto it = handles_.find(key);
-                if (it == handles_.end()) {
-                    return ::rust::String();
-                }
-                if (request.download_bps >= 0) {
-                    it->second.set_download_limit(static_cast<int>(request.download_bps));
-                } else {
-                    it->second.set_download_limit(-1);
-                }
-                if (request.upload_bps >= 0) {
-                    it->second.set_upload_limit(static_cast<int>(request.upload_bps));
-                } else {
-                    it->second.set_upload_limit(-1);
-                }
+                const int download = request.download_bps >= 0
+                                         ? static_cast<int>(request.download_bps)
+                                         : -1;
+                const int upload =
+                    request.upload_bps >= 0 ? static_cast<int>(request.upload_bps) : -1;
+                return mutate_handle(request.id, [download, upload](lt::torrent_handle& handle) {
+                    handle.set_download_limit(download);
+                    handle.set_upload_limit(upload);
+                });
             }
         } catch (const std::exception& ex) {
             return ::rust::String(ex.what());
@@ -1484,29 +3242,21 @@ public:
         entry.skip_fluff = rules.skip_fluff;
         entry.overrides.assign(rules.priorities.begin(), rules.priorities.end());
 
-        entry.include.reserve(rules.include.size());
-        for (const auto& pattern : rules.include) {
-            entry.include.emplace_back(glob_to_regex(to_std_string(pattern)), std::regex::icase);
-        }
-
-        entry.exclude.reserve(rules.exclude.size());
-        for (const auto& pattern : rules.exclude) {
-            entry.exclude.emplace_back(glob_to_regex(to_std_string(pattern)), std::regex::icase);
-        }
+        entry.include = compile_globs(rules.include);
+        entry.exclude = compile_globs(rules.exclude);
 
-        const auto key = to_std_string(rules.id);
-        selection_rules_[key] = std::move(entry);
+        const auto slot = torrents_.acquire(rules.id);
+        torrents_.selection_rules.assign(slot, std::move(entry));
 
-        auto it = handles_.find(key);
-        if (it != handles_.end()) {
-            if (!it->second.is_valid()) {
-                drop_torrent_state(key);
+        if (torrents_.loaded(slot)) {
+            if (!torrents_.handles[slot]->is_valid()) {
+                drop_torrent_state(slot);
                 return ::rust::String(kInvalidHandleMessage);
             }
             try {
-                apply_selection(it->first, it->second);
+                apply_selection(slot);
             } catch (const std::exception& ex) {
-                drop_torrent_state(key);
+                drop_torrent_state(slot);
                 return ::rust::String(ex.what());
             }
         }
@@ -1514,14 +3264,14 @@ public:
     }
 
     ::rust::String update_options(const UpdateOptionsRequest& request) {
-        const auto key = to_std_string(request.id);
         if (request.has_private) {
             return ::rust::String("private flag updates are not supported");
         }
         if (request.has_source) {
             return ::rust::String("source updates are not supported");
         }
-        return mutate_handle(key, [&](lt::torrent_handle& handle) {
+        // Captured by value: a torrent still being verified applies this on admission.
+        return mutate_handle(request.id, [request](lt::torrent_handle& handle) {
             if (request.has_max_connections) {
                 handle.set_max_connections(request.max_connections);
             }
@@ -1553,30 +3303,32 @@ public:
     }
 
     ::rust::String update_trackers(const UpdateTrackersRequest& request) {
-        const auto key = to_std_string(request.id);
         const AuthView auth{
             .username = tracker_username_,
             .password = tracker_password_,
             .has_username = has_tracker_username_,
             .has_password = has_tracker_password_,
         };
-        return mutate_handle(key, [&](lt::torrent_handle& handle) {
+        std::vector<std::string> requested;
+        for (const auto& tracker : request.trackers) {
+            auto url = to_std_string(tracker);
+            if (!url.empty()) {
+                requested.push_back(inject_basic_auth(url, auth));
+            }
+        }
+        const bool replace = request.replace;
+        return mutate_handle(request.id, [requested, replace](lt::torrent_handle& handle) {
             std::vector<lt::announce_entry> trackers;
-            if (!request.replace) {
+            if (!replace) {
                 trackers = handle.trackers();
             }
             std::unordered_set<std::string> seen;
             for (const auto& entry : trackers) {
                 seen.insert(entry.url);
             }
-            for (const auto& tracker : request.trackers) {
-                auto url = to_std_string(tracker);
-                if (url.empty()) {
-                    continue;
-                }
-                auto rewritten = inject_basic_auth(url, auth);
-                if (seen.insert(rewritten).second) {
-                    trackers.emplace_back(rewritten);
+            for (const auto& url : requested) {
+                if (seen.insert(url).second) {
+                    trackers.emplace_back(url);
                 }
             }
             if (!trackers.empty()) {
@@ -1586,21 +3338,22 @@ public:
     }
 
     ::rust::String update_web_seeds(const UpdateWebSeedsRequest& request) {
-        const auto key = to_std_string(request.id);
-        return mutate_handle(key, [&](lt::torrent_handle& handle) {
-            std::unordered_set<std::string> seeds;
-            if (!request.replace) {
+        std::vector<std::string> requested;
+        for (const auto& seed : request.web_seeds) {
+            auto value = to_std_string(seed);
+            if (!value.empty()) {
+                requested.push_back(std::move(value));
+            }
+        }
+        const bool replace = request.replace;
+        return mutate_handle(request.id, [requested, replace](lt::torrent_handle& handle) {
+            std::unordered_set<std::string> seeds(requested.begin(), requested.end());
+            if (!replace) {
                 for (const auto& seed : handle.url_seeds()) {
                     seeds.insert(seed);
                 }
             }
-            for (const auto& seed : request.web_seeds) {
-                auto value = to_std_string(seed);
-                if (!value.empty()) {
-                    seeds.insert(std::move(value));
-                }
-            }
-            if (request.replace) {
+            if (replace) {
                 for (const auto& existing : handle.url_seeds()) {
                     if (seeds.find(existing) == seeds.end()) {
                         handle.remove_url_seed(existing);
@@ -1614,27 +3367,26 @@ public:
     }
 
     ::rust::String move_torrent(const MoveTorrentRequest& request) {
-        const auto key = to_std_string(request.id);
         const auto target = to_std_string(request.download_dir);
-        return mutate_handle(key, [&](lt::torrent_handle& handle) {
+        return mutate_handle(request.id, [target](lt::torrent_handle& handle) {
             handle.move_storage(target, lt::move_flags_t::dont_replace);
         });
     }
 
-    ::rust::String reannounce(::rust::Str id) {
-        return mutate_handle(to_std_string(id), [](lt::torrent_handle& handle) {
+    ::rust::String reannounce(TorrentKey id) {
+        return mutate_handle(id, [](lt::torrent_handle& handle) {
             handle.force_reannounce();
         });
     }
 
-    ::rust::String recheck(::rust::Str id) {
-        return mutate_handle(to_std_string(id), [](lt::torrent_handle& handle) {
+    ::rust::String recheck(TorrentKey id) {
+        return mutate_handle(id, [](lt::torrent_handle& handle) {
             handle.force_recheck();
         });
     }
 
-    ::rust::String set_piece_deadline(::rust::Str id, std::uint32_t piece, std::int32_t deadline_ms, bool has_deadline) {
-        return mutate_handle(to_std_string(id), [piece, deadline_ms, has_deadline](lt::torrent_handle& handle) {
+    ::rust::String set_piece_deadline(TorrentKey id, std::uint32_t piece, std::int32_t deadline_ms, bool has_deadline) {
+        return mutate_handle(id, [piece, deadline_ms, has_deadline](lt::torrent_handle& handle) {
             lt::piece_index_t target{static_cast<int>(piece)};
             if (has_deadline) {
                 handle.set_piece_deadline(target, deadline_ms);
@@ -1644,22 +3396,45 @@ public:
         });
     }
 
-    rust::Vec<NativePeerInfo> list_peers(::rust::Str id) {
+    rust::Vec<NativeFile> list_files(TorrentKey id, std::uint32_t offset, std::uint32_t limit) {
+        rust::Vec<NativeFile> files;
+        const auto slot = torrents_.find(id);
+        if (!torrents_.loaded(slot)) {
+            return files;
+        }
+        const auto* metadata = torrents_.snapshots[slot].metadata.get();
+        if (metadata == nullptr) {
+            return files;
+        }
+        const auto total = metadata->file_paths.size();
+        const auto begin = std::min<std::size_t>(offset, total);
+        const auto end = std::min<std::size_t>(begin + limit, total);
+        files.reserve(end - begin);
+        for (std::size_t idx = begin; idx < end; ++idx) {
+            NativeFile file{};
+            file.index = static_cast<std::uint32_t>(idx);
+            file.path = metadata->file_paths[idx];
+            file.size_bytes = metadata->file_sizes[idx];
+            files.push_back(std::move(file));
+        }
+        return files;
+    }
+
+    rust::Vec<NativePeerInfo> list_peers(TorrentKey id) {
         rust::Vec<NativePeerInfo> peers_out;
-        const auto key = to_std_string(id);
-        auto it = handles_.find(key);
-        if (it == handles_.end()) {
+        const auto slot = torrents_.find(id);
+        if (!torrents_.loaded(slot)) {
             return peers_out;
         }
-        if (!it->second.is_valid()) {
-            drop_torrent_state(key);
+        if (!torrents_.handles[slot]->is_valid()) {
+            drop_torrent_state(slot);
             return peers_out;
         }
         std::vector<lt::peer_info> peers;
         try {
-            it->second.get_peer_info(peers);
+            torrents_.handles[slot]->get_peer_info(peers);
         } catch (const std::exception&) {
-            drop_torrent_state(key);
+            drop_torrent_state(slot);
             return peers_out;
         }
         peers_out.reserve(peers.size());
@@ -1686,9 +3461,11 @@ public:
         return peers_out;
     }
 
-    rust::Vec<NativeEvent> poll_events() {
-        rust::Vec<NativeEvent> events;
-        std::unordered_set<std::string> stale_ids;
+    NativeEventBatch poll_events() {
+        NativeEventBatch batch;
+        auto& events = batch.events;
+        auto& updates = batch.updates;
+        std::unordered_set<std::uint32_t> stale_slots;
 
         auto push_session_error = [&events](
                                       std::string component,
@@ -1703,11 +3480,20 @@ public:
             events.push_back(std::move(evt));
         };
 
+        for (auto& deferred : deferred_events_) {
+            events.push_back(std::move(deferred));
+        }
+        deferred_events_.clear();
+
         std::vector<lt::alert*> alerts;
         session_->pop_alerts(&alerts);
         for (lt::alert* alert : alerts) {
+            if (auto* added = lt::alert_cast<lt::add_torrent_alert>(alert)) {
+                complete_async_add(*added, events);
+            }
             if (auto* err = lt::alert_cast<lt::torrent_error_alert>(alert)) {
-                auto id = find_torrent_id(err->handle);
+                const auto slot = find_slot(err->handle);
+                const auto id = torrents_.id(slot);
                 if (!id.empty()) {
                     NativeEvent evt{};
                     evt.id = id;
@@ -1718,7 +3504,8 @@ public:
                 }
             }
             if (auto* tracker_err = lt::alert_cast<lt::tracker_error_alert>(alert)) {
-                auto id = find_torrent_id(tracker_err->handle);
+                const auto slot = find_slot(tracker_err->handle);
+                const auto id = torrents_.id(slot);
                 if (!id.empty()) {
                     NativeEvent evt{};
                     evt.id = id;
@@ -1740,7 +3527,8 @@ public:
                 push_session_error("portmap", portmap_err->error.message(), std::string());
             }
             if (auto* storage_err = lt::alert_cast<lt::file_error_alert>(alert)) {
-                auto id = find_torrent_id(storage_err->handle);
+                const auto slot = find_slot(storage_err->handle);
+                const auto id = torrents_.id(slot);
                 NativeEvent evt{};
                 evt.id = id;
                 evt.kind = NativeEventKind::Error;
@@ -1750,7 +3538,8 @@ public:
                 push_session_error("storage", storage_err->error.message(), id);
             }
             if (auto* tracker_warn = lt::alert_cast<lt::tracker_warning_alert>(alert)) {
-                auto id = find_torrent_id(tracker_warn->handle);
+                const auto slot = find_slot(tracker_warn->handle);
+                const auto id = torrents_.id(slot);
                 if (!id.empty()) {
                     NativeEvent evt{};
                     evt.id = id;
@@ -1767,255 +3556,224 @@ public:
             }
             if (auto* tracker_err =
                     lt::alert_cast<lt::tracker_error_alert>(alert)) {
-                auto id = find_torrent_id(tracker_err->handle);
+                const auto slot = find_slot(tracker_err->handle);
+                const auto id = torrents_.id(slot);
                 push_session_error("tracker", tracker_err->error.message(), id);
             }
             if (auto* peer_ban = lt::alert_cast<lt::peer_ban_alert>(alert)) {
-                auto id = find_torrent_id(peer_ban->handle);
+                const auto slot = find_slot(peer_ban->handle);
+                const auto id = torrents_.id(slot);
                 push_session_error("peer", peer_ban->message(), id);
             }
             if (auto* peer_error = lt::alert_cast<lt::peer_error_alert>(alert)) {
-                auto id = find_torrent_id(peer_error->handle);
+                const auto slot = find_slot(peer_error->handle);
+                const auto id = torrents_.id(slot);
                 push_session_error("peer", peer_error->message(), id);
             }
             if (auto* peer_blocked =
                     lt::alert_cast<lt::peer_blocked_alert>(alert)) {
-                auto id = find_torrent_id(peer_blocked->handle);
+                const auto slot = find_slot(peer_blocked->handle);
+                const auto id = torrents_.id(slot);
                 push_session_error("peer", peer_blocked->message(), id);
             }
             if (auto* cert = lt::alert_cast<lt::torrent_need_cert_alert>(alert)) {
-                auto id = find_torrent_id(cert->handle);
+                const auto slot = find_slot(cert->handle);
+                const auto id = torrents_.id(slot);
                 push_session_error("ssl", cert->message(), id);
             }
             if (auto* moved = lt::alert_cast<lt::storage_moved_alert>(alert)) {
-                auto id = find_torrent_id(moved->handle);
-                auto snapshot = snapshots_.find(id);
-                if (!id.empty() && snapshot != snapshots_.end()) {
+                const auto slot = find_slot(moved->handle);
+                const auto id = torrents_.id(slot);
+                if (torrents_.loaded(slot)) {
+                    auto& snapshot = torrents_.snapshots[slot];
                     NativeEvent evt{};
                     evt.id = id;
                     evt.kind = NativeEventKind::MetadataUpdated;
-                    evt.state = snapshot->second.state;
-                    evt.name = snapshot->second.last_name;
+                    evt.state = snapshot.state;
+                    evt.name = snapshot.last_name;
                     evt.download_dir = moved->storage_path();
-                    if (auto info = moved->handle.torrent_file()) {
-                        const auto details = extract_metainfo_details(*info);
-                        evt.comment = details.comment;
-                        evt.source = details.source;
-                        evt.private_flag = details.private_flag;
-                        evt.has_private = details.has_private;
+                    const auto* metadata = snapshot.metadata
+                        ? snapshot.metadata.get()
+                        : memoize_metadata(slot, moved->handle.torrent_file());
+                    if (metadata != nullptr) {
+                        evt.comment = metadata->details.comment;
+                        evt.source = metadata->details.source;
+                        evt.private_flag = metadata->details.private_flag;
+                        evt.has_private = metadata->details.has_private;
                     }
                     events.push_back(evt);
-                    snapshot->second.last_download_dir = moved->storage_path();
+                    snapshot.last_download_dir = moved->storage_path();
                 }
             }
             if (auto* move_failed = lt::alert_cast<lt::storage_moved_failed_alert>(alert)) {
-                auto id = find_torrent_id(move_failed->handle);
-                auto snapshot = snapshots_.find(id);
-                if (!id.empty() && snapshot != snapshots_.end()) {
+                const auto slot = find_slot(move_failed->handle);
+                const auto id = torrents_.id(slot);
+                if (torrents_.loaded(slot)) {
+                    auto& snapshot = torrents_.snapshots[slot];
                     NativeEvent evt{};
                     evt.id = id;
                     evt.kind = NativeEventKind::Error;
-                    evt.state = snapshot->second.state;
+                    evt.state = snapshot.state;
                     evt.message = move_failed->error.message();
                     events.push_back(evt);
                 }
             }
             if (auto* resume = lt::alert_cast<lt::save_resume_data_alert>(alert)) {
-                auto id = find_torrent_id(resume->handle);
-                auto snapshot = snapshots_.find(id);
-                if (!id.empty() && snapshot != snapshots_.end()) {
+                const auto slot = find_slot(resume->handle);
+                const auto id = torrents_.id(slot);
+                if (torrents_.loaded(slot)) {
+                    auto& snapshot = torrents_.snapshots[slot];
                     auto buffer = lt::write_resume_data_buf(resume->params);
                     NativeEvent evt{};
                     evt.id = id;
                     evt.kind = NativeEventKind::ResumeData;
-                    evt.state = snapshot->second.state;
-                    evt.resume_data = rust::Vec<std::uint8_t>();
-                    evt.resume_data.reserve(buffer.size());
-                    for (auto byte : buffer) {
-                        evt.resume_data.push_back(static_cast<std::uint8_t>(byte));
-                    }
-                    events.push_back(evt);
-                    snapshot->second.resume_requested = false;
+                    evt.state = snapshot.state;
+                    evt.resume_data = to_rust_bytes(buffer);
+                    events.push_back(std::move(evt));
+                    snapshot.resume_requested = false;
                 }
             }
             if (auto* resume_failed = lt::alert_cast<lt::save_resume_data_failed_alert>(alert)) {
-                auto id = find_torrent_id(resume_failed->handle);
-                auto snapshot = snapshots_.find(id);
-                if (!id.empty() && snapshot != snapshots_.end()) {
+                const auto slot = find_slot(resume_failed->handle);
+                const auto id = torrents_.id(slot);
+                if (torrents_.loaded(slot)) {
+                    auto& snapshot = torrents_.snapshots[slot];
                     NativeEvent evt{};
                     evt.id = id;
                     evt.kind = NativeEventKind::Error;
-                    evt.state = snapshot->second.state;
+                    evt.state = snapshot.state;
                     evt.message = resume_failed->message();
                     events.push_back(evt);
-                    snapshot->second.resume_requested = false;
+                    snapshot.resume_requested = false;
+                }
+            }
+            if (auto* stats = lt::alert_cast<lt::session_stats_alert>(alert)) {
+                const auto counters = stats->counters();
+                session_stats_.assign(counters.begin(), counters.end());
+                ++session_stats_sequence_;
+            }
+            if (auto* file_done = lt::alert_cast<lt::file_completed_alert>(alert)) {
+                note_file_completed(find_slot(file_done->handle),
+                                    static_cast<std::size_t>(static_cast<int>(file_done->index)),
+                                    events,
+                                    updates);
+            }
+            if (auto* file_progress = lt::alert_cast<lt::file_progress_alert>(alert)) {
+                apply_file_progress(
+                    find_slot(file_progress->handle), *file_progress, events, updates);
+            }
+            if (auto* state_updates = lt::alert_cast<lt::state_update_alert>(alert)) {
+                for (const lt::torrent_status& status : state_updates->status) {
+                    const auto slot = find_slot(status.handle);
+                    if (slot == 0) {
+                        continue;
+                    }
+                    status_refresh_.erase(slot);
+                    apply_status_update(slot, status, events, updates, stale_slots);
                 }
             }
         }
 
-        for (auto& [id, handle] : handles_) {
+        for (auto it = status_refresh_.begin(); it != status_refresh_.end();) {
+            const std::uint32_t slot = *it;
+            it = status_refresh_.erase(it);
+            if (!torrents_.loaded(slot)) {
+                continue;
+            }
+            const auto& handle = *torrents_.handles[slot];
             if (!handle.is_valid()) {
-                note_invalid_handle(id, events, stale_ids, kInvalidHandleMessage);
+                note_invalid_handle(slot, events, stale_slots, kInvalidHandleMessage);
                 continue;
             }
             lt::torrent_status status;
             try {
-                status = handle.status(
-                    lt::torrent_handle::query_name | lt::torrent_handle::query_save_path |
-                    lt::torrent_handle::query_pieces | lt::torrent_handle::query_torrent_file);
+                status = handle.status(kStatusQueryFlags);
             } catch (const std::exception& ex) {
-                note_invalid_handle(id, events, stale_ids, ex.what());
+                note_invalid_handle(slot, events, stale_slots, ex.what());
                 continue;
             }
+            apply_status_update(slot, status, events, updates, stale_slots);
+        }
 
-            auto& snapshot = snapshots_[id];
-            NativeTorrentState current_state = map_state(status.state);
+        const auto now = std::chrono::steady_clock::now();
+        schedule_resume_saves(now, events, stale_slots);
 
-            if (status.errc) {
-                NativeEvent evt{};
-                evt.id = id;
-                evt.kind = NativeEventKind::Error;
-                evt.state = NativeTorrentState::Failed;
-                evt.message = status.errc.message();
-                events.push_back(evt);
-            }
+        for (const auto slot : stale_slots) {
+            drop_torrent_state(slot);
+        }
 
-            if (!snapshot.metadata_emitted) {
-                try {
-                    auto info = handle.torrent_file();
-                    if (info) {
-                        NativeEvent files_evt{};
-                        files_evt.id = id;
-                        files_evt.kind = NativeEventKind::FilesDiscovered;
-                        files_evt.state = current_state;
-                        files_evt.name = info->name();
-                        files_evt.download_dir = status.save_path;
-                        files_evt.files = rust::Vec<NativeFile>();
-                        for (lt::file_index_t idx : info->files().file_range()) {
-                            NativeFile file{};
-                            file.index = static_cast<std::uint32_t>(static_cast<int>(idx));
-                            file.path = info->files().file_path(idx);
-                            file.size_bytes = static_cast<std::uint64_t>(info->files().file_size(idx));
-                            files_evt.files.push_back(std::move(file));
-                        }
-                        events.push_back(files_evt);
-
-                        const auto details = extract_metainfo_details(*info);
-                        NativeEvent meta_evt{};
-                        meta_evt.id = id;
-                        meta_evt.kind = NativeEventKind::MetadataUpdated;
-                        meta_evt.state = current_state;
-                        meta_evt.name = info->name();
-                        meta_evt.download_dir = status.save_path;
-                        meta_evt.comment = details.comment;
-                        meta_evt.source = details.source;
-                        meta_evt.private_flag = details.private_flag;
-                        meta_evt.has_private = details.has_private;
-                        events.push_back(meta_evt);
-
-                        apply_selection(id, handle);
-                        snapshot.metadata_applied = true;
-                        snapshot.last_name = info->name();
-                        snapshot.last_download_dir = status.save_path;
-                        snapshot.metadata_emitted = true;
-                    }
-                } catch (const std::exception& ex) {
-                    note_invalid_handle(id, events, stale_ids, ex.what());
-                    continue;
-                }
-            }
+        // Ask libtorrent for the next batch of changed torrents; the answer arrives as a
+        // state_update_alert that the following poll consumes. Throttled so the alert
+        // wakeup for that answer does not immediately request another batch.
+        if (now - last_status_post_ >= kStatusUpdateInterval - kStatusUpdateSlack) {
+            session_->post_torrent_updates(kStatusQueryFlags);
+            last_status_post_ = now;
+        }
+        // Session counters answer with a session_stats_alert, captured for inspection.
+        if (now - last_stats_post_ >= kSessionStatsInterval) {
+            session_->post_session_stats();
+            last_stats_post_ = now;
+        }
 
-            if (snapshot.last_name != status.name || snapshot.last_download_dir != status.save_path) {
-                NativeEvent meta{};
-                meta.id = id;
-                meta.kind = NativeEventKind::MetadataUpdated;
-                meta.state = current_state;
-                meta.name = status.name;
-                meta.download_dir = status.save_path;
-                try {
-                    if (auto info = handle.torrent_file()) {
-                        const auto details = extract_metainfo_details(*info);
-                        meta.comment = details.comment;
-                        meta.source = details.source;
-                        meta.private_flag = details.private_flag;
-                        meta.has_private = details.has_private;
-                    }
-                } catch (const std::exception& ex) {
-                    note_invalid_handle(id, events, stale_ids, ex.what());
-                    continue;
-                }
-                events.push_back(meta);
-                snapshot.last_name = status.name;
-                snapshot.last_download_dir = status.save_path;
-            }
+        collect_authoring_progress(now, events);
+        collect_verify_progress(events);
+        admit_verified(events);
 
-            if (snapshot.state != current_state) {
-                NativeEvent state_evt{};
-                state_evt.id = id;
-                state_evt.kind = NativeEventKind::StateChanged;
-                state_evt.state = current_state;
-                state_evt.name = status.name;
-                state_evt.download_dir = status.save_path;
-                events.push_back(state_evt);
-                snapshot.state = current_state;
-            }
-
-            if (static_cast<std::uint64_t>(status.total_done) != snapshot.bytes_downloaded ||
-                static_cast<std::uint64_t>(status.total_wanted) != snapshot.bytes_total) {
-                NativeEvent progress{};
-                progress.id = id;
-                progress.kind = NativeEventKind::Progress;
-                progress.state = current_state;
-                progress.name = status.name;
-                progress.download_dir = status.save_path;
-                progress.bytes_downloaded = static_cast<std::uint64_t>(status.total_done);
-                progress.bytes_total = static_cast<std::uint64_t>(status.total_wanted);
-                progress.download_bps = static_cast<std::uint64_t>(
-                    status.download_payload_rate > 0 ? status.download_payload_rate : 0);
-                progress.upload_bps = static_cast<std::uint64_t>(
-                    status.upload_payload_rate > 0 ? status.upload_payload_rate : 0);
-                if (status.total_payload_download > 0) {
-                    progress.ratio = static_cast<double>(status.total_payload_upload) /
-                                     static_cast<double>(status.total_payload_download);
-                } else {
-                    progress.ratio = 0.0;
-                }
-                events.push_back(progress);
+        if (restore_batch_.active && restore_batch_.pending == 0) {
+            NativeEvent evt{};
+            evt.kind = NativeEventKind::RestoreFinished;
+            evt.state = NativeTorrentState::Queued;
+            evt.restored = restore_batch_.restored;
+            evt.restore_submitted = restore_batch_.submitted;
+            events.push_back(std::move(evt));
+            restore_batch_ = RestoreBatch{};
+        }
 
-                snapshot.bytes_downloaded = static_cast<std::uint64_t>(status.total_done);
-                snapshot.bytes_total = static_cast<std::uint64_t>(status.total_wanted);
-            }
+        torrents_.finish_poll(batch.bindings);
+        return batch;
+    }
 
-            if (!snapshot.completed_emitted &&
-                (status.is_finished || status.state == lt::torrent_status::seeding)) {
-                NativeEvent completed{};
-                completed.id = id;
-                completed.kind = NativeEventKind::Completed;
-                completed.state = NativeTorrentState::Completed;
-                completed.name = status.name;
-                completed.library_path = status.save_path;
-                events.push_back(completed);
-                snapshot.completed_emitted = true;
-            }
+    EngineMetadataCacheState inspect_metadata_cache_state() const {
+        return metadata_.state();
+    }
 
-            if (status.need_save_resume) {
-                if (!snapshot.resume_requested) {
-                    try {
-                        handle.save_resume_data(lt::torrent_handle::save_resume_flags_t{});
-                        snapshot.resume_requested = true;
-                    } catch (const std::exception& ex) {
-                        note_invalid_handle(id, events, stale_ids, ex.what());
-                        continue;
-                    }
-                }
-            }
+    // Metric names ordered by counter slot, so samples can travel as bare value vectors.
+    rust::Vec<NativeStatsMetric> session_stats_metrics() const {
+        const auto metrics = lt::session_stats_metrics();
+        std::size_t slots = 0;
+        for (const auto& metric : metrics) {
+            slots = std::max(slots, static_cast<std::size_t>(metric.value_index) + 1);
         }
-
-        for (const auto& id : stale_ids) {
-            drop_torrent_state(id);
+        std::vector<NativeStatsMetric> by_slot(slots);
+        for (const auto& metric : metrics) {
+            auto& entry = by_slot[static_cast<std::size_t>(metric.value_index)];
+            entry.name = metric.name;
+            entry.counter = metric.type == lt::metric_type_t::counter;
+        }
+        rust::Vec<NativeStatsMetric> out;
+        out.reserve(slots);
+        for (auto& entry : by_slot) {
+            out.push_back(std::move(entry));
         }
+        return out;
+    }
+
+    EngineTimingState inspect_timing_state() const {
+        return call_timings_.snapshot();
+    }
+
+    CallTimings& call_timings() {
+        return call_timings_;
+    }
 
-        return events;
+    EngineSessionStats inspect_session_stats() const {
+        EngineSessionStats stats{};
+        stats.sequence = session_stats_sequence_;
+        stats.values.reserve(session_stats_.size());
+        for (const auto value : session_stats_) {
+            stats.values.push_back(value);
+        }
+        return stats;
     }
 
     EngineStorageState inspect_storage_state() const {
@@ -2041,6 +3799,9 @@ public:
         snapshot.disk_read_mode = get_int_setting(settings, "disk_io_read_mode", 0);
         snapshot.disk_write_mode = get_int_setting(settings, "disk_io_write_mode", 0);
         snapshot.verify_piece_hashes = !get_bool_setting(settings, "disable_hash_checks", false);
+        snapshot.disk_io_backend = disk_io_backend_;
+        snapshot.aio_threads = settings.get_int(lt::settings_pack::aio_threads);
+        snapshot.hashing_threads = settings.get_int(lt::settings_pack::hashing_threads);
         return snapshot;
     }
 
@@ -2073,89 +3834,522 @@ public:
 
 private:
     template <typename Fn>
-    ::rust::String mutate_handle(const std::string& id, Fn&& fn) {
-        auto it = handles_.find(id);
-        if (it == handles_.end()) {
+    ::rust::String mutate_handle(const TorrentKey& id, Fn&& fn) {
+        const auto slot = torrents_.find(id);
+        if (!torrents_.loaded(slot)) {
+            if (auto* pending = torrents_.pending_updates.find(slot)) {
+                pending->emplace_back(std::forward<Fn>(fn));
+            }
             return ::rust::String();
         }
         try {
-            fn(it->second);
+            fn(*torrents_.handles[slot]);
         } catch (const std::exception& ex) {
             return ::rust::String(ex.what());
         }
         return ::rust::String();
     }
 
-    std::string find_torrent_id(const lt::torrent_handle& handle) const {
-        for (const auto& [id, stored] : handles_) {
-            if (!stored.is_valid()) {
+    // Slot of the torrent behind `handle`, or 0 when it is not tracked.
+    std::uint32_t find_slot(const lt::torrent_handle& handle) const {
+        const auto* identity = torrent_identity(handle);
+        if (identity == nullptr) {
+            return 0;
+        }
+        auto it = torrent_slots_.find(identity);
+        return it == torrent_slots_.end() ? 0 : it->second;
+    }
+
+    // Cached metadata for the torrent in `slot`. Torrents whose metadata arrived after the
+    // add (magnets, resume data without an info dict) adopt `info` on first sight.
+    const MetadataCache::Entry* cached_metadata(
+        std::uint32_t slot, const std::shared_ptr<const lt::torrent_info>& info) {
+        const auto& id = torrents_.keys[slot];
+        if (const auto* entry = metadata_.find(id)) {
+            return entry;
+        }
+        if (!info || !info->is_valid()) {
+            return nullptr;
+        }
+        return &metadata_.acquire(id, info);
+    }
+
+    // Metadata memoized on the slot's snapshot; `info` is only consulted until it is known.
+    const TorrentMetadata* memoize_metadata(std::uint32_t slot,
+                                            const std::shared_ptr<const lt::torrent_info>& info) {
+        auto& snapshot = torrents_.snapshots[slot];
+        if (!snapshot.metadata) {
+            if (const auto* entry = cached_metadata(slot, info)) {
+                snapshot.metadata = entry->metadata;
+            }
+        }
+        return snapshot.metadata.get();
+    }
+
+    void forget_handle(std::uint32_t slot) {
+        metadata_.release(torrents_.keys[slot]);
+        if (!torrents_.loaded(slot)) {
+            return;
+        }
+        // The identity was captured at registration, so this works even after libtorrent has
+        // released the torrent and the handle no longer resolves to it.
+        auto indexed = torrent_slots_.find(torrents_.identities[slot]);
+        if (indexed != torrent_slots_.end() && indexed->second == slot) {
+            torrent_slots_.erase(indexed);
+        }
+        torrents_.identities[slot] = nullptr;
+    }
+
+    void push_file_update(std::uint32_t slot,
+                          std::size_t index,
+                          const TorrentMetadata& metadata,
+                          const rust::Vec<NativeEvent>& events,
+                          rust::Vec<NativeTorrentUpdate>& updates) {
+        NativeTorrentUpdate update{};
+        update.slot = slot;
+        update.position = static_cast<std::uint32_t>(events.size());
+        update.kind = NativeUpdateKind::FileProgress;
+        update.state = torrents_.snapshots[slot].state;
+        update.file_index = static_cast<std::uint32_t>(index);
+        update.bytes_downloaded =
+            static_cast<std::uint64_t>(torrents_.snapshots[slot].file_progress[index]);
+        update.bytes_total = metadata.file_sizes[index];
+        updates.push_back(update);
+    }
+
+    // Asks libtorrent for the torrent's per-file progress without blocking the poll; the
+    // answer arrives as a file_progress_alert. At most one request is outstanding per torrent,
+    // and requests only follow state updates, so the query rate is bounded by the status
+    // interval. A request whose alert never arrives (dropped from a full alert queue) is
+    // abandoned at its deadline. Piece granularity keeps the query cheap: libtorrent sums
+    // finished pieces rather than walking in-flight blocks.
+    void request_file_progress(std::uint32_t slot, const lt::torrent_handle& handle) {
+        auto& snapshot = torrents_.snapshots[slot];
+        const auto now = std::chrono::steady_clock::now();
+        if (snapshot.file_progress_posted && now < snapshot.file_progress_deadline) {
+            return;
+        }
+        snapshot.file_progress_posted = false;
+        try {
+            handle.post_file_progress(lt::torrent_handle::piece_granularity);
+        } catch (const std::exception&) {
+            return;
+        }
+        snapshot.file_progress_posted = true;
+        snapshot.file_progress_deadline = now + kFileProgressTimeout;
+    }
+
+    // Reports files whose verified bytes moved since the last file_progress_alert.
+    void apply_file_progress(std::uint32_t slot,
+                             const lt::file_progress_alert& progress,
+                             const rust::Vec<NativeEvent>& events,
+                             rust::Vec<NativeTorrentUpdate>& updates) {
+        if (!torrents_.loaded(slot)) {
+            return;
+        }
+        auto& snapshot = torrents_.snapshots[slot];
+        snapshot.file_progress_posted = false;
+        const auto* metadata = snapshot.metadata.get();
+        if (metadata == nullptr) {
+            return;
+        }
+        auto& reported = snapshot.file_progress;
+        const auto count = std::min(progress.files.size(), metadata->file_sizes.size());
+        reported.resize(count, 0);
+        std::size_t idx = 0;
+        for (const std::int64_t bytes : progress.files) {
+            if (idx >= count) {
+                break;
+            }
+            if (bytes != reported[idx]) {
+                reported[idx] = bytes;
+                push_file_update(slot, idx, *metadata, events, updates);
+            }
+            ++idx;
+        }
+    }
+
+    // file_completed_alert arrives as soon as a file's last piece passes the hash check, ahead
+    // of the next status sweep, so post-processing can pick the file up immediately.
+    void note_file_completed(std::uint32_t slot,
+                             std::size_t index,
+                             const rust::Vec<NativeEvent>& events,
+                             rust::Vec<NativeTorrentUpdate>& updates) {
+        if (!torrents_.loaded(slot)) {
+            return;
+        }
+        auto& snapshot = torrents_.snapshots[slot];
+        const auto* metadata = snapshot.metadata.get();
+        if (metadata == nullptr || index >= metadata->file_sizes.size()) {
+            return;
+        }
+        auto& reported = snapshot.file_progress;
+        reported.resize(metadata->file_sizes.size(), 0);
+        const auto size = static_cast<std::int64_t>(metadata->file_sizes[index]);
+        if (reported[index] == size) {
+            return;
+        }
+        reported[index] = size;
+        push_file_update(slot, index, *metadata, events, updates);
+    }
+
+    void apply_status_update(std::uint32_t slot,
+                             const lt::torrent_status& status,
+                             rust::Vec<NativeEvent>& events,
+                             rust::Vec<NativeTorrentUpdate>& updates,
+                             std::unordered_set<std::uint32_t>& stale_slots) {
+        if (!torrents_.loaded(slot) || stale_slots.count(slot) != 0) {
+            return;
+        }
+        const std::string id = torrents_.id(slot);
+        TorrentSnapshot& snapshot = torrents_.snapshots[slot];
+        NativeTorrentState current_state = map_state(status.state);
+        const auto info = snapshot.metadata ? nullptr : status.torrent_file.lock();
+        const auto* metadata = memoize_metadata(slot, info);
+
+        if (status.errc) {
+            NativeEvent evt{};
+            evt.id = id;
+            evt.kind = NativeEventKind::Error;
+            evt.state = NativeTorrentState::Failed;
+            evt.message = status.errc.message();
+            events.push_back(evt);
+        }
+
+        if (!snapshot.metadata_emitted && (metadata != nullptr || info)) {
+            try {
+                NativeEvent files_evt{};
+                files_evt.id = id;
+                files_evt.kind = NativeEventKind::FilesDiscovered;
+                files_evt.state = current_state;
+                files_evt.name = status.name;
+                files_evt.download_dir = status.save_path;
+                // Only the file count travels with the event; the table itself is paged out
+                // through list_files so huge torrents never stall a single poll.
+                files_evt.file_count =
+                    metadata != nullptr
+                        ? static_cast<std::uint32_t>(metadata->file_paths.size())
+                        : 0;
+                events.push_back(files_evt);
+
+                const auto details =
+                    metadata != nullptr ? metadata->details : extract_metainfo_details(*info);
+                NativeEvent meta_evt{};
+                meta_evt.id = id;
+                meta_evt.kind = NativeEventKind::MetadataUpdated;
+                meta_evt.state = current_state;
+                meta_evt.name = status.name;
+                meta_evt.download_dir = status.save_path;
+                meta_evt.comment = details.comment;
+                meta_evt.source = details.source;
+                meta_evt.private_flag = details.private_flag;
+                meta_evt.has_private = details.has_private;
+                events.push_back(meta_evt);
+
+                apply_selection(slot);
+                snapshot.metadata_applied = true;
+                snapshot.last_name = status.name;
+                snapshot.last_download_dir = status.save_path;
+                snapshot.metadata_emitted = true;
+            } catch (const std::exception& ex) {
+                note_invalid_handle(slot, events, stale_slots, ex.what());
+                return;
+            }
+        }
+
+        if (snapshot.last_name != status.name || snapshot.last_download_dir != status.save_path) {
+            NativeEvent meta{};
+            meta.id = id;
+            meta.kind = NativeEventKind::MetadataUpdated;
+            meta.state = current_state;
+            meta.name = status.name;
+            meta.download_dir = status.save_path;
+            if (metadata != nullptr) {
+                const auto& details = metadata->details;
+                meta.comment = details.comment;
+                meta.source = details.source;
+                meta.private_flag = details.private_flag;
+                meta.has_private = details.has_private;
+            }
+            events.push_back(meta);
+            snapshot.last_name = status.name;
+            snapshot.last_download_dir = status.save_path;
+        }
+
+        if (snapshot.state != current_state) {
+            NativeTorrentUpdate state_update{};
+            state_update.slot = slot;
+            state_update.position = static_cast<std::uint32_t>(events.size());
+            state_update.kind = NativeUpdateKind::StateChanged;
+            state_update.state = current_state;
+            updates.push_back(state_update);
+            snapshot.state = current_state;
+        }
+
+        if (static_cast<std::uint64_t>(status.total_done) != snapshot.bytes_downloaded ||
+            static_cast<std::uint64_t>(status.total_wanted) != snapshot.bytes_total) {
+            NativeTorrentUpdate progress{};
+            progress.slot = slot;
+            progress.position = static_cast<std::uint32_t>(events.size());
+            progress.kind = NativeUpdateKind::Progress;
+            progress.state = current_state;
+            progress.bytes_downloaded = static_cast<std::uint64_t>(status.total_done);
+            progress.bytes_total = static_cast<std::uint64_t>(status.total_wanted);
+            progress.download_bps = static_cast<std::uint64_t>(
+                status.download_payload_rate > 0 ? status.download_payload_rate : 0);
+            progress.upload_bps = static_cast<std::uint64_t>(
+                status.upload_payload_rate > 0 ? status.upload_payload_rate : 0);
+            if (status.total_payload_download > 0) {
+                progress.ratio = static_cast<double>(status.total_payload_upload) /
+                                 static_cast<double>(status.total_payload_download);
+            } else {
+                progress.ratio = 0.0;
+            }
+            updates.push_back(progress);
+
+            snapshot.bytes_downloaded = static_cast<std::uint64_t>(status.total_done);
+            snapshot.bytes_total = static_cast<std::uint64_t>(status.total_wanted);
+            if (metadata != nullptr) {
+                request_file_progress(slot, status.handle);
+            }
+        }
+
+        if (!snapshot.completed_emitted &&
+            (status.is_finished || status.state == lt::torrent_status::seeding)) {
+            NativeEvent completed{};
+            completed.id = id;
+            completed.kind = NativeEventKind::Completed;
+            completed.state = NativeTorrentState::Completed;
+            completed.name = status.name;
+            completed.library_path = status.save_path;
+            events.push_back(completed);
+            snapshot.completed_emitted = true;
+        }
+
+        if (status.need_save_resume) {
+            snapshot.resume_dirty = true;
+        }
+    }
+
+    // Checkpoints resume data in rounds: every interval, dirty torrents are saved with at
+    // most `resume_max_inflight_saves_` requests outstanding, the most changed first. A
+    // round stays open until every dirty torrent has been saved, then the next one waits
+    // a full interval.
+    void schedule_resume_saves(std::chrono::steady_clock::time_point now,
+                               rust::Vec<NativeEvent>& events,
+                               std::unordered_set<std::uint32_t>& stale_slots) {
+        if (!resume_round_open_) {
+            if (now < next_resume_checkpoint_) {
+                return;
+            }
+            resume_round_open_ = true;
+        }
+
+        int inflight = 0;
+        std::vector<std::pair<std::uint64_t, std::uint32_t>> candidates;
+        for (std::uint32_t slot = 1; slot < torrents_.end(); ++slot) {
+            if (!torrents_.loaded(slot)) {
                 continue;
             }
-            if (stored == handle) {
-                return id;
+            const auto& snapshot = torrents_.snapshots[slot];
+            if (snapshot.resume_requested) {
+                ++inflight;
+            } else if (snapshot.resume_dirty) {
+                const auto changed = snapshot.bytes_downloaded > snapshot.resume_saved_bytes
+                    ? snapshot.bytes_downloaded - snapshot.resume_saved_bytes
+                    : snapshot.resume_saved_bytes - snapshot.bytes_downloaded;
+                candidates.emplace_back(changed, slot);
             }
         }
-        return {};
+
+        if (candidates.empty()) {
+            if (inflight == 0) {
+                resume_round_open_ = false;
+                next_resume_checkpoint_ = now + resume_checkpoint_interval_;
+            }
+            return;
+        }
+
+        const auto budget = static_cast<std::size_t>(
+            std::max(0, resume_max_inflight_saves_ - inflight));
+        const auto batch = std::min(budget, candidates.size());
+        std::partial_sort(candidates.begin(),
+                          candidates.begin() + static_cast<std::ptrdiff_t>(batch),
+                          candidates.end(),
+                          [](const auto& left, const auto& right) {
+                              return left.first > right.first;
+                          });
+        for (std::size_t idx = 0; idx < batch; ++idx) {
+            request_resume_save(candidates[idx].second, events, stale_slots);
+        }
     }
 
-    void drop_torrent_state(const std::string& id) {
-        handles_.erase(id);
-        snapshots_.erase(id);
-        pending_resume_.erase(id);
-        selection_rules_.erase(id);
+    void request_resume_save(std::uint32_t slot,
+                             rust::Vec<NativeEvent>& events,
+                             std::unordered_set<std::uint32_t>& stale_slots) {
+        if (!torrents_.loaded(slot)) {
+            return;
+        }
+        auto& snapshot = torrents_.snapshots[slot];
+        snapshot.resume_dirty = false;
+        try {
+            torrents_.handles[slot]->save_resume_data(lt::torrent_handle::save_resume_flags_t{});
+            snapshot.resume_requested = true;
+            snapshot.resume_saved_bytes = snapshot.bytes_downloaded;
+        } catch (const std::exception& ex) {
+            note_invalid_handle(slot, events, stale_slots, ex.what());
+        }
+    }
+
+    std::uint32_t flush_resume_data() {
+        rust::Vec<NativeEvent> events;
+        std::unordered_set<std::uint32_t> stale_slots;
+        std::uint32_t outstanding = 0;
+        for (std::uint32_t slot = 1; slot < torrents_.end(); ++slot) {
+            if (!torrents_.loaded(slot)) {
+                continue;
+            }
+            const auto& snapshot = torrents_.snapshots[slot];
+            if (!snapshot.resume_requested && snapshot.resume_dirty) {
+                request_resume_save(slot, events, stale_slots);
+            }
+            if (snapshot.resume_requested) {
+                ++outstanding;
+            }
+        }
+        // Failures surface through the next poll, which re-checks these handles.
+        status_refresh_.insert(stale_slots.begin(), stale_slots.end());
+        return outstanding;
+    }
+
+    void collect_authoring_progress(std::chrono::steady_clock::time_point now,
+                                    rust::Vec<NativeEvent>& events) {
+        for (auto& [job_id, job] : authoring_jobs_) {
+            if (job->finish_reported) {
+                continue;
+            }
+            const auto done = job->pieces_done.load(std::memory_order_relaxed);
+            if (done != job->reported_pieces) {
+                job->reported_pieces = done;
+                const auto total = job->bytes_total.load(std::memory_order_relaxed);
+                const auto hashed = std::min<std::uint64_t>(
+                    static_cast<std::uint64_t>(done)
+                        * job->piece_length.load(std::memory_order_relaxed),
+                    total);
+                const auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                            now - job->started)
+                                            .count();
+                NativeEvent evt{};
+                evt.id = job_id;
+                evt.kind = NativeEventKind::AuthoringProgress;
+                evt.bytes_downloaded = hashed;
+                evt.bytes_total = total;
+                evt.download_bps =
+                    elapsed_ms > 0 ? hashed * 1000 / static_cast<std::uint64_t>(elapsed_ms) : 0;
+                evt.pieces_done = done;
+                evt.pieces_total = job->pieces_total.load(std::memory_order_relaxed);
+                events.push_back(std::move(evt));
+            }
+            if (job->finished.load(std::memory_order_acquire)) {
+                job->finish_reported = true;
+                NativeEvent evt{};
+                evt.id = job_id;
+                evt.kind = NativeEventKind::AuthoringFinished;
+                events.push_back(std::move(evt));
+            }
+        }
+    }
+
+    // Registers or reports an add submitted through async_add_torrent. Synchronous adds
+    // raise the same alert but were never queued, so they are skipped here.
+    void complete_async_add(const lt::add_torrent_alert& added, rust::Vec<NativeEvent>& events) {
+        auto found = pending_adds_.find(async_add_key(added.params));
+        if (found == pending_adds_.end()) {
+            return;
+        }
+        const PendingAdd pending = std::move(found->second);
+        pending_adds_.erase(found);
+        if (pending.restore && restore_batch_.pending > 0) {
+            --restore_batch_.pending;
+        }
+        if (added.error) {
+            const char* prefix = pending.restore ? "restore failed: " : "add failed: ";
+            events.push_back(add_error_event(pending.id, prefix + added.error.message()));
+            abandon_admission(torrents_.find(pending.id));
+            return;
+        }
+        if (!torrents_.pending_updates.contains(torrents_.find(pending.id))) {
+            // Removed while the add was in flight; drop what libtorrent admitted.
+            session_->remove_torrent(added.handle);
+            return;
+        }
+        register_handle(pending.id, added.handle, pending.queue_position, added.params.ti);
+        if (pending.restore) {
+            ++restore_batch_.restored;
+        }
+        if (pending.verified) {
+            NativeEvent evt{};
+            evt.id = format_torrent_key(pending.id);
+            evt.kind = NativeEventKind::VerifyAdmitted;
+            evt.state = NativeTorrentState::Queued;
+            events.push_back(std::move(evt));
+        }
+    }
+
+    void drop_torrent_state(std::uint32_t slot) {
+        forget_handle(slot);
+        status_refresh_.erase(slot);
+        torrents_.pending_resume.erase(slot);
+        torrents_.selection_rules.erase(slot);
+        torrents_.pending_updates.erase(slot);
+        torrents_.unload(slot);
     }
 
-    void note_invalid_handle(const std::string& id,
+    void note_invalid_handle(std::uint32_t slot,
                              rust::Vec<NativeEvent>& events,
-                             std::unordered_set<std::string>& stale_ids,
+                             std::unordered_set<std::uint32_t>& stale_slots,
                              const std::string& message) {
         NativeEvent evt{};
-        evt.id = id;
+        evt.id = torrents_.id(slot);
         evt.kind = NativeEventKind::Error;
         evt.state = NativeTorrentState::Failed;
         evt.message = message;
         events.push_back(std::move(evt));
-        stale_ids.insert(id);
-    }
-
-    bool matches_any(const std::vector<std::regex>& patterns, const std::string& value) const {
-        return std::any_of(patterns.begin(), patterns.end(),
-                           [&value](const std::regex& re) {
-                               return std::regex_match(value, re);
-                           });
+        stale_slots.insert(slot);
     }
 
-    void apply_selection(const std::string& id, lt::torrent_handle& handle) {
-        auto info = handle.torrent_file();
-        if (!info) {
+    void apply_selection(std::uint32_t slot) {
+        const auto* selection = torrents_.selection_rules.find(slot);
+        if (!torrents_.loaded(slot) || selection == nullptr) {
             return;
         }
-        auto rules_it = selection_rules_.find(id);
-        if (rules_it == selection_rules_.end()) {
+        lt::torrent_handle& handle = *torrents_.handles[slot];
+        const auto* metadata = memoize_metadata(
+            slot, torrents_.snapshots[slot].metadata ? nullptr : handle.torrent_file());
+        if (metadata == nullptr) {
             return;
         }
 
-        const SelectionEntry& rules = rules_it->second;
+        const SelectionEntry& rules = *selection;
 
         std::vector<lt::download_priority_t> priorities;
-        priorities.resize(static_cast<std::size_t>(info->files().num_files()),
-                          lt::default_priority);
+        priorities.resize(metadata->file_paths.size(), lt::default_priority);
 
-        for (lt::file_index_t idx : info->files().file_range()) {
-            std::string path = info->files().file_path(idx);
+        for (std::size_t idx = 0; idx < metadata->file_paths.size(); ++idx) {
+            const std::string& path = metadata->file_paths[idx];
 
             if (rules.skip_fluff && is_fluff(path)) {
-                priorities[static_cast<std::size_t>(idx)] = lt::dont_download;
+                priorities[idx] = lt::dont_download;
                 continue;
             }
 
-            if (!rules.exclude.empty() && matches_any(rules.exclude, path)) {
-                priorities[static_cast<std::size_t>(idx)] = lt::dont_download;
+            if (rules.exclude.matches(path)) {
+                priorities[idx] = lt::dont_download;
                 continue;
             }
 
-            if (!rules.include.empty() && matches_any(rules.include, path)) {
-                priorities[static_cast<std::size_t>(idx)] = lt::default_priority;
+            if (rules.include.matches(path)) {
+                priorities[idx] = lt::default_priority;
             }
         }
 
@@ -2168,17 +4362,16 @@ private:
         handle.prioritize_files(priorities);
     }
 
-    bool is_fluff(const std::string& path) const {
-        static const std::vector<std::regex> fluff = [] {
-            std::vector<std::regex> compiled;
-            compiled.reserve(kSkipFluffPatterns.size());
+    static bool is_fluff(const std::string& path) {
+        static const GlobSet fluff = [] {
+            GlobSet compiled;
             for (const char* pattern : kSkipFluffPatterns) {
-                compiled.emplace_back(glob_to_regex(pattern), std::regex::icase);
+                compiled.add(pattern);
             }
             return compiled;
         }();
 
-        return matches_any(fluff, path);
+        return fluff.matches(path);
     }
 
     struct AuthView {
@@ -2280,10 +4473,35 @@ private:
     bool super_seeding_default_{false};
     bool pex_enabled_{true};
     int default_max_connections_per_torrent_{-1};
-    std::unordered_map<std::string, lt::torrent_handle> handles_;
-    std::unordered_map<std::string, TorrentSnapshot> snapshots_;
-    std::unordered_map<std::string, std::vector<char>> pending_resume_;
-    std::unordered_map<std::string, SelectionEntry> selection_rules_;
+    TorrentTable torrents_;
+    // Slot of each attached torrent, keyed by the libtorrent torrent object it wraps.
+    std::unordered_map<const void*, std::uint32_t> torrent_slots_;
+    // Async adds awaiting their add_torrent_alert, keyed by info hash.
+    std::unordered_map<lt::sha1_hash, PendingAdd> pending_adds_;
+    RestoreBatch restore_batch_;
+    MetadataCache metadata_;
+    // Disk subsystem the current lt::session was constructed with.
+    std::uint8_t disk_io_backend_{kDiskIoAuto};
+    // Events raised outside poll_events, delivered on the next poll.
+    std::vector<NativeEvent> deferred_events_;
+    // Torrents that have not yet appeared in a state_update_alert and need one pulled status.
+    std::unordered_set<std::uint32_t> status_refresh_;
+    std::chrono::steady_clock::time_point last_status_post_{};
+    std::chrono::steady_clock::time_point last_stats_post_{};
+    // Latest session_stats_alert counters, indexed like session_stats_metrics().
+    std::vector<std::int64_t> session_stats_;
+    std::uint64_t session_stats_sequence_{0};
+    // Latency histograms for the `Session` entry points, recorded by the forwarders below.
+    CallTimings call_timings_;
+    std::chrono::milliseconds resume_checkpoint_interval_{kDefaultResumeCheckpointInterval};
+    int resume_max_inflight_saves_{kDefaultResumeMaxInflightSaves};
+    std::chrono::steady_clock::time_point next_resume_checkpoint_{};
+    bool resume_round_open_{false};
+    std::optional<::rust::Box<AlertWaker>> alert_waker_;
+    std::unordered_map<std::string, std::unique_ptr<AuthoringJob>> authoring_jobs_;
+    // Pre-verifies submitted by adds, in submission order, until poll_events admits them.
+    std::vector<std::shared_ptr<VerifyJob>> verify_jobs_;
+    VerifyScheduler verifier_;
 };
 
 Session::Session(const SessionOptions& options)
@@ -2292,94 +4510,179 @@ Session::Session(const SessionOptions& options)
 Session::~Session() = default;
 
 ::rust::String Session::apply_engine_profile(const EngineOptions& options) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kApplyEngineProfile);
     return impl_->apply_engine_profile(options);
 }
 
 ::rust::String Session::add_torrent(const AddTorrentRequest& request) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kAddTorrent);
     return impl_->add_torrent(request);
 }
 
-CreateTorrentResult Session::create_torrent(const CreateTorrentRequest& request) {
-    return impl_->create_torrent(request);
+::rust::String Session::start_create_torrent(::rust::Str job_id,
+                                             const CreateTorrentRequest& request) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kStartCreateTorrent);
+    return impl_->start_create_torrent(to_std_string(job_id), request);
+}
+
+::rust::String Session::cancel_create_torrent(::rust::Str job_id) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kCancelCreateTorrent);
+    return impl_->cancel_create_torrent(to_std_string(job_id));
+}
+
+bool Session::authoring_finished(::rust::Str job_id) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kAuthoringFinished);
+    return impl_->authoring_finished(to_std_string(job_id));
+}
+
+CreateTorrentResult Session::take_create_torrent_result(::rust::Str job_id) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kTakeCreateTorrentResult);
+    return impl_->take_create_torrent_result(to_std_string(job_id));
+}
+
+::rust::String Session::remove_torrent(TorrentKey id, bool with_data) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kRemoveTorrent);
+    return impl_->remove_torrent(id, with_data);
 }
 
-::rust::String Session::remove_torrent(::rust::Str id, bool with_data) {
-    return impl_->remove_torrent(to_std_string(id), with_data);
+::rust::String Session::pause_torrent(TorrentKey id) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kPauseTorrent);
+    return impl_->pause_torrent(id);
 }
 
-::rust::String Session::pause_torrent(::rust::Str id) {
-    return impl_->pause_torrent(to_std_string(id));
+::rust::String Session::resume_torrent(TorrentKey id) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kResumeTorrent);
+    return impl_->resume_torrent(id);
 }
 
-::rust::String Session::resume_torrent(::rust::Str id) {
-    return impl_->resume_torrent(to_std_string(id));
+::rust::String Session::set_sequential(TorrentKey id, bool sequential) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kSetSequential);
+    return impl_->set_sequential(id, sequential);
 }
 
-::rust::String Session::set_sequential(::rust::Str id, bool sequential) {
-    return impl_->set_sequential(to_std_string(id), sequential);
+::rust::String Session::load_fastresume(TorrentKey id, rust::Slice<const std::uint8_t> data) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kLoadFastresume);
+    return impl_->load_fastresume(id, data);
 }
 
-::rust::String Session::load_fastresume(::rust::Str id, rust::Slice<const std::uint8_t> data) {
-    return impl_->load_fastresume(to_std_string(id), data);
+rust::Vec<::rust::String> Session::add_torrents(rust::Slice<const AddTorrentRequest> requests) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kAddTorrents);
+    return impl_->add_torrents(requests);
+}
+
+::rust::String Session::restore_torrents(rust::Slice<const RestoreTorrentRequest> requests) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kRestoreTorrents);
+    return impl_->restore_torrents(requests);
 }
 
 ::rust::String Session::update_limits(const LimitRequest& request) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kUpdateLimits);
     return impl_->update_limits(request);
 }
 
 ::rust::String Session::update_selection(const SelectionRules& request) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kUpdateSelection);
     return impl_->update_selection(request);
 }
 
 ::rust::String Session::update_options(const UpdateOptionsRequest& request) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kUpdateOptions);
     return impl_->update_options(request);
 }
 
 ::rust::String Session::update_trackers(const UpdateTrackersRequest& request) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kUpdateTrackers);
     return impl_->update_trackers(request);
 }
 
 ::rust::String Session::update_web_seeds(const UpdateWebSeedsRequest& request) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kUpdateWebSeeds);
     return impl_->update_web_seeds(request);
 }
 
 ::rust::String Session::move_torrent(const MoveTorrentRequest& request) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kMoveTorrent);
     return impl_->move_torrent(request);
 }
 
-::rust::String Session::reannounce(::rust::Str id) {
-    return impl_->reannounce(to_std_string(id));
+::rust::String Session::reannounce(TorrentKey id) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kReannounce);
+    return impl_->reannounce(id);
 }
 
-::rust::String Session::recheck(::rust::Str id) {
-    return impl_->recheck(to_std_string(id));
+::rust::String Session::recheck(TorrentKey id) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kRecheck);
+    return impl_->recheck(id);
 }
 
 ::rust::String Session::set_piece_deadline(
-    ::rust::Str id, std::uint32_t piece, std::int32_t deadline_ms, bool has_deadline) {
-    return impl_->set_piece_deadline(to_std_string(id), piece, deadline_ms, has_deadline);
+    TorrentKey id, std::uint32_t piece, std::int32_t deadline_ms, bool has_deadline) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kSetPieceDeadline);
+    return impl_->set_piece_deadline(id, piece, deadline_ms, has_deadline);
+}
+
+rust::Vec<NativeFile> Session::list_files(TorrentKey id,
+                                          std::uint32_t offset,
+                                          std::uint32_t limit) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kListFiles);
+    return impl_->list_files(id, offset, limit);
 }
 
-rust::Vec<NativePeerInfo> Session::list_peers(::rust::Str id) {
+rust::Vec<NativePeerInfo> Session::list_peers(TorrentKey id) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kListPeers);
     return impl_->list_peers(id);
 }
 
+EngineMetadataCacheState Session::inspect_metadata_cache_state() const {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kInspectMetadataCacheState);
+    return impl_->inspect_metadata_cache_state();
+}
+
+rust::Vec<NativeStatsMetric> Session::session_stats_metrics() const {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kSessionStatsMetrics);
+    return impl_->session_stats_metrics();
+}
+
+EngineTimingState Session::inspect_timing_state() const {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kInspectTimingState);
+    return impl_->inspect_timing_state();
+}
+
+EngineSessionStats Session::inspect_session_stats() const {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kInspectSessionStats);
+    return impl_->inspect_session_stats();
+}
+
 EngineStorageState Session::inspect_storage_state() const {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kInspectStorageState);
     return impl_->inspect_storage_state();
 }
 
 EnginePeerClassState Session::inspect_peer_class_state() const {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kInspectPeerClassState);
     return impl_->inspect_peer_class_state();
 }
 
 EngineSettingsState Session::inspect_settings_state() const {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kInspectSettingsState);
     return impl_->inspect_settings_state();
 }
 
-rust::Vec<NativeEvent> Session::poll_events() {
+std::uint32_t Session::flush_resume_data() {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kFlushResumeData);
+    return impl_->flush_resume_data();
+}
+
+NativeEventBatch Session::poll_events() {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kPollEvents);
     return impl_->poll_events();
 }
 
+void Session::set_alert_waker(::rust::Box<AlertWaker> waker) {
+    const CallTimer timer(impl_->call_timings(), SessionCall::kSetAlertWaker);
+    impl_->set_alert_waker(std::move(waker));
+}
+
 std::unique_ptr<Session> new_session(const SessionOptions& options) {
     return std::make_unique<Session>(options);
 }
@@ -34,11 +34,12 @@ pub mod types;
 /// Background worker that drives the libtorrent session.
 pub mod worker;
 
-pub use adapter::LibtorrentEngine;
+pub use adapter::{LibtorrentEngine, TorrentAuthorJob};
 pub use command::EngineCommand;
 pub use store::{FastResumeStore, StoredTorrentMetadata, StoredTorrentState};
 pub use types::{
-    ChokingAlgorithm, EncryptionPolicy, EngineRuntimeConfig, IpFilterRule, IpFilterRuntimeConfig,
-    Ipv6Mode, SeedChokingAlgorithm, Toggle, TrackerAuthRuntime, TrackerProxyRuntime,
+    CallTiming, ChokingAlgorithm, EncryptionPolicy, EngineRuntimeConfig, IpFilterRule,
+    IpFilterRuntimeConfig, Ipv6Mode, MetadataCacheStats, SeedChokingAlgorithm, SessionStats,
+    SessionStatsMetric, TimingState, Toggle, TrackerAuthRuntime, TrackerProxyRuntime,
     TrackerProxyType, TrackerRuntimeConfig,
 };
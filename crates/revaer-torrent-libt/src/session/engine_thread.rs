@@ -0,0 +1,98 @@
+//! Dedicated OS thread that owns the native libtorrent session.
+//!
+//! # Design
+//! - Every FFI call runs on one engine thread so blocking native work (authoring hashes,
+//!   seed-mode sampling, synchronous adds) never stalls a tokio worker.
+//! - Calls are boxed closures sent over a channel; results come back on a oneshot.
+//! - Dropping the last handle closes the channel; the thread drains queued jobs and then
+//!   drops the session on its own, so shutdown never blocks the async runtime.
+
+use std::sync::mpsc;
+use std::thread;
+
+use revaer_torrent_core::TorrentResult;
+use tokio::sync::oneshot;
+use tracing::debug;
+
+use crate::error::{LibtorrentError, op_failed};
+use crate::ffi::SessionHandle;
+
+type Job = Box<dyn FnOnce(&mut SessionHandle) + Send>;
+
+const ENGINE_THREAD_NAME: &str = "revaer-libtorrent";
+
+/// Handle used to run closures against the session on the engine thread.
+pub(super) struct EngineThread {
+    jobs: mpsc::Sender<Job>,
+}
+
+impl EngineThread {
+    /// Move the session onto a newly spawned engine thread.
+    pub(super) fn spawn(mut session: SessionHandle) -> TorrentResult<Self> {
+        let (jobs, queue) = mpsc::channel::<Job>();
+        thread::Builder::new()
+            .name(ENGINE_THREAD_NAME.to_string())
+            .spawn(move || {
+                while let Ok(job) = queue.recv() {
+                    job(&mut session);
+                }
+                debug!("libtorrent engine thread stopping");
+            })
+            .map_err(|_| unavailable("spawn_engine_thread"))?;
+        Ok(Self { jobs })
+    }
+
+    /// Run `call` on the engine thread and await its result.
+    pub(super) async fn call<T, F>(&self, operation: &'static str, call: F) -> TorrentResult<T>
+    where
+        T: Send + 'static,
+        F: FnOnce(&mut SessionHandle) -> T + Send + 'static,
+    {
+        let (respond_to, response) = oneshot::channel();
+        let job: Job = Box::new(move |session| {
+            if respond_to.send(call(session)).is_err() {
+                debug!(operation, "engine call caller dropped before completion");
+            }
+        });
+        self.jobs.send(job).map_err(|_| unavailable(operation))?;
+        response.await.map_err(|_| unavailable(operation))
+    }
+}
+
+fn unavailable(operation: &'static str) -> revaer_torrent_core::TorrentError {
+    op_failed(
+        operation,
+        None,
+        LibtorrentError::SessionUnavailable { operation },
+    )
+}
+
+#[cfg(all(test, libtorrent_native))]
+mod tests {
+    use super::*;
+    use crate::ffi::ffi;
+    use anyhow::Result;
+
+    #[tokio::test]
+    async fn engine_thread_runs_calls_off_the_runtime() -> Result<()> {
+        let session = SessionHandle::new(&ffi::SessionOptions {
+            download_root: String::new(),
+            resume_dir: String::new(),
+            enable_dht: false,
+            sequential_default: false,
+        })?;
+        let engine = EngineThread::spawn(session)?;
+
+        let caller = thread::current().id();
+        let (engine_id, engine_name) = engine
+            .call("inspect_settings", |session| {
+                let _settings = session.as_ref().inspect_settings_state();
+                let current = thread::current();
+                (current.id(), current.name().map(str::to_owned))
+            })
+            .await?;
+        assert_ne!(engine_id, caller);
+        assert_eq!(engine_name.as_deref(), Some(ENGINE_THREAD_NAME));
+        Ok(())
+    }
+}
@@ -1,11 +1,18 @@
-use crate::types::{EngineRuntimeConfig, EngineSettingsSnapshot};
+use crate::error::{LibtorrentError, op_failed};
+use crate::types::{
+    EngineRuntimeConfig, EngineSettingsSnapshot, MetadataCacheStats, SessionStats, TimingState,
+};
 use async_trait::async_trait;
 use revaer_torrent_core::{
     AddTorrent, EngineEvent, FileSelectionUpdate, PeerSnapshot, RemoveTorrent, TorrentRateLimit,
     TorrentResult,
 };
+use std::sync::Arc;
+use tokio::sync::Notify;
 use uuid::Uuid;
 
+#[cfg(libtorrent_native)]
+mod engine_thread;
 #[cfg(libtorrent_native)]
 mod options;
 
@@ -20,15 +27,50 @@ pub mod stub;
 #[cfg(test)]
 pub(crate) use stub::StubSession;
 
+/// Stored torrent handed to [`LibTorrentSession::restore_torrents`].
+#[derive(Debug, Clone)]
+pub struct RestoreTorrent {
+    /// Torrent identifier.
+    pub id: Uuid,
+    /// Fastresume payload previously produced by libtorrent, shared with the worker's cache.
+    pub fastresume: Arc<Vec<u8>>,
+    /// Download directory recorded alongside the payload.
+    pub download_dir: Option<String>,
+}
+
 /// Abstraction over the native libtorrent session surface.
 #[async_trait]
 pub trait LibTorrentSession: Send {
     /// Add a new torrent to the session.
     ///
+    /// A request with `pre_verify` or a seed-mode hash sample set is only queued for hashing
+    /// here. Its admission is reported later through [`Self::poll_events`] as
+    /// [`EngineEvent::VerifyAdmitted`], or as [`EngineEvent::Error`] when the check fails, with
+    /// [`EngineEvent::VerifyProgress`] in between for pre-verifies.
+    ///
     /// # Errors
     ///
     /// Returns an error if the native bridge rejects the request.
     async fn add_torrent(&mut self, request: &AddTorrent) -> TorrentResult<()>;
+    /// Add several torrents in one call, returning one result per request in order.
+    ///
+    /// Backends with asynchronous admission only validate and submit here; failures found
+    /// afterwards arrive as [`EngineEvent::Error`] through [`Self::poll_events`]. The default
+    /// adds each request in turn.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the batch cannot be submitted at all.
+    async fn add_torrents(
+        &mut self,
+        requests: &[AddTorrent],
+    ) -> TorrentResult<Vec<TorrentResult<()>>> {
+        let mut results = Vec::with_capacity(requests.len());
+        for request in requests {
+            results.push(self.add_torrent(request).await);
+        }
+        Ok(results)
+    }
     /// Author a new `.torrent` metainfo payload.
     ///
     /// # Errors
@@ -38,6 +80,42 @@ pub trait LibTorrentSession: Send {
         &mut self,
         request: &revaer_torrent_core::model::TorrentAuthorRequest,
     ) -> TorrentResult<revaer_torrent_core::model::TorrentAuthorResult>;
+    /// Start authoring a `.torrent` in the background under `job_id`.
+    ///
+    /// Background jobs report [`EngineEvent::AuthoringProgress`] and
+    /// [`EngineEvent::AuthoringFinished`] through [`Self::poll_events`]; their result is then
+    /// collected with [`Self::finish_create_torrent`]. Backends without background authoring
+    /// complete the request inline and return `Some(result)`.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the job cannot be started or inline authoring fails.
+    async fn start_create_torrent(
+        &mut self,
+        _job_id: Uuid,
+        request: &revaer_torrent_core::model::TorrentAuthorRequest,
+    ) -> TorrentResult<Option<revaer_torrent_core::model::TorrentAuthorResult>> {
+        self.create_torrent(request).await.map(Some)
+    }
+    /// Ask a background authoring job to stop after the piece it is hashing.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the job is unknown.
+    async fn cancel_create_torrent(&mut self, _job_id: Uuid) -> TorrentResult<()> {
+        Err(unknown_authoring_job("cancel_create_torrent"))
+    }
+    /// Collect the result of a background authoring job after it reported completion.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the job is unknown, still running, failed, or was cancelled.
+    async fn finish_create_torrent(
+        &mut self,
+        _job_id: Uuid,
+    ) -> TorrentResult<revaer_torrent_core::model::TorrentAuthorResult> {
+        Err(unknown_authoring_job("finish_create_torrent"))
+    }
     /// Remove a torrent from the session.
     ///
     /// # Errors
@@ -67,7 +145,20 @@ pub trait LibTorrentSession: Send {
     /// # Errors
     ///
     /// Returns an error if the payload cannot be applied.
-    async fn load_fastresume(&mut self, id: Uuid, payload: &[u8]) -> TorrentResult<()>;
+    async fn load_fastresume(&mut self, id: Uuid, payload: Arc<Vec<u8>>) -> TorrentResult<()>;
+    /// Re-admit stored torrents in bulk from their fastresume payloads.
+    ///
+    /// Admission is asynchronous: per-torrent failures arrive as [`EngineEvent::Error`] and
+    /// the batch reports one [`EngineEvent::RestoreFinished`] through [`Self::poll_events`].
+    /// Backends without bulk restore ignore the request and leave stored torrents to be
+    /// re-added individually.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the batch cannot be submitted.
+    async fn restore_torrents(&mut self, _torrents: Vec<RestoreTorrent>) -> TorrentResult<()> {
+        Ok(())
+    }
     /// Apply rate limits globally or to a specific torrent.
     ///
     /// # Errors
@@ -159,6 +250,15 @@ pub trait LibTorrentSession: Send {
     ///
     /// Returns an error if fetching the events fails.
     async fn poll_events(&mut self) -> TorrentResult<Vec<EngineEvent>>;
+    /// Request resume data for every torrent with unsaved state, bypassing the checkpoint
+    /// schedule, and report how many saves are still outstanding.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the session cannot be reached.
+    async fn flush_resume_data(&mut self) -> TorrentResult<u32> {
+        Ok(0)
+    }
     /// Apply a runtime configuration profile.
     ///
     /// # Errors
@@ -171,6 +271,68 @@ pub trait LibTorrentSession: Send {
     ///
     /// Returns an error if settings cannot be retrieved.
     async fn inspect_settings(&mut self) -> TorrentResult<EngineSettingsSnapshot>;
+    /// Inspect occupancy and memory accounting of the parsed-metadata cache.
+    ///
+    /// Backends without a metadata cache report empty statistics.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the statistics cannot be retrieved.
+    async fn inspect_metadata_cache(&mut self) -> TorrentResult<MetadataCacheStats> {
+        Ok(MetadataCacheStats::default())
+    }
+    /// Inspect the latest sample of session-wide performance counters.
+    ///
+    /// Backends without native counters report an empty sample.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the sample cannot be retrieved.
+    async fn inspect_session_stats(&mut self) -> TorrentResult<SessionStats> {
+        Ok(SessionStats::default())
+    }
+    /// Inspect per-method latency histograms for the native entry points.
+    ///
+    /// Backends without a native bridge report no histograms.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the histograms cannot be retrieved.
+    async fn inspect_timing_state(&mut self) -> TorrentResult<TimingState> {
+        Ok(TimingState::default())
+    }
+    /// Signal notified whenever the backend has new events ready to poll.
+    ///
+    /// Backends without push notification return `None` and are polled on a fixed interval.
+    fn alert_signal(&self) -> Option<Arc<Notify>> {
+        None
+    }
+    /// Describe settings from the last [`Self::apply_config`] that were accepted but only take
+    /// effect after a restart, or `None` when everything requested is active.
+    fn pending_restart(&self) -> Option<String> {
+        None
+    }
+}
+
+fn unknown_authoring_job(operation: &'static str) -> revaer_torrent_core::TorrentError {
+    op_failed(
+        operation,
+        None,
+        LibtorrentError::InvalidInput {
+            field: "job_id",
+            reason: "authoring job not found",
+        },
+    )
+}
+
+/// Whether `request` is admitted only after its payload is read: a seed-mode hash sample or
+/// a pre-verify, both reported through [`EngineEvent::VerifyAdmitted`].
+pub(crate) fn checks_payload_before_admission(request: &AddTorrent) -> bool {
+    request.options.pre_verify.unwrap_or(false)
+        || request
+            .options
+            .hash_check_sample_pct
+            .is_some_and(|pct| pct > 0)
 }
 
 /// Construct a libtorrent session using the native bindings when available.
@@ -1,33 +1,81 @@
 use crate::error::{LibtorrentError, op_failed};
+use crate::ffi::bridge::{AlertWaker, ResumePayload};
 use crate::ffi::{SessionHandle, SessionHandleError};
 use async_trait::async_trait;
+use std::sync::Arc;
+use std::time::Duration;
+use tokio::sync::Notify;
 use uuid::Uuid;
 
-use crate::convert::{map_native_event, map_priority};
+use crate::convert::{FileTables, TorrentSlots, map_event_batch, map_priority, torrent_key};
 use crate::ffi::ffi;
-use crate::types::{EngineRuntimeConfig, EngineSettingsSnapshot};
+use crate::types::{
+    CallTiming, DiskIoBackend, EngineRuntimeConfig, EngineSettingsSnapshot, MetadataCacheStats,
+    SessionStats, SessionStatsMetric, TimingState,
+};
 use ffi::SourceKind;
 use revaer_torrent_core::{
     AddTorrent, EngineEvent, FileSelectionUpdate, PeerSnapshot, RemoveTorrent, TorrentRateLimit,
     TorrentResult, TorrentSource,
-    model::{TorrentAuthorFile, TorrentAuthorRequest, TorrentAuthorResult, TrackerAuth},
+    model::{
+        TorrentAuthorFile, TorrentAuthorFormat, TorrentAuthorRequest, TorrentAuthorResult,
+        TrackerAuth,
+    },
 };
 use tracing::warn;
 
-use super::LibTorrentSession;
+use super::engine_thread::EngineThread;
 use super::options::EngineOptionsPlan;
+use super::{LibTorrentSession, RestoreTorrent};
 
 pub(super) struct NativeSession {
-    inner: SessionHandle,
+    engine: EngineThread,
+    alerts: Arc<Notify>,
+    slots: TorrentSlots,
+    file_tables: FileTables,
+    stats_metrics: Arc<[SessionStatsMetric]>,
+    disk_io_backend: DiskIoBackend,
+    pending_restart: Option<String>,
 }
 
+/// Files fetched per poll while an announced file table is paged out of the session.
+const FILE_PAGE_SIZE: u32 = 4_096;
+
+/// How often an inline `create_torrent` checks whether its authoring job has finished.
+const AUTHORING_POLL_INTERVAL: Duration = Duration::from_millis(20);
+
 pub(super) fn create_session() -> TorrentResult<Box<dyn LibTorrentSession>> {
-    let options = base_options();
-    let inner = initialize_session(&options)?;
-    Ok(Box::new(NativeSession { inner }))
+    Ok(Box::new(NativeSession::connect(&base_options())?))
 }
 
 impl NativeSession {
+    fn connect(options: &ffi::SessionOptions) -> TorrentResult<Self> {
+        let mut inner = initialize_session(options)?;
+        let alerts = Arc::new(Notify::new());
+        inner
+            .pin_mut()
+            .set_alert_waker(Box::new(AlertWaker::new(Arc::clone(&alerts))));
+        let stats_metrics = inner
+            .as_ref()
+            .session_stats_metrics()
+            .into_iter()
+            .map(|metric| SessionStatsMetric {
+                name: metric.name,
+                counter: metric.counter,
+            })
+            .collect();
+        let engine = EngineThread::spawn(inner)?;
+        Ok(Self {
+            engine,
+            alerts,
+            slots: TorrentSlots::default(),
+            file_tables: FileTables::default(),
+            stats_metrics,
+            disk_io_backend: DiskIoBackend::Auto,
+            pending_restart: None,
+        })
+    }
+
     fn map_error(operation: &'static str, message: String) -> TorrentResult<()> {
         if message.is_empty() {
             Ok(())
@@ -62,16 +110,21 @@ impl NativeSession {
         }
     }
 
-    #[cfg(all(test, libtorrent_native))]
-    fn inspect_storage_state(&self) -> ffi::EngineStorageState {
-        let inner = self.inner.as_ref();
-        inner.inspect_storage_state()
+    async fn inspect_storage_state(&self) -> TorrentResult<ffi::EngineStorageState> {
+        self.engine
+            .call("inspect_storage_state", |session| {
+                session.as_ref().inspect_storage_state()
+            })
+            .await
     }
 
     #[cfg(all(test, libtorrent_native))]
-    fn inspect_peer_class_state(&self) -> ffi::EnginePeerClassState {
-        let inner = self.inner.as_ref();
-        inner.inspect_peer_class_state()
+    async fn inspect_peer_class_state(&self) -> TorrentResult<ffi::EnginePeerClassState> {
+        self.engine
+            .call("inspect_peer_class_state", |session| {
+                session.as_ref().inspect_peer_class_state()
+            })
+            .await
     }
 }
 
@@ -103,6 +156,66 @@ const fn map_max_connections(limit: Option<i32>) -> (i32, bool) {
     }
 }
 
+fn map_add_request(request: &AddTorrent) -> ffi::AddTorrentRequest {
+    let mut add_request = ffi::AddTorrentRequest {
+        id: torrent_key(request.id),
+        source_kind: match request.source {
+            TorrentSource::Magnet { .. } => SourceKind::Magnet,
+            TorrentSource::Metainfo { .. } => SourceKind::Metainfo,
+        },
+        magnet_uri: String::new(),
+        metainfo: Vec::new(),
+        download_dir: request.options.download_dir.clone().unwrap_or_default(),
+        has_download_dir: request.options.download_dir.is_some(),
+        storage_mode: 0,
+        has_storage_mode: request.options.storage_mode.is_some(),
+        sequential: request.options.sequential.unwrap_or_default(),
+        has_sequential_override: request.options.sequential.is_some(),
+        start_paused: request.options.start_paused.unwrap_or_default(),
+        has_start_paused: request.options.start_paused.is_some(),
+        auto_managed: request.options.auto_managed.unwrap_or_default(),
+        has_auto_managed: request.options.auto_managed.is_some(),
+        queue_position: request.options.queue_position.unwrap_or_default(),
+        has_queue_position: request.options.queue_position.is_some(),
+        seed_mode: request.options.seed_mode.unwrap_or(false),
+        has_seed_mode: request.options.seed_mode.is_some(),
+        hash_check_sample_pct: request.options.hash_check_sample_pct.unwrap_or(0),
+        has_hash_check_sample: request.options.hash_check_sample_pct.is_some(),
+        pre_verify: request.options.pre_verify.unwrap_or(false),
+        pex_enabled: request.options.pex_enabled.unwrap_or(true),
+        has_pex_enabled: request.options.pex_enabled.is_some(),
+        super_seeding: request.options.super_seeding.unwrap_or(false),
+        has_super_seeding: request.options.super_seeding.is_some(),
+        max_connections: 0,
+        has_max_connections: false,
+        comment: request.options.comment.clone().unwrap_or_default(),
+        has_comment: request.options.comment.is_some(),
+        source: request.options.source.clone().unwrap_or_default(),
+        has_source: request.options.source.is_some(),
+        private_flag: request.options.private.unwrap_or(false),
+        has_private: request.options.private.is_some(),
+        tags: request.options.tags.clone(),
+        trackers: request.options.trackers.clone(),
+        replace_trackers: request.options.replace_trackers,
+        web_seeds: request.options.web_seeds.clone(),
+        replace_web_seeds: request.options.replace_web_seeds,
+        tracker_auth: map_tracker_auth(request.options.tracker_auth.as_ref()),
+    };
+    (add_request.max_connections, add_request.has_max_connections) =
+        map_max_connections(request.options.connections_limit);
+
+    match &request.source {
+        TorrentSource::Magnet { uri } => add_request.magnet_uri.clone_from(uri),
+        TorrentSource::Metainfo { bytes } => add_request.metainfo.clone_from(bytes),
+    }
+
+    if let Some(mode) = request.options.storage_mode {
+        add_request.storage_mode = crate::types::StorageMode::from(mode).as_i32();
+    }
+
+    add_request
+}
+
 fn map_tracker_auth(auth: Option<&TrackerAuth>) -> ffi::TrackerAuthOptions {
     let Some(auth) = auth else {
         return ffi::TrackerAuthOptions {
@@ -146,6 +259,12 @@ fn map_author_request(request: &TorrentAuthorRequest) -> ffi::CreateTorrentReque
         has_comment: request.comment.is_some(),
         source: request.source.clone().unwrap_or_default(),
         has_source: request.source.is_some(),
+        hash_threads: request.hash_threads.unwrap_or_default(),
+        format: match request.format {
+            TorrentAuthorFormat::Hybrid => ffi::AuthorFormat::Hybrid,
+            TorrentAuthorFormat::V1 => ffi::AuthorFormat::V1Only,
+            TorrentAuthorFormat::V2 => ffi::AuthorFormat::V2Only,
+        },
     }
 }
 
@@ -162,6 +281,8 @@ fn map_author_result(result: ffi::CreateTorrentResult) -> TorrentAuthorResult {
         metainfo: result.metainfo,
         magnet_uri: result.magnet_uri,
         info_hash: result.info_hash,
+        info_hash_v1: (!result.info_hash_v1.is_empty()).then_some(result.info_hash_v1),
+        info_hash_v2: (!result.info_hash_v2.is_empty()).then_some(result.info_hash_v2),
         piece_length: result.piece_length,
         total_size: result.total_size,
         files,
@@ -262,6 +383,11 @@ pub(super) mod test_support {
                 coalesce_reads: true.into(),
                 coalesce_writes: true.into(),
                 use_disk_cache_pool: true.into(),
+                disk_io_backend: crate::types::DiskIoBackend::Auto,
+                aio_threads: None,
+                hashing_threads: None,
+                resume_checkpoint_interval_ms: None,
+                resume_max_inflight_saves: None,
                 listen_interfaces: Vec::new(),
                 ipv6_mode: Ipv6Mode::Disabled,
                 enable_dht: false,
@@ -317,87 +443,120 @@ pub(super) mod test_support {
 
 #[cfg(all(test, libtorrent_native))]
 fn create_native_session_for_tests() -> TorrentResult<NativeSession> {
-    let options = base_options();
-    let inner = initialize_session(&options)?;
-    Ok(NativeSession { inner })
+    NativeSession::connect(&base_options())
 }
 
 #[async_trait]
 impl LibTorrentSession for NativeSession {
     async fn add_torrent(&mut self, request: &AddTorrent) -> TorrentResult<()> {
-        let mut add_request = ffi::AddTorrentRequest {
-            id: request.id.to_string(),
-            source_kind: match request.source {
-                TorrentSource::Magnet { .. } => SourceKind::Magnet,
-                TorrentSource::Metainfo { .. } => SourceKind::Metainfo,
-            },
-            magnet_uri: String::new(),
-            metainfo: Vec::new(),
-            download_dir: request.options.download_dir.clone().unwrap_or_default(),
-            has_download_dir: request.options.download_dir.is_some(),
-            storage_mode: 0,
-            has_storage_mode: request.options.storage_mode.is_some(),
-            sequential: request.options.sequential.unwrap_or_default(),
-            has_sequential_override: request.options.sequential.is_some(),
-            start_paused: request.options.start_paused.unwrap_or_default(),
-            has_start_paused: request.options.start_paused.is_some(),
-            auto_managed: request.options.auto_managed.unwrap_or_default(),
-            has_auto_managed: request.options.auto_managed.is_some(),
-            queue_position: request.options.queue_position.unwrap_or_default(),
-            has_queue_position: request.options.queue_position.is_some(),
-            seed_mode: request.options.seed_mode.unwrap_or(false),
-            has_seed_mode: request.options.seed_mode.is_some(),
-            hash_check_sample_pct: request.options.hash_check_sample_pct.unwrap_or(0),
-            has_hash_check_sample: request.options.hash_check_sample_pct.is_some(),
-            pex_enabled: request.options.pex_enabled.unwrap_or(true),
-            has_pex_enabled: request.options.pex_enabled.is_some(),
-            super_seeding: request.options.super_seeding.unwrap_or(false),
-            has_super_seeding: request.options.super_seeding.is_some(),
-            max_connections: 0,
-            has_max_connections: false,
-            comment: request.options.comment.clone().unwrap_or_default(),
-            has_comment: request.options.comment.is_some(),
-            source: request.options.source.clone().unwrap_or_default(),
-            has_source: request.options.source.is_some(),
-            private_flag: request.options.private.unwrap_or(false),
-            has_private: request.options.private.is_some(),
-            tags: request.options.tags.clone(),
-            trackers: request.options.trackers.clone(),
-            replace_trackers: request.options.replace_trackers,
-            web_seeds: request.options.web_seeds.clone(),
-            replace_web_seeds: request.options.replace_web_seeds,
-            tracker_auth: map_tracker_auth(request.options.tracker_auth.as_ref()),
-        };
-        (add_request.max_connections, add_request.has_max_connections) =
-            map_max_connections(request.options.connections_limit);
-
-        match &request.source {
-            TorrentSource::Magnet { uri } => add_request.magnet_uri.clone_from(uri),
-            TorrentSource::Metainfo { bytes } => add_request.metainfo.clone_from(bytes),
-        }
-
-        if let Some(mode) = request.options.storage_mode {
-            add_request.storage_mode = crate::types::StorageMode::from(mode).as_i32();
-        }
-
-        let session = self.inner.pin_mut();
-        let result = session.add_torrent(&add_request);
+        let add_request = map_add_request(request);
+        let result = self
+            .engine
+            .call("add_torrent", move |session| {
+                session.pin_mut().add_torrent(&add_request)
+            })
+            .await?;
         Self::map_error("add_torrent", result)
     }
 
+    async fn add_torrents(
+        &mut self,
+        requests: &[AddTorrent],
+    ) -> TorrentResult<Vec<TorrentResult<()>>> {
+        let add_requests: Vec<ffi::AddTorrentRequest> =
+            requests.iter().map(map_add_request).collect();
+        let results = self
+            .engine
+            .call("add_torrents", move |session| {
+                session.pin_mut().add_torrents(&add_requests)
+            })
+            .await?;
+        Ok(results
+            .into_iter()
+            .zip(requests)
+            .map(|(message, request)| {
+                if message.is_empty() {
+                    Ok(())
+                } else {
+                    Err(op_failed(
+                        "add_torrents",
+                        Some(request.id),
+                        LibtorrentError::NativeFailure {
+                            operation: "add_torrents",
+                            message,
+                        },
+                    ))
+                }
+            })
+            .collect())
+    }
+
     async fn create_torrent(
         &mut self,
         request: &TorrentAuthorRequest,
     ) -> TorrentResult<TorrentAuthorResult> {
+        // Hashing runs on an authoring thread either way; waiting here keeps the engine thread
+        // free to serve other calls until the job stops.
+        let job_id = Uuid::new_v4();
+        self.start_create_torrent(job_id, request).await?;
+        loop {
+            let key = job_id.to_string();
+            let finished = self
+                .engine
+                .call("authoring_finished", move |session| {
+                    session.pin_mut().authoring_finished(&key)
+                })
+                .await?;
+            if finished {
+                return self.finish_create_torrent(job_id).await;
+            }
+            tokio::time::sleep(AUTHORING_POLL_INTERVAL).await;
+        }
+    }
+
+    async fn start_create_torrent(
+        &mut self,
+        job_id: Uuid,
+        request: &TorrentAuthorRequest,
+    ) -> TorrentResult<Option<TorrentAuthorResult>> {
+        let key = job_id.to_string();
         let create_request = map_author_request(request);
-        let session = self.inner.pin_mut();
-        let result = session.create_torrent(&create_request);
+        let result = self
+            .engine
+            .call("start_create_torrent", move |session| {
+                session
+                    .pin_mut()
+                    .start_create_torrent(&key, &create_request)
+            })
+            .await?;
+        Self::map_error("start_create_torrent", result).map(|()| None)
+    }
+
+    async fn cancel_create_torrent(&mut self, job_id: Uuid) -> TorrentResult<()> {
+        let key = job_id.to_string();
+        let result = self
+            .engine
+            .call("cancel_create_torrent", move |session| {
+                session.pin_mut().cancel_create_torrent(&key)
+            })
+            .await?;
+        Self::map_error("cancel_create_torrent", result)
+    }
+
+    async fn finish_create_torrent(&mut self, job_id: Uuid) -> TorrentResult<TorrentAuthorResult> {
+        let key = job_id.to_string();
+        let result = self
+            .engine
+            .call("finish_create_torrent", move |session| {
+                session.pin_mut().take_create_torrent_result(&key)
+            })
+            .await?;
         if !result.error.is_empty() {
             return Err(op_failed(
-                "create_torrent",
+                "finish_create_torrent",
                 None,
                 LibtorrentError::NativeFailure {
-                    operation: "create_torrent",
+                    operation: "finish_create_torrent",
                     message: result.error,
                 },
             ));
@@ -406,40 +565,81 @@ impl LibTorrentSession for NativeSession {
     }
 
     async fn remove_torrent(&mut self, id: Uuid, options: &RemoveTorrent) -> TorrentResult<()> {
-        let key = id.to_string();
-        let session = self.inner.pin_mut();
-        let result = session.remove_torrent(&key, options.with_data);
+        let key = torrent_key(id);
+        let with_data = options.with_data;
+        let result = self
+            .engine
+            .call("remove_torrent", move |session| {
+                session.pin_mut().remove_torrent(key, with_data)
+            })
+            .await?;
         Self::map_error("remove_torrent", result)
     }
 
     async fn pause_torrent(&mut self, id: Uuid) -> TorrentResult<()> {
-        let key = id.to_string();
-        let session = self.inner.pin_mut();
-        let result = session.pause_torrent(&key);
+        let key = torrent_key(id);
+        let result = self
+            .engine
+            .call("pause_torrent", move |session| {
+                session.pin_mut().pause_torrent(key)
+            })
+            .await?;
         Self::map_error("pause_torrent", result)
     }
 
     async fn resume_torrent(&mut self, id: Uuid) -> TorrentResult<()> {
-        let key = id.to_string();
-        let session = self.inner.pin_mut();
-        let result = session.resume_torrent(&key);
+        let key = torrent_key(id);
+        let result = self
+            .engine
+            .call("resume_torrent", move |session| {
+                session.pin_mut().resume_torrent(key)
+            })
+            .await?;
         Self::map_error("resume_torrent", result)
     }
 
     async fn set_sequential(&mut self, id: Uuid, sequential: bool) -> TorrentResult<()> {
-        let key = id.to_string();
-        let session = self.inner.pin_mut();
-        let result = session.set_sequential(&key, sequential);
+        let key = torrent_key(id);
+        let result = self
+            .engine
+            .call("set_sequential", move |session| {
+                session.pin_mut().set_sequential(key, sequential)
+            })
+            .await?;
         Self::map_error("set_sequential", result)
     }
 
-    async fn load_fastresume(&mut self, id: Uuid, payload: &[u8]) -> TorrentResult<()> {
-        let key = id.to_string();
-        let session = self.inner.pin_mut();
-        let result = session.load_fastresume(&key, payload);
+    async fn load_fastresume(&mut self, id: Uuid, payload: Arc<Vec<u8>>) -> TorrentResult<()> {
+        let key = torrent_key(id);
+        let result = self
+            .engine
+            .call("load_fastresume", move |session| {
+                session.pin_mut().load_fastresume(key, &payload)
+            })
+            .await?;
         Self::map_error("load_fastresume", result)
     }
 
+    async fn restore_torrents(&mut self, torrents: Vec<RestoreTorrent>) -> TorrentResult<()> {
+        // Payloads are shared with the worker's cache, so none is copied on the way over.
+        let requests: Vec<ffi::RestoreTorrentRequest> = torrents
+            .into_iter()
+            .map(|torrent| ffi::RestoreTorrentRequest {
+                id: torrent_key(torrent.id),
+                resume_data: Box::new(ResumePayload::new(torrent.fastresume)),
+                has_download_dir: torrent.download_dir.is_some(),
+                download_dir: torrent.download_dir.unwrap_or_default(),
+            })
+            .collect();
+        let result = self
+            .engine
+            .call("restore_torrents", move |session| {
+                session.pin_mut().restore_torrents(&requests)
+            })
+            .await?;
+        Self::map_error("restore_torrents", result)
+    }
+
     async fn update_limits(
         &mut self,
         id: Option<Uuid>,
@@ -447,7 +647,7 @@ impl LibTorrentSession for NativeSession {
     ) -> TorrentResult<()> {
         let request = ffi::LimitRequest {
             apply_globally: id.is_none(),
-            id: id.map_or_else(String::new, |value| value.to_string()),
+            id: torrent_key(id.unwrap_or_default()),
             download_bps: limits
                 .download_bps
                 .map_or(-1, |value| i64::try_from(value).unwrap_or(-1)),
@@ -455,8 +655,12 @@ impl LibTorrentSession for NativeSession {
                 .upload_bps
                 .map_or(-1, |value| i64::try_from(value).unwrap_or(-1)),
         };
-        let session = self.inner.pin_mut();
-        let result = session.update_limits(&request);
+        let result = self
+            .engine
+            .call("update_limits", move |session| {
+                session.pin_mut().update_limits(&request)
+            })
+            .await?;
         Self::map_error("update_limits", result)
     }
 
@@ -475,14 +679,18 @@ impl LibTorrentSession for NativeSession {
             .collect::<Vec<_>>();
 
         let request = ffi::SelectionRules {
-            id: id.to_string(),
+            id: torrent_key(id),
             include: rules.include.clone(),
             exclude: rules.exclude.clone(),
             priorities,
             skip_fluff: rules.skip_fluff,
         };
-        let session = self.inner.pin_mut();
-        let result = session.update_selection(&request);
+        let result = self
+            .engine
+            .call("update_selection", move |session| {
+                session.pin_mut().update_selection(&request)
+            })
+            .await?;
         Self::map_error("update_selection", result)
     }
 
@@ -492,7 +700,7 @@ impl LibTorrentSession for NativeSession {
         options: &revaer_torrent_core::model::TorrentOptionsUpdate,
     ) -> TorrentResult<()> {
         let mut request = ffi::UpdateOptionsRequest {
-            id: id.to_string(),
+            id: torrent_key(id),
             max_connections: 0,
             has_max_connections: false,
             pex_enabled: false,
@@ -546,39 +754,57 @@ impl LibTorrentSession for NativeSession {
             request.has_private = true;
         }
 
-        let session = self.inner.pin_mut();
-        let result = session.update_options(&request);
+        let result = self
+            .engine
+            .call("update_options", move |session| {
+                session.pin_mut().update_options(&request)
+            })
+            .await?;
         Self::map_error("update_options", result)
     }
 
     async fn reannounce(&mut self, id: Uuid) -> TorrentResult<()> {
-        let key = id.to_string();
-        let session = self.inner.pin_mut();
-        let result = session.reannounce(&key);
+        let key = torrent_key(id);
+        let result = self
+            .engine
+            .call("reannounce", move |session| {
+                session.pin_mut().reannounce(key)
+            })
+            .await?;
         Self::map_error("reannounce", result)
     }
 
     async fn move_torrent(&mut self, id: Uuid, download_dir: &str) -> TorrentResult<()> {
         let request = ffi::MoveTorrentRequest {
-            id: id.to_string(),
+            id: torrent_key(id),
             download_dir: download_dir.to_string(),
         };
-        let session = self.inner.pin_mut();
-        let result = session.move_torrent(&request);
+        let result = self
+            .engine
+            .call("move_torrent", move |session| {
+                session.pin_mut().move_torrent(&request)
+            })
+            .await?;
         Self::map_error("move_torrent", result)
     }
 
     async fn recheck(&mut self, id: Uuid) -> TorrentResult<()> {
-        let key = id.to_string();
-        let session = self.inner.pin_mut();
-        let result = session.recheck(&key);
+        let key = torrent_key(id);
+        let result = self
+            .engine
+            .call("recheck", move |session| session.pin_mut().recheck(key))
+            .await?;
         Self::map_error("recheck", result)
     }
 
     async fn peers(&mut self, id: Uuid) -> TorrentResult<Vec<PeerSnapshot>> {
-        let key = id.to_string();
-        let session = self.inner.pin_mut();
-        let peers = session.list_peers(&key);
+        let key = torrent_key(id);
+        let peers = self
+            .engine
+            .call("query_peers", move |session| {
+                session.pin_mut().list_peers(key)
+            })
+            .await?;
         Ok(peers.into_iter().map(map_peer_info).collect())
     }
 
@@ -588,12 +814,16 @@ impl LibTorrentSession for NativeSession {
         trackers: &revaer_torrent_core::model::TorrentTrackersUpdate,
     ) -> TorrentResult<()> {
         let request = ffi::UpdateTrackersRequest {
-            id: id.to_string(),
+            id: torrent_key(id),
             trackers: trackers.trackers.clone(),
             replace: trackers.replace,
         };
-        let session = self.inner.pin_mut();
-        let result = session.update_trackers(&request);
+        let result = self
+            .engine
+            .call("update_trackers", move |session| {
+                session.pin_mut().update_trackers(&request)
+            })
+            .await?;
         Self::map_error("update_trackers", result)
     }
 
@@ -603,12 +833,16 @@ impl LibTorrentSession for NativeSession {
         web_seeds: &revaer_torrent_core::model::TorrentWebSeedsUpdate,
     ) -> TorrentResult<()> {
         let request = ffi::UpdateWebSeedsRequest {
-            id: id.to_string(),
+            id: torrent_key(id),
             web_seeds: web_seeds.web_seeds.clone(),
             replace: web_seeds.replace,
         };
-        let session = self.inner.pin_mut();
-        let result = session.update_web_seeds(&request);
+        let result = self
+            .engine
+            .call("update_web_seeds", move |session| {
+                session.pin_mut().update_web_seeds(&request)
+            })
+            .await?;
         Self::map_error("update_web_seeds", result)
     }
 
@@ -634,8 +868,14 @@ impl LibTorrentSession for NativeSession {
             }
             None => (0, false),
         };
-        let session = self.inner.pin_mut();
-        let result = session.set_piece_deadline(&id.to_string(), piece, deadline, has_deadline);
+        let result = self
+            .engine
+            .call("set_piece_deadline", move |session| {
+                session
+                    .pin_mut()
+                    .set_piece_deadline(torrent_key(id), piece, deadline, has_deadline)
+            })
+            .await?;
         Self::map_error("set_piece_deadline", result)
     }
 
@@ -644,38 +884,172 @@ impl LibTorrentSession for NativeSession {
         for warning in &plan.warnings {
             warn!(%warning, "native engine guard rail applied");
         }
-        let session = self.inner.pin_mut();
-        let result = session.apply_engine_profile(&plan.options);
-        Self::map_error("apply_config", result)
+        let result = self
+            .engine
+            .call("apply_config", move |session| {
+                session.pin_mut().apply_engine_profile(&plan.options)
+            })
+            .await?;
+        Self::map_error("apply_config", result)?;
+        self.pending_restart = None;
+        if config.disk_io_backend != self.disk_io_backend {
+            let state = self.inspect_storage_state().await?;
+            if state.disk_io_backend == config.disk_io_backend.as_u8() {
+                self.disk_io_backend = config.disk_io_backend;
+            } else {
+                warn!(
+                    requested = ?config.disk_io_backend,
+                    active = ?self.disk_io_backend,
+                    "disk I/O backend unchanged; it can only switch before torrents are attached"
+                );
+                self.pending_restart = Some(format!(
+                    "disk_io_backend {:?} requires a restart; {:?} remains active",
+                    config.disk_io_backend, self.disk_io_backend
+                ));
+            }
+        }
+        Ok(())
     }
 
     async fn inspect_settings(&mut self) -> TorrentResult<EngineSettingsSnapshot> {
-        let session = self.inner.pin_mut();
-        let snapshot = session.inspect_settings_state();
+        let snapshot = self
+            .engine
+            .call("inspect_settings", |session| {
+                session.as_ref().inspect_settings_state()
+            })
+            .await?;
         Ok(Self::map_settings_snapshot(snapshot))
     }
 
-    async fn poll_events(&mut self) -> TorrentResult<Vec<EngineEvent>> {
-        let session = self.inner.pin_mut();
-        let raw_events = session.poll_events();
-        let mut events = Vec::with_capacity(raw_events.len());
+    async fn inspect_metadata_cache(&mut self) -> TorrentResult<MetadataCacheStats> {
+        let state = self
+            .engine
+            .call("inspect_metadata_cache", |session| {
+                session.as_ref().inspect_metadata_cache_state()
+            })
+            .await?;
+        Ok(MetadataCacheStats {
+            entries: state.entries,
+            shared_entries: state.shared_entries,
+            retained_entries: state.retained_entries,
+            bytes: state.bytes,
+            retained_bytes: state.retained_bytes,
+            hits: state.hits,
+            misses: state.misses,
+        })
+    }
 
-        for native in raw_events {
-            let torrent_id = Uuid::parse_str(&native.id).ok().filter(|id| !id.is_nil());
-            events.extend(map_native_event(torrent_id, native));
-        }
+    async fn inspect_session_stats(&mut self) -> TorrentResult<SessionStats> {
+        let sample = self
+            .engine
+            .call("inspect_session_stats", |session| {
+                session.as_ref().inspect_session_stats()
+            })
+            .await?;
+        Ok(SessionStats {
+            sequence: sample.sequence,
+            metrics: Arc::clone(&self.stats_metrics),
+            values: sample.values,
+        })
+    }
+
+    async fn inspect_timing_state(&mut self) -> TorrentResult<TimingState> {
+        let state = self
+            .engine
+            .call("inspect_timing_state", |session| {
+                session.as_ref().inspect_timing_state()
+            })
+            .await?;
+        Ok(TimingState {
+            bucket_bounds: state
+                .bucket_bounds_ns
+                .into_iter()
+                .map(Duration::from_nanos)
+                .collect(),
+            calls: state
+                .calls
+                .into_iter()
+                .map(|call| CallTiming {
+                    name: call.name,
+                    calls: call.calls,
+                    total: Duration::from_nanos(call.total_ns),
+                    max: Duration::from_nanos(call.max_ns),
+                    buckets: call.buckets,
+                })
+                .collect(),
+        })
+    }
 
+    async fn poll_events(&mut self) -> TorrentResult<Vec<EngineEvent>> {
+        let batch = self
+            .engine
+            .call("poll_events", |session| session.pin_mut().poll_events())
+            .await?;
+        self.file_tables.announce(&batch);
+        let mut events = self
+            .file_tables
+            .hold_dependents(map_event_batch(&mut self.slots, batch));
+        if let Some((torrent_id, offset)) = self.file_tables.next_request() {
+            let key = torrent_key(torrent_id);
+            let page = self
+                .engine
+                .call("list_files", move |session| {
+                    session.pin_mut().list_files(key, offset, FILE_PAGE_SIZE)
+                })
+                .await;
+            match page {
+                Ok(page) => {
+                    events.extend(self.file_tables.complete_page(torrent_id, page));
+                    if self.file_tables.next_request().is_some() {
+                        // Poll again promptly rather than waiting for the next alert or heartbeat.
+                        self.alerts.notify_one();
+                    }
+                }
+                // The events above are already mapped; losing them would drop state changes
+                // and resume data, so the page is retried on a later poll instead.
+                Err(err) => {
+                    let released = self.file_tables.fail_page(torrent_id);
+                    let abandoned = released.is_some();
+                    events.extend(released.into_iter().flatten());
+                    warn!(
+                        %torrent_id,
+                        offset,
+                        abandoned,
+                        error = %err,
+                        "failed to fetch file table page"
+                    );
+                }
+            }
+        }
         Ok(events)
     }
+
+    async fn flush_resume_data(&mut self) -> TorrentResult<u32> {
+        self.engine
+            .call("flush_resume_data", |session| {
+                session.pin_mut().flush_resume_data()
+            })
+            .await
+    }
+
+    fn alert_signal(&self) -> Option<Arc<Notify>> {
+        Some(Arc::clone(&self.alerts))
+    }
 }
 
 #[cfg(all(test, libtorrent_native))]
 mod tests {
     use super::test_support::NativeSessionHarness;
     use super::*;
-    use crate::ffi::ffi::{NativeEvent, NativeEventKind, NativeTorrentState};
+    use crate::convert::map_native_event;
+    use crate::ffi::ffi::{
+        NativeEvent, NativeEventBatch, NativeEventKind, NativeSlotBinding, NativeTorrentState,
+        NativeTorrentUpdate, NativeUpdateKind,
+    };
+    use crate::ffi::oracle::ffi::{MetainfoOverrideCase, metainfo_override_parity};
     use crate::types::{IpFilterRule, IpFilterRuntimeConfig, Ipv6Mode, PeerClassRuntimeConfig};
     use anyhow::{Result, anyhow};
+    use revaer_events::TorrentState;
     use revaer_torrent_core::{
         AddTorrent, AddTorrentOptions, EngineEvent, FileSelectionRules, TorrentSource,
         model::{TorrentAuthorRequest, TrackerAuth},
@@ -710,6 +1084,110 @@ mod tests {
         fs::write(root.join("sample"), vec![0_u8; piece_len])
     }
 
+    /// Deterministic xorshift generator so parity failures reproduce from the case number.
+    struct FuzzRng(u64);
+
+    impl FuzzRng {
+        fn next(&mut self) -> u64 {
+            self.0 ^= self.0 << 13;
+            self.0 ^= self.0 >> 7;
+            self.0 ^= self.0 << 17;
+            self.0
+        }
+
+        fn below(&mut self, bound: usize) -> usize {
+            usize::try_from(self.next() % u64::try_from(bound).unwrap_or(1)).unwrap_or(0)
+        }
+
+        fn chance(&mut self) -> bool {
+            self.next() & 1 == 1
+        }
+
+        fn text(&mut self) -> String {
+            const ALPHABET: &[u8] = b"abcoz-_ 09:de";
+            (0..self.below(12))
+                .map(|_| char::from(ALPHABET[self.below(ALPHABET.len())]))
+                .collect()
+        }
+    }
+
+    fn bencode_str(value: &[u8]) -> Vec<u8> {
+        let mut out = format!("{}:", value.len()).into_bytes();
+        out.extend_from_slice(value);
+        out
+    }
+
+    fn bencode_dict(mut entries: Vec<(Vec<u8>, Vec<u8>)>) -> Vec<u8> {
+        entries.sort();
+        entries.dedup_by(|left, right| left.0 == right.0);
+        let mut out = vec![b'd'];
+        for (key, value) in entries {
+            out.extend(bencode_str(&key));
+            out.extend(value);
+        }
+        out.push(b'e');
+        out
+    }
+
+    /// Canonical metainfo with a random mix of keys sorting around the overridden ones.
+    fn fuzz_metainfo(rng: &mut FuzzRng) -> Vec<u8> {
+        let mut info = vec![
+            (b"name".to_vec(), bencode_str(rng.text().as_bytes())),
+            (b"piece length".to_vec(), b"i16384e".to_vec()),
+            (
+                b"pieces".to_vec(),
+                bencode_str(&vec![7_u8; 20 * (1 + rng.below(64))]),
+            ),
+        ];
+        if rng.chance() {
+            info.push((
+                b"length".to_vec(),
+                format!("i{}e", rng.next() >> 40).into_bytes(),
+            ));
+        } else {
+            let file = bencode_dict(vec![
+                (b"length".to_vec(), b"i1e".to_vec()),
+                (
+                    b"path".to_vec(),
+                    [b"l".as_slice(), &bencode_str(b"f"), b"e"].concat(),
+                ),
+            ]);
+            info.push((b"files".to_vec(), [b"l".as_slice(), &file, b"e"].concat()));
+        }
+        for key in ["private", "source", "pr", "privatez", "sourcez", "s"] {
+            if rng.below(3) == 0 {
+                let value = if key == "private" && rng.chance() {
+                    format!("i{}e", rng.below(2)).into_bytes()
+                } else {
+                    bencode_str(rng.text().as_bytes())
+                };
+                info.push((key.as_bytes().to_vec(), value));
+            }
+        }
+
+        let info = if rng.below(32) == 0 {
+            bencode_str(b"not a dictionary")
+        } else {
+            bencode_dict(info)
+        };
+        let mut root = Vec::new();
+        if rng.below(32) != 0 {
+            root.push((b"info".to_vec(), info));
+        }
+        for key in ["announce", "comment", "commentz", "co", "created by", "a"] {
+            if rng.below(3) == 0 {
+                root.push((key.as_bytes().to_vec(), bencode_str(rng.text().as_bytes())));
+            }
+        }
+        if rng.chance() {
+            root.push((b"creation date".to_vec(), b"i1700000000e".to_vec()));
+        }
+        if rng.below(64) == 0 {
+            return [b"l".as_slice(), &bencode_dict(root), b"e"].concat();
+        }
+        bencode_dict(root)
+    }
+
     #[tokio::test]
     async fn native_session_helper_functions_cover_defaults_and_errors() -> TorrentResult<()> {
         let options = base_options();
@@ -755,6 +1233,40 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn metainfo_override_splice_matches_entry_round_trip() {
+        let mut rng = FuzzRng(0x9e37_79b9_7f4a_7c15);
+        for case in 0..2_000 {
+            let metainfo = fuzz_metainfo(&mut rng);
+            let mut options = AddTorrentOptions::default();
+            if rng.chance() {
+                options.comment = Some(rng.text());
+            }
+            if rng.chance() {
+                options.source = Some(rng.text());
+            }
+            if rng.chance() {
+                options.private = Some(rng.chance());
+            }
+            let descriptor = AddTorrent {
+                id: Uuid::nil(),
+                source: TorrentSource::metainfo(metainfo.clone()),
+                options,
+            };
+            let request = map_add_request(&descriptor);
+            let overrides = MetainfoOverrideCase {
+                comment: request.comment,
+                has_comment: request.has_comment,
+                source: request.source,
+                has_source: request.has_source,
+                private_flag: request.private_flag,
+                has_private: request.has_private,
+            };
+            let mismatch = metainfo_override_parity(&metainfo, &overrides);
+            assert!(mismatch.is_empty(), "case {case}: {mismatch}");
+        }
+    }
+
     #[test]
     fn native_mapping_helpers_preserve_optionals_and_clamp_invalid_rates() {
         assert_eq!(map_max_connections(Some(32)), (32, true));
@@ -792,8 +1304,12 @@ mod tests {
             private: true,
             comment: Some("note".to_string()),
             source: Some("source".to_string()),
+            hash_threads: Some(4),
+            format: TorrentAuthorFormat::V2,
         };
         let mapped_request = map_author_request(&request);
+        assert_eq!(mapped_request.hash_threads, 4);
+        assert_eq!(mapped_request.format, ffi::AuthorFormat::V2Only);
         assert_eq!(mapped_request.root_path, request.root_path);
         assert_eq!(mapped_request.trackers, request.trackers);
         assert_eq!(mapped_request.web_seeds, request.web_seeds);
@@ -907,7 +1423,11 @@ mod tests {
         let descriptor = AddTorrent {
             id: Uuid::new_v4(),
             source: TorrentSource::metainfo(seed_mode_metainfo(&VALID_PIECE_HASH)),
-            options: AddTorrentOptions::default(),
+            options: AddTorrentOptions {
+                comment: Some("memoized".to_string()),
+                source: Some("revaer".to_string()),
+                ..AddTorrentOptions::default()
+            },
         };
 
         harness.session.add_torrent(&descriptor).await?;
@@ -925,6 +1445,8 @@ mod tests {
             if let EngineEvent::MetadataUpdated {
                 torrent_id,
                 download_dir,
+                comment,
+                source,
                 ..
             } = event
                 && torrent_id == descriptor.id
@@ -933,6 +1455,8 @@ mod tests {
                     download_dir.as_deref(),
                     Some(target.to_string_lossy().as_ref())
                 );
+                assert_eq!(comment.as_deref(), Some("memoized"));
+                assert_eq!(source.as_deref(), Some("revaer"));
                 saw_metadata = true;
             }
         }
@@ -957,12 +1481,219 @@ mod tests {
             },
         };
 
+        // The sample runs on a verify job, so the add is accepted and fails on admission.
+        harness.session.add_torrent(&descriptor).await?;
+        let message = await_admission(&mut harness.session, descriptor.id)
+            .await?
+            .err()
+            .ok_or_else(|| anyhow!("expected hash sample failure"))?;
+        assert!(message.contains("seed-mode sample failed") || message.contains("hash mismatch"));
+        Ok(())
+    }
+
+    /// Polls until `id` is admitted after its payload check, returning the reported error when
+    /// the check fails instead.
+    async fn await_admission(
+        session: &mut NativeSession,
+        id: Uuid,
+    ) -> TorrentResult<Result<(), String>> {
+        for _ in 0..200 {
+            for event in session.poll_events().await? {
+                match event {
+                    EngineEvent::Error {
+                        torrent_id,
+                        message,
+                    } if torrent_id == id => return Ok(Err(message)),
+                    EngineEvent::VerifyAdmitted { torrent_id } if torrent_id == id => {
+                        return Ok(Ok(()));
+                    }
+                    _ => {}
+                }
+            }
+            sleep(Duration::from_millis(10)).await;
+        }
+        Err(anyhow!("admission was never reported"))
+    }
+
+    #[tokio::test]
+    async fn native_session_samples_multi_file_seed_payloads() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let config = harness.runtime_config();
+        harness.session.apply_config(&config).await?;
+
+        let write_library = |library: &Path, corrupt: bool| -> std::io::Result<()> {
+            let root = library.join("show");
+            fs::create_dir_all(&root)?;
+            for (index, size) in [(0_u8, 150_000_usize), (1, 90_001), (2, 300_000)] {
+                let mut payload = (0..size)
+                    .map(|offset| u8::try_from((offset + usize::from(index)) % 253).unwrap_or(0))
+                    .collect::<Vec<_>>();
+                if corrupt && index == 2 {
+                    payload[size - 1] ^= 0xFF;
+                }
+                fs::write(root.join(format!("episode-{index}.bin")), payload)?;
+            }
+            Ok(())
+        };
+        let intact = harness.download_path().join("intact");
+        let corrupted = harness.download_path().join("corrupted");
+        write_library(&intact, false)?;
+        write_library(&corrupted, true)?;
+
+        let authored = harness
+            .session
+            .create_torrent(&TorrentAuthorRequest {
+                root_path: intact.join("show").to_string_lossy().into_owned(),
+                piece_length: Some(16_384),
+                format: TorrentAuthorFormat::Hybrid,
+                ..TorrentAuthorRequest::default()
+            })
+            .await?;
+        let seed = |library: &Path| AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(authored.metainfo.clone()),
+            options: AddTorrentOptions {
+                seed_mode: Some(true),
+                hash_check_sample_pct: Some(100),
+                download_dir: Some(library.to_string_lossy().into_owned()),
+                ..AddTorrentOptions::default()
+            },
+        };
+
+        let corrupted_add = seed(&corrupted);
+        harness.session.add_torrent(&corrupted_add).await?;
+        let message = await_admission(&mut harness.session, corrupted_add.id)
+            .await?
+            .err()
+            .ok_or_else(|| anyhow!("expected hash sample failure"))?;
+        assert!(message.contains("hash mismatch"));
+
+        let intact_add = seed(&intact);
+        harness.session.add_torrent(&intact_add).await?;
+        await_admission(&mut harness.session, intact_add.id)
+            .await?
+            .map_err(|message| anyhow!("intact seed failed its sample: {message}"))?;
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_pre_verifies_existing_payloads() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let config = harness.runtime_config();
+        harness.session.apply_config(&config).await?;
+
+        let write_library = |library: &Path, corrupt: bool| -> std::io::Result<()> {
+            let root = library.join("album");
+            fs::create_dir_all(&root)?;
+            for (index, size) in [(0_u8, 120_000_usize), (1, 70_003)] {
+                let mut payload = (0..size)
+                    .map(|offset| {
+                        u8::try_from((offset * 7 + usize::from(index)) % 251).unwrap_or(0)
+                    })
+                    .collect::<Vec<_>>();
+                if corrupt && index == 1 {
+                    payload[0] ^= 0xFF;
+                }
+                fs::write(root.join(format!("track-{index}.bin")), payload)?;
+            }
+            Ok(())
+        };
+        let intact = harness.download_path().join("verified");
+        let partial = harness.download_path().join("partial");
+        write_library(&intact, false)?;
+        write_library(&partial, true)?;
+
+        let authored = harness
+            .session
+            .create_torrent(&TorrentAuthorRequest {
+                root_path: intact.join("album").to_string_lossy().into_owned(),
+                piece_length: Some(16_384),
+                ..TorrentAuthorRequest::default()
+            })
+            .await?;
+        let verify = |library: &Path| AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(authored.metainfo.clone()),
+            options: AddTorrentOptions {
+                pre_verify: Some(true),
+                download_dir: Some(library.to_string_lossy().into_owned()),
+                ..AddTorrentOptions::default()
+            },
+        };
+
+        // Verification runs in the background; the torrent is admitted once it finishes and
+        // an intact payload starts out seeding.
+        let verified = verify(&intact);
+        harness.session.add_torrent(&verified).await?;
+        let mut seeding = false;
+        let mut verified_pieces = 0;
+        let mut admitted = false;
+        for _ in 0..200 {
+            for event in harness.session.poll_events().await? {
+                match event {
+                    EngineEvent::Error {
+                        torrent_id,
+                        message,
+                    } if torrent_id == verified.id => {
+                        return Err(anyhow!("pre-verified add failed: {message}"));
+                    }
+                    EngineEvent::VerifyProgress {
+                        torrent_id,
+                        pieces_done,
+                        pieces_total,
+                    } if torrent_id == verified.id => {
+                        assert!(pieces_done <= pieces_total);
+                        verified_pieces = pieces_done;
+                    }
+                    EngineEvent::VerifyAdmitted { torrent_id } if torrent_id == verified.id => {
+                        admitted = true;
+                    }
+                    EngineEvent::StateChanged { torrent_id, state }
+                        if torrent_id == verified.id
+                            && matches!(state, TorrentState::Seeding | TorrentState::Completed) =>
+                    {
+                        seeding = true;
+                    }
+                    _ => {}
+                }
+            }
+            if seeding {
+                break;
+            }
+            sleep(Duration::from_millis(10)).await;
+        }
+        assert!(seeding, "verified payload should be admitted as a seed");
+        assert!(admitted, "admission should be reported");
+        assert!(verified_pieces > 0, "verify progress should be reported");
+        harness
+            .session
+            .remove_torrent(verified.id, &RemoveTorrent::default())
+            .await?;
+
+        // Mismatched pieces are left for libtorrent to fetch rather than failing the add, and
+        // removing a torrent mid-verify simply drops its admission.
+        let partial_add = verify(&partial);
+        harness.session.add_torrent(&partial_add).await?;
+        harness
+            .session
+            .remove_torrent(partial_add.id, &RemoveTorrent::default())
+            .await?;
+
         let err = harness
             .session
-            .add_torrent(&descriptor)
+            .add_torrent(&AddTorrent {
+                id: Uuid::new_v4(),
+                source: TorrentSource::magnet(
+                    "magnet:?xt=urn:btih:00112233445566778899aabbccddeeff00112233",
+                ),
+                options: AddTorrentOptions {
+                    pre_verify: Some(true),
+                    ..AddTorrentOptions::default()
+                },
+            })
             .await
             .err()
-            .ok_or_else(|| anyhow!("expected hash sample failure"))?;
+            .ok_or_else(|| anyhow!("expected pre-verify rejection"))?;
         let revaer_torrent_core::TorrentError::OperationFailed { source, .. } = err else {
             return Err(anyhow!("expected operation failure"));
         };
@@ -972,7 +1703,337 @@ mod tests {
         let LibtorrentError::NativeFailure { message, .. } = *source else {
             return Err(anyhow!("expected native failure"));
         };
-        assert!(message.contains("seed-mode sample failed") || message.contains("hash mismatch"));
+        assert!(message.contains("pre_verify requires metainfo payload"));
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_decodes_fastresume_on_load() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let config = harness.runtime_config();
+        harness.session.apply_config(&config).await?;
+
+        let err = harness
+            .session
+            .load_fastresume(Uuid::new_v4(), Arc::new(b"not bencoded".to_vec()))
+            .await
+            .err()
+            .ok_or_else(|| anyhow!("expected resume decode failure"))?;
+        let revaer_torrent_core::TorrentError::OperationFailed { source, .. } = err else {
+            return Err(anyhow!("expected operation failure"));
+        };
+        let source = source
+            .downcast::<LibtorrentError>()
+            .map_err(|_| anyhow!("expected libtorrent error"))?;
+        let LibtorrentError::NativeFailure { message, .. } = *source else {
+            return Err(anyhow!("expected native failure"));
+        };
+        assert!(message.contains("resume data parse failed"));
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_flushes_resume_data_on_demand() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let mut config = harness.runtime_config();
+        config.resume_checkpoint_interval_ms = Some(3_600_000);
+        config.resume_max_inflight_saves = Some(1);
+        harness.session.apply_config(&config).await?;
+
+        let root = harness.download_path().join("checkpoint");
+        fs::create_dir_all(&root)?;
+        fs::write(root.join("payload.bin"), vec![5_u8; 2 * 16_384])?;
+        let authored = harness
+            .session
+            .create_torrent(&TorrentAuthorRequest {
+                root_path: root.to_string_lossy().into_owned(),
+                piece_length: Some(16_384),
+                ..TorrentAuthorRequest::default()
+            })
+            .await?;
+        let descriptor = AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(authored.metainfo),
+            options: AddTorrentOptions {
+                seed_mode: Some(true),
+                download_dir: Some(harness.download_path().to_string_lossy().into_owned()),
+                ..AddTorrentOptions::default()
+            },
+        };
+        harness.session.add_torrent(&descriptor).await?;
+
+        let mut saved = false;
+        for _ in 0..200 {
+            harness.session.flush_resume_data().await?;
+            saved |= harness.session.poll_events().await?.iter().any(|event| {
+                matches!(
+                    event,
+                    EngineEvent::ResumeData { torrent_id, payload }
+                        if *torrent_id == descriptor.id && !payload.is_empty()
+                )
+            });
+            if saved {
+                break;
+            }
+            sleep(Duration::from_millis(10)).await;
+        }
+        assert!(saved, "flush should checkpoint the new torrent");
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_restores_stored_torrents_in_bulk() -> TorrentResult<()> {
+        let mut source = NativeSessionHarness::new()?;
+        let config = source.runtime_config();
+        source.session.apply_config(&config).await?;
+
+        let root = source.download_path().join("restore");
+        fs::create_dir_all(&root)?;
+        fs::write(root.join("payload.bin"), vec![9_u8; 2 * 16_384])?;
+        let authored = source
+            .session
+            .create_torrent(&TorrentAuthorRequest {
+                root_path: root.to_string_lossy().into_owned(),
+                piece_length: Some(16_384),
+                ..TorrentAuthorRequest::default()
+            })
+            .await?;
+        let download_dir = source.download_path().to_string_lossy().into_owned();
+        let descriptor = AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(authored.metainfo),
+            options: AddTorrentOptions {
+                seed_mode: Some(true),
+                download_dir: Some(download_dir.clone()),
+                ..AddTorrentOptions::default()
+            },
+        };
+        source.session.add_torrent(&descriptor).await?;
+
+        let mut payload = None;
+        for _ in 0..200 {
+            source.session.flush_resume_data().await?;
+            payload =
+                source
+                    .session
+                    .poll_events()
+                    .await?
+                    .into_iter()
+                    .find_map(|event| match event {
+                        EngineEvent::ResumeData {
+                            torrent_id,
+                            payload,
+                        } if torrent_id == descriptor.id => Some(payload),
+                        _ => None,
+                    });
+            if payload.is_some() {
+                break;
+            }
+            sleep(Duration::from_millis(10)).await;
+        }
+        let payload = payload.ok_or_else(|| anyhow!("expected resume data"))?;
+
+        let mut target = NativeSessionHarness::new()?;
+        let config = target.runtime_config();
+        target.session.apply_config(&config).await?;
+        let corrupt_id = Uuid::new_v4();
+        target
+            .session
+            .restore_torrents(vec![
+                RestoreTorrent {
+                    id: descriptor.id,
+                    fastresume: Arc::new(payload),
+                    download_dir: Some(download_dir),
+                },
+                RestoreTorrent {
+                    id: corrupt_id,
+                    fastresume: Arc::new(b"not bencoded".to_vec()),
+                    download_dir: None,
+                },
+            ])
+            .await?;
+
+        let mut corrupt_reported = false;
+        let mut finished = None;
+        for _ in 0..200 {
+            for event in target.session.poll_events().await? {
+                match event {
+                    EngineEvent::Error { torrent_id, .. } if torrent_id == corrupt_id => {
+                        corrupt_reported = true;
+                    }
+                    EngineEvent::RestoreFinished { restored, failed } => {
+                        finished = Some((restored, failed));
+                    }
+                    _ => {}
+                }
+            }
+            if finished.is_some() {
+                break;
+            }
+            sleep(Duration::from_millis(10)).await;
+        }
+        assert!(corrupt_reported, "corrupt payload should be reported");
+        assert_eq!(finished, Some((1, 1)));
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_adds_torrents_in_bulk_with_per_item_errors() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let config = harness.runtime_config();
+        harness.session.apply_config(&config).await?;
+
+        let root = harness.download_path().join("bulk");
+        fs::create_dir_all(&root)?;
+        fs::write(root.join("payload.bin"), vec![5_u8; 16_384])?;
+        let authored = harness
+            .session
+            .create_torrent(&TorrentAuthorRequest {
+                root_path: root.to_string_lossy().into_owned(),
+                piece_length: Some(16_384),
+                ..TorrentAuthorRequest::default()
+            })
+            .await?;
+        let valid = AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(authored.metainfo.clone()),
+            options: AddTorrentOptions::default(),
+        };
+        let empty = AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(Vec::new()),
+            options: AddTorrentOptions::default(),
+        };
+        let duplicate = AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(authored.metainfo),
+            options: AddTorrentOptions::default(),
+        };
+
+        let results = harness
+            .session
+            .add_torrents(&[valid.clone(), empty, duplicate])
+            .await?;
+        assert_eq!(results.len(), 3);
+        assert!(results[0].is_ok(), "valid torrent should be submitted");
+        assert!(
+            results[1].is_err(),
+            "empty metainfo should be rejected up front"
+        );
+        assert!(
+            results[2].is_err(),
+            "duplicate info hash should be rejected"
+        );
+
+        let mut admitted = false;
+        let mut failed = false;
+        for _ in 0..200 {
+            for event in harness.session.poll_events().await? {
+                match event {
+                    EngineEvent::Error { torrent_id, .. } if torrent_id == valid.id => {
+                        failed = true;
+                    }
+                    EngineEvent::StateChanged { torrent_id, .. }
+                    | EngineEvent::Progress { torrent_id, .. }
+                        if torrent_id == valid.id =>
+                    {
+                        admitted = true;
+                    }
+                    _ => {}
+                }
+            }
+            if admitted || failed {
+                break;
+            }
+            sleep(Duration::from_millis(10)).await;
+        }
+        assert!(!failed, "valid torrent should not fail to add");
+        assert!(admitted, "async add should register the torrent");
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_samples_session_stats() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+
+        let mut stats = harness.session.inspect_session_stats().await?;
+        for _ in 0..200 {
+            if stats.sequence > 0 {
+                break;
+            }
+            harness.session.poll_events().await?;
+            sleep(Duration::from_millis(10)).await;
+            stats = harness.session.inspect_session_stats().await?;
+        }
+        assert!(stats.sequence > 0, "polling should request a stats sample");
+        assert_eq!(stats.values.len(), stats.metrics.len());
+        assert!(stats.get("disk.queued_disk_jobs").is_some());
+        assert!(stats.get("net.sent_bytes").is_some());
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_times_bridge_entry_points() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        harness.session.poll_events().await?;
+        harness.session.poll_events().await?;
+
+        let timing = harness.session.inspect_timing_state().await?;
+        let polls = timing
+            .get("poll_events")
+            .ok_or_else(|| anyhow!("expected poll_events timing"))?;
+        assert!(polls.calls >= 2);
+        assert_eq!(polls.buckets.len(), timing.bucket_bounds.len());
+        assert_eq!(polls.buckets.iter().sum::<u64>(), polls.calls);
+        assert!(polls.max <= polls.total);
+        assert!(timing.quantile("poll_events", 990).is_some());
+        assert_eq!(timing.get("recheck").map(|call| call.calls), Some(0));
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_reuses_cached_metadata_for_re_adds() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let config = harness.runtime_config();
+        harness.session.apply_config(&config).await?;
+
+        let descriptor = AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(seed_mode_metainfo(&VALID_PIECE_HASH)),
+            options: AddTorrentOptions::default(),
+        };
+        harness.session.add_torrent(&descriptor).await?;
+        let first = harness.session.inspect_metadata_cache().await?;
+        assert_eq!(first.entries, 1);
+        assert_eq!((first.hits, first.misses), (0, 1));
+        assert!(first.bytes > 0);
+        assert_eq!(first.retained_entries, 0);
+
+        harness
+            .session
+            .remove_torrent(descriptor.id, &RemoveTorrent::default())
+            .await?;
+        let removed = harness.session.inspect_metadata_cache().await?;
+        assert_eq!(removed.retained_entries, 1);
+        assert!(
+            removed.retained_bytes > first.bytes,
+            "a retained entry also accounts for its owned torrent_info"
+        );
+
+        let re_added = AddTorrent {
+            id: Uuid::new_v4(),
+            ..descriptor
+        };
+        harness.session.add_torrent(&re_added).await?;
+        let second = harness.session.inspect_metadata_cache().await?;
+        assert_eq!(second.entries, 1);
+        assert_eq!((second.hits, second.misses), (1, 1));
+        assert_eq!(second.retained_entries, 0);
+        assert_eq!(second.retained_bytes, 0);
+        assert_eq!(
+            second.bytes, first.bytes,
+            "a live entry holds no torrent_info copy"
+        );
         Ok(())
     }
 
@@ -1128,7 +2189,7 @@ mod tests {
         config.default_peer_classes = vec![3];
 
         harness.session.apply_config(&config).await?;
-        let snapshot = harness.session.inspect_peer_class_state();
+        let snapshot = harness.session.inspect_peer_class_state().await?;
         assert_eq!(snapshot.configured_ids, vec![3]);
         assert_eq!(snapshot.default_ids, vec![3]);
         Ok(())
@@ -1152,11 +2213,15 @@ mod tests {
             private: true,
             comment: Some("note".to_string()),
             source: Some("source".to_string()),
+            hash_threads: None,
+            format: TorrentAuthorFormat::Hybrid,
         };
 
         let result = harness.session.create_torrent(&request).await?;
         assert!(!result.metainfo.is_empty());
         assert!(result.magnet_uri.contains("magnet:?"));
+        assert_eq!(result.info_hash_v1.as_ref().map(String::len), Some(40));
+        assert_eq!(result.info_hash_v2.as_ref().map(String::len), Some(64));
         assert_eq!(result.files.len(), 1);
         assert!(result.private);
         assert_eq!(result.comment.as_deref(), Some("note"));
@@ -1164,6 +2229,196 @@ mod tests {
         Ok(())
     }
 
+    #[tokio::test]
+    async fn native_session_parallel_hashing_matches_single_thread() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let config = harness.runtime_config();
+        harness.session.apply_config(&config).await?;
+
+        let root = harness.download_path().join("parallel");
+        fs::create_dir_all(&root)?;
+        for index in 0_u8..4 {
+            let payload = (0..40_000_u32)
+                .map(|offset| u8::try_from((offset + u32::from(index)) % 251).unwrap_or(0))
+                .collect::<Vec<_>>();
+            fs::write(root.join(format!("part-{index}.bin")), payload)?;
+        }
+
+        let mut request = TorrentAuthorRequest {
+            root_path: root.to_string_lossy().into_owned(),
+            piece_length: Some(16_384),
+            hash_threads: Some(1),
+            ..TorrentAuthorRequest::default()
+        };
+        let single = harness.session.create_torrent(&request).await?;
+        request.hash_threads = Some(4);
+        let parallel = harness.session.create_torrent(&request).await?;
+
+        // The creation date sits outside the info dictionary, so compare its hash.
+        assert_eq!(single.info_hash, parallel.info_hash);
+        assert_eq!(single.metainfo.len(), parallel.metainfo.len());
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_authors_single_protocol_formats() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let root = harness.download_path().join("formats");
+        fs::create_dir_all(root.join("nested"))?;
+        fs::write(root.join("a.bin"), vec![1_u8; 20_000])?;
+        fs::write(root.join("nested").join("b.bin"), vec![2_u8; 40_000])?;
+
+        let mut request = TorrentAuthorRequest {
+            root_path: root.to_string_lossy().into_owned(),
+            piece_length: Some(16_384),
+            format: TorrentAuthorFormat::V1,
+            ..TorrentAuthorRequest::default()
+        };
+        let v1 = harness.session.create_torrent(&request).await?;
+        assert!(v1.info_hash_v1.is_some());
+        assert!(v1.info_hash_v2.is_none());
+
+        request.format = TorrentAuthorFormat::V2;
+        let v2 = harness.session.create_torrent(&request).await?;
+        assert!(v2.info_hash_v1.is_none());
+        assert_eq!(v2.info_hash_v2.as_deref(), Some(v2.info_hash.as_str()));
+        assert!(v2.magnet_uri.contains("urn:btmh:"));
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_authoring_applies_glob_rules() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let root = harness.download_path().join("globs");
+        for dir in ["season/Extras", "season/SAMPLE", "season/main"] {
+            fs::create_dir_all(root.join(dir))?;
+        }
+        for file in [
+            "top.mkv",
+            "season/ep2.mkv",
+            "season/main/ep01.MKV",
+            "season/main/ep1.mkv",
+            "season/main/notes.txt",
+            "season/Extras/bonus.mkv",
+            "season/SAMPLE/clip.mkv",
+        ] {
+            fs::write(root.join(file), vec![3_u8; 1_024])?;
+        }
+
+        let result = harness
+            .session
+            .create_torrent(&TorrentAuthorRequest {
+                root_path: root.to_string_lossy().into_owned(),
+                file_rules: FileSelectionRules {
+                    include: vec!["**/*.mkv".to_string()],
+                    exclude: vec!["**/extras/**".to_string(), "season/**/ep?.mkv".to_string()],
+                    skip_fluff: true,
+                },
+                ..TorrentAuthorRequest::default()
+            })
+            .await?;
+        let mut paths = result
+            .files
+            .iter()
+            .map(|file| file.path.as_str())
+            .collect::<Vec<_>>();
+        paths.sort_unstable();
+        // `**/` also matches zero directories: it includes `top.mkv` and excludes `season/ep2.mkv`.
+        assert_eq!(paths, vec!["season/main/ep01.MKV", "top.mkv"]);
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_skip_fluff_preset_matches_top_level_directories() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let root = harness.download_path().join("fluff");
+        for dir in ["Sample", "season/samples", "Proofing"] {
+            fs::create_dir_all(root.join(dir))?;
+        }
+        for file in [
+            "movie.mkv",
+            "sample.mkv",
+            "Sample/clip.mkv",
+            "season/samples/clip.mkv",
+            "Proofing/take.mkv",
+        ] {
+            fs::write(root.join(file), vec![5_u8; 1_024])?;
+        }
+
+        let result = harness
+            .session
+            .create_torrent(&TorrentAuthorRequest {
+                root_path: root.to_string_lossy().into_owned(),
+                file_rules: FileSelectionRules {
+                    skip_fluff: true,
+                    ..FileSelectionRules::default()
+                },
+                ..TorrentAuthorRequest::default()
+            })
+            .await?;
+        let mut paths = result
+            .files
+            .iter()
+            .map(|file| file.path.as_str())
+            .collect::<Vec<_>>();
+        paths.sort_unstable();
+        // The presets only match whole directory names. Since `**/` matches zero directories,
+        // a fluff directory at the root is skipped as well; a root-level `sample.mkv` is kept.
+        assert_eq!(paths, vec!["Proofing/take.mkv", "movie.mkv", "sample.mkv"]);
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_background_authoring_reports_progress() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let root = harness.download_path().join("background");
+        fs::create_dir_all(&root)?;
+        fs::write(root.join("payload.bin"), vec![7_u8; 4 * 16_384])?;
+
+        let request = TorrentAuthorRequest {
+            root_path: root.to_string_lossy().into_owned(),
+            piece_length: Some(16_384),
+            ..TorrentAuthorRequest::default()
+        };
+        let job_id = Uuid::new_v4();
+        let inline = harness
+            .session
+            .start_create_torrent(job_id, &request)
+            .await?;
+        assert!(inline.is_none(), "native authoring should run as a job");
+
+        let mut pieces_seen = 0;
+        let mut finished = false;
+        for _ in 0..200 {
+            for event in harness.session.poll_events().await? {
+                match event {
+                    EngineEvent::AuthoringProgress { progress } if progress.job_id == job_id => {
+                        assert_eq!(progress.pieces_total, 4);
+                        pieces_seen = progress.pieces_done;
+                    }
+                    EngineEvent::AuthoringFinished { job_id: id } if id == job_id => {
+                        finished = true;
+                    }
+                    _ => {}
+                }
+            }
+            if finished {
+                break;
+            }
+            sleep(Duration::from_millis(10)).await;
+        }
+        assert!(finished, "authoring job never reported completion");
+        assert_eq!(pieces_seen, 4);
+
+        let authored = harness.session.finish_create_torrent(job_id).await?;
+        assert!(!authored.info_hash.is_empty());
+        assert!(
+            harness.session.cancel_create_torrent(job_id).await.is_err(),
+            "collected jobs should be released"
+        );
+        Ok(())
+    }
+
     #[tokio::test]
     async fn native_session_applies_disk_cache_settings() -> TorrentResult<()> {
         #[derive(Copy, Clone)]
@@ -1202,10 +2457,12 @@ mod tests {
         config.disk_read_mode = Some(crate::types::DiskIoMode::DisableOsCache);
         config.disk_write_mode = Some(crate::types::DiskIoMode::WriteThrough);
         config.verify_piece_hashes = false.into();
+        config.aio_threads = Some(6);
+        config.hashing_threads = Some(3);
 
         harness.session.apply_config(&config).await?;
 
-        let snapshot = harness.session.inspect_storage_state();
+        let snapshot = harness.session.inspect_storage_state().await?;
         let flags = StorageFlags(snapshot.flags);
 
         assert_eq!(snapshot.cache_size, 192);
@@ -1223,35 +2480,67 @@ mod tests {
             crate::types::DiskIoMode::WriteThrough.as_i32()
         );
         assert!(!snapshot.verify_piece_hashes);
+        assert_eq!(snapshot.aio_threads, 6);
+        assert_eq!(snapshot.hashing_threads, 3);
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn native_session_switches_disk_backend_only_while_empty() -> TorrentResult<()> {
+        let mut harness = NativeSessionHarness::new()?;
+        let mut config = harness.runtime_config();
+        config.disk_io_backend = DiskIoBackend::Posix;
+        harness.session.apply_config(&config).await?;
+        let state = harness.session.inspect_storage_state().await?;
+        assert_eq!(state.disk_io_backend, DiskIoBackend::Posix.as_u8());
+        assert_eq!(harness.session.pending_restart(), None);
+
+        let descriptor = AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(seed_mode_metainfo(&VALID_PIECE_HASH)),
+            options: AddTorrentOptions::default(),
+        };
+        harness.session.add_torrent(&descriptor).await?;
+        config.disk_io_backend = DiskIoBackend::Mmap;
+        harness.session.apply_config(&config).await?;
+        let state = harness.session.inspect_storage_state().await?;
+        assert_eq!(state.disk_io_backend, DiskIoBackend::Posix.as_u8());
+        assert!(
+            harness
+                .session
+                .pending_restart()
+                .is_some_and(|detail| detail.contains("requires a restart"))
+        );
+
+        config.disk_io_backend = DiskIoBackend::Posix;
+        harness.session.apply_config(&config).await?;
+        assert_eq!(harness.session.pending_restart(), None);
         Ok(())
     }
 
     #[test]
     fn native_event_translates_progress_and_resume_data() {
         let torrent_id = Uuid::new_v4();
-        let events = map_native_event(
-            Some(torrent_id),
-            NativeEvent {
-                id: torrent_id.to_string(),
-                kind: NativeEventKind::Progress,
-                state: NativeTorrentState::Downloading,
-                name: "demo".to_string(),
-                download_dir: ".server_root/downloads".to_string(),
-                library_path: String::new(),
-                bytes_downloaded: 512,
-                bytes_total: 1024,
-                download_bps: 4096,
-                upload_bps: 2048,
-                ratio: 0.5,
-                files: Vec::new(),
-                resume_data: Vec::new(),
-                message: String::new(),
-                tracker_statuses: Vec::new(),
-                component: String::new(),
-                comment: String::new(),
-                source: String::new(),
-                private_flag: false,
-                has_private: false,
+        let events = map_event_batch(
+            &mut TorrentSlots::default(),
+            NativeEventBatch {
+                bindings: vec![NativeSlotBinding {
+                    slot: 1,
+                    id: torrent_key(torrent_id),
+                }],
+                updates: vec![NativeTorrentUpdate {
+                    slot: 1,
+                    position: 0,
+                    kind: NativeUpdateKind::Progress,
+                    state: NativeTorrentState::Downloading,
+                    bytes_downloaded: 512,
+                    bytes_total: 1024,
+                    download_bps: 4096,
+                    upload_bps: 2048,
+                    ratio: 0.5,
+                    file_index: 0,
+                }],
+                events: Vec::new(),
             },
         );
 
@@ -1292,6 +2581,11 @@ mod tests {
                 source: String::new(),
                 private_flag: false,
                 has_private: false,
+                pieces_done: 0,
+                pieces_total: 0,
+                file_count: 0,
+                restored: 0,
+                restore_submitted: 0,
             },
         );
 
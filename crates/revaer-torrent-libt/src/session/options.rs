@@ -7,9 +7,9 @@
 
 use crate::ffi::ffi;
 use crate::types::{
-    DiskIoMode, EngineRuntimeConfig, IpFilterRule as RuntimeIpFilterRule, IpFilterRuntimeConfig,
-    OutgoingPortRange, PeerClassRuntimeConfig, TrackerAuthRuntime, TrackerProxyRuntime,
-    TrackerProxyType, TrackerRuntimeConfig,
+    DiskIoBackend, DiskIoMode, EngineRuntimeConfig, IpFilterRule as RuntimeIpFilterRule,
+    IpFilterRuntimeConfig, OutgoingPortRange, PeerClassRuntimeConfig, TrackerAuthRuntime,
+    TrackerProxyRuntime, TrackerProxyType, TrackerRuntimeConfig,
 };
 
 /// Planned native engine options plus guard-rail warnings.
@@ -175,6 +175,33 @@ fn build_storage_options(
             .push("resume_dir is empty; native session will fall back to its defaults".to_string());
     }
 
+    let (resume_checkpoint_interval_ms, has_resume_checkpoint_interval) = map_positive_override(
+        "resume_checkpoint_interval_ms",
+        config.resume_checkpoint_interval_ms,
+        warnings,
+    );
+    let (resume_max_inflight_saves, has_resume_max_inflight_saves) = map_positive_override(
+        "resume_max_inflight_saves",
+        config.resume_max_inflight_saves,
+        warnings,
+    );
+    let (aio_threads, has_aio_threads) =
+        map_positive_override("aio_threads", config.aio_threads, warnings);
+    let (hashing_threads, has_hashing_threads) =
+        map_positive_override("hashing_threads", config.hashing_threads, warnings);
+    if config.disk_io_backend == DiskIoBackend::Posix {
+        for (field, set) in [
+            ("aio_threads", has_aio_threads),
+            ("hashing_threads", has_hashing_threads),
+        ] {
+            if set {
+                warnings.push(format!(
+                    "{field} has no effect with the posix disk I/O backend, which is single-threaded"
+                ));
+            }
+        }
+    }
+
     ffi::EngineStorageOptions {
         download_root: config.download_root.clone(),
         resume_dir: config.resume_dir.clone(),
@@ -192,6 +219,15 @@ fn build_storage_options(
         coalesce_reads: bool::from(config.coalesce_reads),
         coalesce_writes: bool::from(config.coalesce_writes),
         use_disk_cache_pool: bool::from(config.use_disk_cache_pool),
+        disk_io_backend: config.disk_io_backend.as_u8(),
+        aio_threads,
+        has_aio_threads,
+        hashing_threads,
+        has_hashing_threads,
+        resume_checkpoint_interval_ms,
+        has_resume_checkpoint_interval,
+        resume_max_inflight_saves,
+        has_resume_max_inflight_saves,
     }
 }
 
@@ -395,6 +431,23 @@ fn map_positive_limit(field: &str, value: Option<i32>, warnings: &mut Vec<String
     }
 }
 
+fn map_positive_override(
+    field: &str,
+    value: Option<i32>,
+    warnings: &mut Vec<String>,
+) -> (i32, bool) {
+    match value {
+        Some(value) if value > 0 => (value, true),
+        Some(value) => {
+            warnings.push(format!(
+                "{field} {value} is non-positive; keeping the default"
+            ));
+            (0, false)
+        }
+        None => (0, false),
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -420,6 +473,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: DiskIoBackend::Auto,
+            aio_threads: None,
+            hashing_threads: None,
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
             listen_interfaces: Vec::new(),
             ipv6_mode: Ipv6Mode::Disabled,
             enable_dht: true,
@@ -485,6 +543,32 @@ mod tests {
         assert_eq!(plan.options.network.encryption_policy, 2);
     }
 
+    #[test]
+    fn plan_flags_disk_threads_the_backend_cannot_use() {
+        let mut config = runtime_config_with_valid_values();
+        config.disk_io_backend = DiskIoBackend::Posix;
+        config.hashing_threads = Some(0);
+
+        let plan = EngineOptionsPlan::from_runtime_config(&config);
+
+        assert_eq!(
+            plan.options.storage.disk_io_backend,
+            DiskIoBackend::Posix.as_u8()
+        );
+        assert!(plan.options.storage.has_aio_threads);
+        assert!(!plan.options.storage.has_hashing_threads);
+        assert!(
+            plan.warnings
+                .iter()
+                .any(|warning| warning.contains("posix disk I/O backend"))
+        );
+        assert!(
+            plan.warnings
+                .iter()
+                .any(|warning| warning.contains("hashing_threads 0 is non-positive"))
+        );
+    }
+
     #[test]
     fn plan_preserves_valid_values() {
         let config = runtime_config_with_valid_values();
@@ -508,6 +592,18 @@ mod tests {
         assert_eq!(plan.options.limits.max_queued_disk_bytes, 5_000_000);
         assert!(plan.options.limits.has_stats_interval);
         assert_eq!(plan.options.limits.stats_interval_ms, 1_500);
+        assert!(plan.options.storage.has_resume_checkpoint_interval);
+        assert_eq!(plan.options.storage.resume_checkpoint_interval_ms, 15_000);
+        assert!(plan.options.storage.has_resume_max_inflight_saves);
+        assert_eq!(plan.options.storage.resume_max_inflight_saves, 4);
+        assert_eq!(
+            plan.options.storage.disk_io_backend,
+            DiskIoBackend::Mmap.as_u8()
+        );
+        assert!(plan.options.storage.has_aio_threads);
+        assert_eq!(plan.options.storage.aio_threads, 8);
+        assert!(plan.options.storage.has_hashing_threads);
+        assert_eq!(plan.options.storage.hashing_threads, 4);
         assert!(plan.options.behavior.sequential_default);
         assert!(plan.options.behavior.super_seeding);
         assert_eq!(plan.options.network.encryption_policy, 0);
@@ -565,6 +661,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: DiskIoBackend::Mmap,
+            aio_threads: Some(8),
+            hashing_threads: Some(4),
+            resume_checkpoint_interval_ms: Some(15_000),
+            resume_max_inflight_saves: Some(4),
             listen_interfaces: Vec::new(),
             ipv6_mode: Ipv6Mode::Disabled,
             enable_dht: false,
@@ -630,6 +731,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: DiskIoBackend::Auto,
+            aio_threads: None,
+            hashing_threads: None,
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
             listen_interfaces: Vec::new(),
             ipv6_mode: Ipv6Mode::Disabled,
             enable_dht: false,
@@ -707,6 +813,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: DiskIoBackend::Auto,
+            aio_threads: None,
+            hashing_threads: None,
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
             listen_interfaces: Vec::new(),
             ipv6_mode: Ipv6Mode::Disabled,
             enable_dht: false,
@@ -778,6 +889,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: DiskIoBackend::Auto,
+            aio_threads: None,
+            hashing_threads: None,
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
             listen_interfaces: vec!["eth0:7000".into(), "[::]:7000".into()],
             ipv6_mode: Ipv6Mode::Enabled,
             enable_dht: false,
@@ -845,6 +961,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: DiskIoBackend::Auto,
+            aio_threads: None,
+            hashing_threads: None,
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
             listen_interfaces: Vec::new(),
             ipv6_mode: Ipv6Mode::Disabled,
             enable_dht: false,
@@ -993,6 +1114,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: DiskIoBackend::Auto,
+            aio_threads: None,
+            hashing_threads: None,
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
             listen_interfaces: Vec::new(),
             ipv6_mode: Ipv6Mode::Disabled,
             enable_dht: false,
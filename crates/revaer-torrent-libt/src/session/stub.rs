@@ -1,16 +1,17 @@
 use std::collections::{HashMap, HashSet};
+use std::sync::Arc;
 
 use async_trait::async_trait;
 use revaer_events::TorrentState;
 use revaer_torrent_core::{
-    AddTorrent, EngineEvent, FileSelectionUpdate, PeerSnapshot, RemoveTorrent, StorageMode,
-    TorrentError, TorrentRateLimit, TorrentResult,
+    AddTorrent, AddTorrentOptions, EngineEvent, FileSelectionUpdate, PeerSnapshot, RemoveTorrent,
+    StorageMode, TorrentError, TorrentRateLimit, TorrentResult,
     model::{TorrentAuthorFile, TorrentAuthorRequest, TorrentAuthorResult},
 };
 use serde_json::json;
 use uuid::Uuid;
 
-use super::LibTorrentSession;
+use super::{LibTorrentSession, RestoreTorrent};
 use crate::error::{LibtorrentError, op_failed};
 use crate::types::{EngineRuntimeConfig, EngineSettingsSnapshot};
 use revaer_torrent_core::{FilePriorityOverride, FileSelectionRules};
@@ -52,8 +53,12 @@ struct StubTorrent {
 
 impl StubTorrent {
     fn from_add(request: &AddTorrent) -> Self {
-        let seed_mode = request.options.seed_mode.unwrap_or(false);
-        let initial_state = if request.options.start_paused.unwrap_or(false) {
+        Self::from_options(&request.options)
+    }
+
+    fn from_options(options: &AddTorrentOptions) -> Self {
+        let seed_mode = options.seed_mode.unwrap_or(false);
+        let initial_state = if options.start_paused.unwrap_or(false) {
             TorrentState::Stopped
         } else if seed_mode {
             TorrentState::Seeding
@@ -61,28 +66,28 @@ impl StubTorrent {
             TorrentState::Queued
         };
         Self {
-            selection: request.options.file_rules.clone(),
+            selection: options.file_rules.clone(),
             priorities: Vec::new(),
-            rate_limit: request.options.rate_limit.clone(),
-            sequential: request.options.sequential.unwrap_or(false),
+            rate_limit: options.rate_limit.clone(),
+            sequential: options.sequential.unwrap_or(false),
             state: initial_state,
-            download_dir: request.options.download_dir.clone(),
-            storage_mode: request.options.storage_mode,
+            download_dir: options.download_dir.clone(),
+            storage_mode: options.storage_mode,
             use_partfile: None,
-            connections_limit: request.options.connections_limit,
-            seed_mode: request.options.seed_mode,
-            hash_check_sample_pct: request.options.hash_check_sample_pct,
+            connections_limit: options.connections_limit,
+            seed_mode: options.seed_mode,
+            hash_check_sample_pct: options.hash_check_sample_pct,
             seed_ratio_limit: None,
             seed_time_limit: None,
             resume_payload: None,
-            auto_managed: request.options.auto_managed,
-            queue_position: request.options.queue_position,
-            pex_enabled: request.options.pex_enabled,
-            super_seeding: request.options.super_seeding,
-            trackers: request.options.trackers.clone(),
-            replace_trackers: request.options.replace_trackers,
-            web_seeds: request.options.web_seeds.clone(),
-            replace_web_seeds: request.options.replace_web_seeds,
+            auto_managed: options.auto_managed,
+            queue_position: options.queue_position,
+            pex_enabled: options.pex_enabled,
+            super_seeding: options.super_seeding,
+            trackers: options.trackers.clone(),
+            replace_trackers: options.replace_trackers,
+            web_seeds: options.web_seeds.clone(),
+            replace_web_seeds: options.replace_web_seeds,
         }
     }
 }
@@ -177,6 +182,12 @@ impl LibTorrentSession for StubSession {
             source: request.options.source.clone(),
             private: request.options.private,
         });
+        if super::checks_payload_before_admission(request) {
+            // Nothing to hash here, so a checked add is admitted straight away.
+            self.pending_events.push(EngineEvent::VerifyAdmitted {
+                torrent_id: request.id,
+            });
+        }
         self.refresh_resume(request.id);
         Ok(())
     }
@@ -201,6 +212,8 @@ impl LibTorrentSession for StubSession {
             metainfo: b"stub".to_vec(),
             magnet_uri: "magnet:?xt=urn:btih:stub".to_string(),
             info_hash: "stub".to_string(),
+            info_hash_v1: Some("stub".to_string()),
+            info_hash_v2: None,
             piece_length: request.piece_length.unwrap_or(16_384),
             total_size: 0,
             files,
@@ -374,7 +387,7 @@ impl LibTorrentSession for StubSession {
         Ok(())
     }
 
-    async fn load_fastresume(&mut self, id: Uuid, payload: &[u8]) -> TorrentResult<()> {
+    async fn load_fastresume(&mut self, id: Uuid, payload: Arc<Vec<u8>>) -> TorrentResult<()> {
         let torrent = self.torrent_mut(id)?;
         torrent.resume_payload = Some(payload.to_vec());
         self.pending_events.push(EngineEvent::ResumeData {
@@ -419,6 +432,31 @@ impl LibTorrentSession for StubSession {
         Ok(self.peer_map.get(&id).cloned().unwrap_or_default())
     }
 
+    async fn restore_torrents(&mut self, torrents: Vec<RestoreTorrent>) -> TorrentResult<()> {
+        let mut restored = 0_u32;
+        let mut failed = 0_u32;
+        for torrent in torrents {
+            if self.torrents.contains_key(&torrent.id) {
+                failed += 1;
+                self.pending_events.push(EngineEvent::Error {
+                    torrent_id: torrent.id,
+                    message: "restore failed: torrent already present in session".to_string(),
+                });
+                continue;
+            }
+            let mut stub = StubTorrent::from_options(&AddTorrentOptions {
+                download_dir: torrent.download_dir,
+                ..AddTorrentOptions::default()
+            });
+            stub.resume_payload = Some(torrent.fastresume.to_vec());
+            self.torrents.insert(torrent.id, stub);
+            restored += 1;
+        }
+        self.pending_events
+            .push(EngineEvent::RestoreFinished { restored, failed });
+        Ok(())
+    }
+
     async fn poll_events(&mut self) -> TorrentResult<Vec<EngineEvent>> {
         Ok(std::mem::take(&mut self.pending_events))
     }
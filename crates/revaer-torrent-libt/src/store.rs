@@ -2,6 +2,7 @@ use std::collections::HashMap;
 use std::ffi::OsStr;
 use std::fs;
 use std::path::PathBuf;
+use std::sync::Arc;
 
 use chrono::{DateTime, Utc};
 use revaer_torrent_core::{
@@ -12,6 +13,11 @@ use serde::{Deserialize, Serialize};
 use uuid::Uuid;
 
 use crate::error::{LibtorrentError, op_failed};
+
+mod packed;
+
+use packed::PackedLog;
+
 const META_SUFFIX: &str = ".meta.json";
 const FASTRESUME_SUFFIX: &str = ".fastresume";
 
@@ -126,9 +132,13 @@ impl StoredTorrentState {
 }
 
 /// Service responsible for persisting fast-resume data and selection metadata.
+///
+/// Two layouts are supported: one file pair per torrent ([`FastResumeStore::new`]) and a
+/// packed append-only log ([`FastResumeStore::packed`]) that group-commits writes.
 #[derive(Clone, Debug)]
 pub struct FastResumeStore {
     base_dir: PathBuf,
+    packed: Option<Arc<PackedLog>>,
 }
 
 impl FastResumeStore {
@@ -137,9 +147,41 @@ impl FastResumeStore {
     pub fn new(base_dir: impl Into<PathBuf>) -> Self {
         Self {
             base_dir: base_dir.into(),
+            packed: None,
         }
     }
 
+    /// Open a packed append-only store rooted at the provided directory.
+    ///
+    /// Any per-file fastresume/metadata entries already in the directory are imported into
+    /// the log and then deleted, so existing installs migrate on first open.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the directory or the active segment cannot be opened. A corrupt
+    /// older segment is quarantined and legacy entries that fail to migrate are left in
+    /// place; both are logged and the store opens without them.
+    pub fn packed(base_dir: impl Into<PathBuf>) -> TorrentResult<Self> {
+        let base_dir = base_dir.into();
+        let log = PackedLog::open(&base_dir)?;
+        Ok(Self {
+            base_dir,
+            packed: Some(Arc::new(log)),
+        })
+    }
+
+    /// Make buffered writes durable.
+    ///
+    /// The packed layout batches appends and commits them with a single `fsync`; this forces
+    /// that commit. The per-file layout writes through and has nothing to flush.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if the pending batch cannot be written or synced.
+    pub fn flush(&self) -> TorrentResult<()> {
+        self.packed.as_ref().map_or(Ok(()), |log| log.flush())
+    }
+
     /// Ensure the underlying directory exists.
     ///
     /// # Errors
@@ -160,6 +202,13 @@ impl FastResumeStore {
     ///
     /// Returns an error if a fastresume payload or metadata file cannot be read or decoded.
     pub fn load_all(&self) -> TorrentResult<Vec<StoredTorrentState>> {
+        match &self.packed {
+            Some(log) => log.load_all(),
+            None => self.load_legacy(),
+        }
+    }
+
+    fn load_legacy(&self) -> TorrentResult<Vec<StoredTorrentState>> {
         if !self.base_dir.exists() {
             return Ok(Vec::new());
         }
@@ -206,6 +255,9 @@ impl FastResumeStore {
     ///
     /// Returns an error if the payload cannot be written.
     pub fn write_fastresume(&self, torrent_id: Uuid, payload: &[u8]) -> TorrentResult<()> {
+        if let Some(log) = &self.packed {
+            return log.write_fastresume(torrent_id, payload);
+        }
         self.ensure_initialized()?;
         let path = self.fastresume_path(&torrent_id);
         fs::write(&path, payload).map_err(|source| {
@@ -224,9 +276,13 @@ impl FastResumeStore {
         torrent_id: Uuid,
         metadata: &StoredTorrentMetadata,
     ) -> TorrentResult<()> {
-        self.ensure_initialized()?;
         let mut metadata = metadata.clone();
         metadata.updated_at = Utc::now();
+        if let Some(log) = &self.packed {
+            let json = packed::encode_metadata(torrent_id, &metadata, &self.base_dir)?;
+            return log.write_metadata(torrent_id, &json);
+        }
+        self.ensure_initialized()?;
         let json = serde_json::to_string_pretty(&metadata).map_err(|source| {
             Self::store_parse_error(
                 "metadata_encode",
@@ -248,6 +304,13 @@ impl FastResumeStore {
     ///
     /// Returns an error if the stored files cannot be deleted.
     pub fn remove(&self, torrent_id: Uuid) -> TorrentResult<()> {
+        match &self.packed {
+            Some(log) => log.remove(torrent_id),
+            None => self.remove_legacy(torrent_id),
+        }
+    }
+
+    fn remove_legacy(&self, torrent_id: Uuid) -> TorrentResult<()> {
         let fastresume_path = self.fastresume_path(&torrent_id);
         if fastresume_path.exists() {
             fs::remove_file(&fastresume_path).map_err(|source| {
@@ -763,4 +826,156 @@ mod tests {
         ));
         Ok(())
     }
+
+    fn segment_files(dir: &std::path::Path) -> Result<Vec<PathBuf>> {
+        let mut segments = Vec::new();
+        for entry in fs::read_dir(dir)? {
+            let path = entry?.path();
+            if path.extension().and_then(OsStr::to_str) == Some("log") {
+                segments.push(path);
+            }
+        }
+        segments.sort();
+        Ok(segments)
+    }
+
+    #[test]
+    fn packed_store_round_trips_across_reopen_and_tombstones() -> Result<()> {
+        let temp = temp_dir()?;
+        let kept = Uuid::new_v4();
+        let dropped = Uuid::new_v4();
+        {
+            let store = FastResumeStore::packed(temp.path())?;
+            store.write_metadata(kept, &sample_metadata())?;
+            store.write_fastresume(kept, &[1, 2, 3])?;
+            store.write_fastresume(kept, &[4, 5, 6])?;
+            store.write_fastresume(dropped, &[7])?;
+            store.remove(dropped)?;
+            store.flush()?;
+        }
+
+        let reopened = FastResumeStore::packed(temp.path())?;
+        let mut loaded = reopened.load_all()?;
+        assert_eq!(loaded.len(), 1);
+        let state = loaded.pop().ok_or_else(|| anyhow!("state missing"))?;
+        assert_eq!(state.torrent_id, kept);
+        assert_eq!(state.fastresume, Some(vec![4, 5, 6]));
+        let metadata = state.metadata.ok_or_else(|| anyhow!("metadata missing"))?;
+        assert_eq!(metadata.tags, vec!["movies".to_string(), "hd".to_string()]);
+        assert_eq!(segment_files(temp.path())?.len(), 1);
+        Ok(())
+    }
+
+    #[test]
+    fn packed_store_migrates_per_file_layout() -> Result<()> {
+        let temp = temp_dir()?;
+        let torrent_id = Uuid::new_v4();
+        let legacy = FastResumeStore::new(temp.path());
+        legacy.write_metadata(torrent_id, &sample_metadata())?;
+        legacy.write_fastresume(torrent_id, b"legacy")?;
+
+        let store = FastResumeStore::packed(temp.path())?;
+        assert!(
+            !temp
+                .path()
+                .join(format!("{torrent_id}{FASTRESUME_SUFFIX}"))
+                .exists()
+        );
+        assert!(
+            !temp
+                .path()
+                .join(format!("{torrent_id}{META_SUFFIX}"))
+                .exists()
+        );
+
+        let mut loaded = store.load_all()?;
+        let state = loaded.pop().ok_or_else(|| anyhow!("state missing"))?;
+        assert_eq!(state.torrent_id, torrent_id);
+        assert_eq!(state.fastresume, Some(b"legacy".to_vec()));
+        assert_eq!(
+            state.metadata.and_then(|metadata| metadata.category),
+            Some("cinema".to_string())
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn packed_store_truncates_torn_tail() -> Result<()> {
+        let temp = temp_dir()?;
+        let torrent_id = Uuid::new_v4();
+        {
+            let store = FastResumeStore::packed(temp.path())?;
+            store.write_fastresume(torrent_id, b"durable")?;
+            store.flush()?;
+        }
+        let segment = segment_files(temp.path())?
+            .pop()
+            .ok_or_else(|| anyhow!("segment missing"))?;
+        let committed = fs::metadata(&segment)?.len();
+        let mut bytes = fs::read(&segment)?;
+        bytes.extend_from_slice(&[0xFF; 11]);
+        fs::write(&segment, bytes)?;
+
+        let store = FastResumeStore::packed(temp.path())?;
+        assert_eq!(fs::metadata(&segment)?.len(), committed);
+        store.write_fastresume(torrent_id, b"after")?;
+        store.flush()?;
+        let loaded = FastResumeStore::packed(temp.path())?.load_all()?;
+        assert_eq!(loaded.len(), 1);
+        assert_eq!(loaded[0].fastresume, Some(b"after".to_vec()));
+        Ok(())
+    }
+
+    #[test]
+    fn packed_store_quarantines_corrupt_older_segment() -> Result<()> {
+        let temp = temp_dir()?;
+        let torrent_id = Uuid::new_v4();
+        {
+            let store = FastResumeStore::packed(temp.path())?;
+            store.write_fastresume(torrent_id, b"newest")?;
+            store.flush()?;
+        }
+        let newest = segment_files(temp.path())?
+            .pop()
+            .ok_or_else(|| anyhow!("segment missing"))?;
+        let older = temp.path().join("resume-00000000.log");
+        let mut damaged = fs::read(&newest)?;
+        damaged.extend_from_slice(&[0xFF; 11]);
+        fs::write(&older, damaged)?;
+
+        let store = FastResumeStore::packed(temp.path())?;
+        assert!(!older.exists());
+        assert!(temp.path().join("resume-00000000.log.corrupt").exists());
+        assert_eq!(segment_files(temp.path())?, vec![newest]);
+        let loaded = store.load_all()?;
+        assert_eq!(loaded.len(), 1);
+        assert_eq!(loaded[0].fastresume, Some(b"newest".to_vec()));
+        Ok(())
+    }
+
+    #[test]
+    fn packed_store_compacts_superseded_records() -> Result<()> {
+        let temp = temp_dir()?;
+        let torrent_id = Uuid::new_v4();
+        let payload = vec![0xAB_u8; 512 * 1024];
+        let store = FastResumeStore::packed(temp.path())?;
+        for _ in 0..40 {
+            store.write_fastresume(torrent_id, &payload)?;
+        }
+        store.flush()?;
+
+        let on_disk: u64 = segment_files(temp.path())?
+            .iter()
+            .map(|path| fs::metadata(path).map(|meta| meta.len()))
+            .sum::<std::io::Result<u64>>()?;
+        assert!(
+            on_disk < 8 * 1024 * 1024,
+            "log not compacted: {on_disk} bytes"
+        );
+
+        let loaded = FastResumeStore::packed(temp.path())?.load_all()?;
+        assert_eq!(loaded.len(), 1);
+        assert_eq!(loaded[0].fastresume.as_deref(), Some(payload.as_slice()));
+        Ok(())
+    }
 }
@@ -0,0 +1,677 @@
+//! Packed, append-only backend for [`FastResumeStore`](super::FastResumeStore).
+//!
+//! # Design
+//! - Records are appended to numbered segment files (`resume-00000001.log`). The newest
+//!   record per torrent and kind wins; removals append a tombstone.
+//! - Appends are buffered and committed as a group: one write and one `fsync` per batch,
+//!   taken once the buffer or its age crosses a threshold, or on [`PackedLog::flush`].
+//! - The in-memory index tracks live bytes. Once dead records dominate, live records are
+//!   rewritten into a fresh segment and the older segments are deleted oldest-first, so a
+//!   crash mid-compaction replays to the same state.
+//! - Loading reads each segment once and decodes entries across scoped threads.
+//! - A torn tail (short or checksum-mismatched record) in the newest segment is truncated
+//!   on open. A damaged older segment is renamed to `*.log.corrupt` and skipped, so the
+//!   store opens degraded instead of failing; its records are lost.
+//! - Legacy per-file entries that cannot be imported are left in place and retried on the
+//!   next open.
+
+use std::collections::HashMap;
+use std::collections::hash_map::Entry;
+use std::fs::{self, File, OpenOptions};
+use std::io::{self, Write};
+use std::path::{Path, PathBuf};
+use std::sync::Mutex;
+use std::thread;
+use std::time::{Duration, Instant};
+
+use revaer_torrent_core::{TorrentError, TorrentResult};
+use tracing::warn;
+use uuid::Uuid;
+
+use super::{FastResumeStore, StoredTorrentMetadata, StoredTorrentState};
+
+const SEGMENT_PREFIX: &str = "resume-";
+const SEGMENT_SUFFIX: &str = ".log";
+/// Appended to a damaged segment's name; such files are no longer listed as segments.
+const QUARANTINE_SUFFIX: &str = ".corrupt";
+/// Segments roll over once they reach this size.
+const SEGMENT_BYTES: u64 = 64 * 1024 * 1024;
+/// Buffered appends are committed once they reach this size...
+const GROUP_COMMIT_BYTES: usize = 1024 * 1024;
+/// ...or once the oldest buffered append is this old.
+const GROUP_COMMIT_INTERVAL: Duration = Duration::from_secs(1);
+/// Compaction only runs once the log holds at least this many bytes.
+const COMPACTION_MIN_BYTES: u64 = 8 * 1024 * 1024;
+/// Payload length, checksum, kind, torrent id.
+const HEADER_BYTES: usize = 4 + 4 + 1 + 16;
+/// Records per decode thread below which spawning is not worth it.
+const MIN_RECORDS_PER_THREAD: usize = 256;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+enum RecordKind {
+    Fastresume = 1,
+    Metadata = 2,
+    Tombstone = 3,
+}
+
+impl RecordKind {
+    const fn from_u8(value: u8) -> Option<Self> {
+        match value {
+            1 => Some(Self::Fastresume),
+            2 => Some(Self::Metadata),
+            3 => Some(Self::Tombstone),
+            _ => None,
+        }
+    }
+}
+
+/// A decoded record: fastresume bytes or metadata for one torrent.
+type DecodedEntry = (Uuid, Option<Vec<u8>>, Option<StoredTorrentMetadata>);
+
+#[derive(Debug, Clone, Copy)]
+struct Location {
+    segment: u64,
+    offset: u64,
+    len: u32,
+}
+
+impl Location {
+    const fn record_bytes(self) -> u64 {
+        HEADER_BYTES as u64 + self.len as u64
+    }
+}
+
+/// Mutable log state guarded by the [`PackedLog`] mutex.
+#[derive(Debug)]
+struct LogState {
+    index: HashMap<(Uuid, RecordKind), Location>,
+    segments: Vec<u64>,
+    active: File,
+    active_id: u64,
+    /// Committed length of the active segment.
+    active_len: u64,
+    pending: Vec<u8>,
+    pending_since: Option<Instant>,
+    live_bytes: u64,
+    total_bytes: u64,
+}
+
+/// Segmented append-only resume log with group commit and compaction.
+#[derive(Debug)]
+pub(super) struct PackedLog {
+    dir: PathBuf,
+    state: Mutex<LogState>,
+}
+
+impl PackedLog {
+    /// Open (or create) the log under `dir`, truncating a torn tail, quarantining damaged
+    /// older segments and importing any per-file resume state left by the legacy layout.
+    pub(super) fn open(dir: &Path) -> TorrentResult<Self> {
+        fs::create_dir_all(dir)
+            .map_err(|source| io_error("packed_open", None, dir.to_path_buf(), source))?;
+
+        let listed = list_segments(dir)?;
+        let mut segments = Vec::with_capacity(listed.len());
+        let mut index = HashMap::new();
+        let mut live_bytes = 0;
+        let mut total_bytes = 0;
+        for (position, &segment) in listed.iter().enumerate() {
+            let path = segment_path(dir, segment);
+            let bytes = fs::read(&path)
+                .map_err(|source| io_error("packed_read", None, path.clone(), source))?;
+            let scan = scan_segment(&bytes);
+            if scan.valid_len < bytes.len() {
+                if position + 1 != listed.len() {
+                    let quarantined = quarantine(&path)?;
+                    warn!(
+                        segment = %path.display(),
+                        quarantined = %quarantined.display(),
+                        valid_bytes = scan.valid_len,
+                        total_bytes = bytes.len(),
+                        "corrupt resume log segment quarantined; its records were dropped"
+                    );
+                    continue;
+                }
+                truncate(&path, scan.valid_len as u64)?;
+            }
+            segments.push(segment);
+            for (id, kind, offset, len) in scan.records {
+                let location = Location {
+                    segment,
+                    offset,
+                    len,
+                };
+                total_bytes += location.record_bytes();
+                apply_record(&mut index, &mut live_bytes, id, kind, location);
+            }
+        }
+
+        let created = segments.is_empty();
+        if created {
+            segments.push(1);
+        }
+        let active_id = segments[segments.len() - 1];
+        let active_path = segment_path(dir, active_id);
+        let active = open_append(&active_path)?;
+        if created {
+            sync_dir(dir, "packed_open")?;
+        }
+        let active_len = active
+            .metadata()
+            .map_err(|source| io_error("packed_open", None, active_path, source))?
+            .len();
+
+        let log = Self {
+            dir: dir.to_path_buf(),
+            state: Mutex::new(LogState {
+                index,
+                segments,
+                active,
+                active_id,
+                active_len,
+                pending: Vec::new(),
+                pending_since: None,
+                live_bytes,
+                total_bytes,
+            }),
+        };
+        if let Err(err) = log.migrate_legacy() {
+            warn!(
+                dir = %dir.display(),
+                error = %err,
+                "legacy resume entries could not be imported; leaving them for the next open"
+            );
+        }
+        Ok(log)
+    }
+
+    /// Decode every live torrent, reading each segment once and parsing in parallel.
+    pub(super) fn load_all(&self) -> TorrentResult<Vec<StoredTorrentState>> {
+        let (entries, segments) = {
+            let mut state = self.lock("packed_load")?;
+            self.commit(&mut state)?;
+            let entries: Vec<_> = state
+                .index
+                .iter()
+                .map(|(&(id, kind), &location)| (id, kind, location))
+                .collect();
+            (entries, state.segments.clone())
+        };
+
+        let mut data = HashMap::with_capacity(segments.len());
+        for segment in segments {
+            let path = segment_path(&self.dir, segment);
+            let bytes =
+                fs::read(&path).map_err(|source| io_error("packed_read", None, path, source))?;
+            data.insert(segment, bytes);
+        }
+
+        let workers = thread::available_parallelism()
+            .map_or(1, usize::from)
+            .min(entries.len() / MIN_RECORDS_PER_THREAD)
+            .max(1);
+        let chunk = entries.len().div_ceil(workers).max(1);
+        let decoded = thread::scope(|scope| {
+            let handles: Vec<_> = entries
+                .chunks(chunk)
+                .map(|slice| scope.spawn(|| self.decode_entries(slice, &data)))
+                .collect();
+            handles
+                .into_iter()
+                .map(|handle| {
+                    handle.join().unwrap_or_else(|_| {
+                        Err(io_error(
+                            "packed_decode",
+                            None,
+                            self.dir.clone(),
+                            io::Error::other("resume decode thread panicked"),
+                        ))
+                    })
+                })
+                .collect::<TorrentResult<Vec<_>>>()
+        })?;
+
+        let mut map: HashMap<Uuid, StoredTorrentState> = HashMap::new();
+        for (id, payload, metadata) in decoded.into_iter().flatten() {
+            let state = map.entry(id).or_insert_with(|| StoredTorrentState::new(id));
+            if payload.is_some() {
+                state.fastresume = payload;
+            }
+            if metadata.is_some() {
+                state.metadata = metadata;
+            }
+        }
+        Ok(map.into_values().collect())
+    }
+
+    /// Buffer a fastresume record.
+    pub(super) fn write_fastresume(&self, torrent_id: Uuid, payload: &[u8]) -> TorrentResult<()> {
+        self.append(torrent_id, RecordKind::Fastresume, payload)
+    }
+
+    /// Buffer a metadata record.
+    pub(super) fn write_metadata(&self, torrent_id: Uuid, json: &[u8]) -> TorrentResult<()> {
+        self.append(torrent_id, RecordKind::Metadata, json)
+    }
+
+    /// Buffer a tombstone that drops every record for the torrent.
+    pub(super) fn remove(&self, torrent_id: Uuid) -> TorrentResult<()> {
+        self.append(torrent_id, RecordKind::Tombstone, &[])
+    }
+
+    /// Commit buffered appends with a single write and `fsync`.
+    pub(super) fn flush(&self) -> TorrentResult<()> {
+        let mut state = self.lock("packed_flush")?;
+        self.commit(&mut state)
+    }
+
+    fn append(&self, torrent_id: Uuid, kind: RecordKind, payload: &[u8]) -> TorrentResult<()> {
+        let len = u32::try_from(payload.len()).map_err(|_| {
+            io_error(
+                "packed_append",
+                Some(torrent_id),
+                self.dir.clone(),
+                io::Error::new(io::ErrorKind::InvalidInput, "resume record too large"),
+            )
+        })?;
+        let mut state = self.lock("packed_append")?;
+
+        let record_bytes = HEADER_BYTES as u64 + u64::from(len);
+        let buffered = state.active_len + state.pending.len() as u64;
+        if buffered > 0 && buffered + record_bytes > SEGMENT_BYTES {
+            self.commit(&mut state)?;
+            self.rotate(&mut state)?;
+        }
+
+        let location = Location {
+            segment: state.active_id,
+            offset: state.active_len + state.pending.len() as u64,
+            len,
+        };
+        encode_record(&mut state.pending, torrent_id, kind, payload);
+        state.pending_since.get_or_insert_with(Instant::now);
+        state.total_bytes += location.record_bytes();
+        let state_ref = &mut *state;
+        apply_record(
+            &mut state_ref.index,
+            &mut state_ref.live_bytes,
+            torrent_id,
+            kind,
+            location,
+        );
+
+        let due = state.pending.len() >= GROUP_COMMIT_BYTES
+            || state
+                .pending_since
+                .is_some_and(|since| since.elapsed() >= GROUP_COMMIT_INTERVAL);
+        if due {
+            self.commit(&mut state)?;
+        }
+        Ok(())
+    }
+
+    fn commit(&self, state: &mut LogState) -> TorrentResult<()> {
+        if state.pending.is_empty() {
+            return Ok(());
+        }
+        let path = segment_path(&self.dir, state.active_id);
+        state
+            .active
+            .write_all(&state.pending)
+            .and_then(|()| state.active.sync_data())
+            .map_err(|source| io_error("packed_commit", None, path, source))?;
+        state.active_len += state.pending.len() as u64;
+        state.pending.clear();
+        state.pending_since = None;
+
+        if state.total_bytes >= COMPACTION_MIN_BYTES && state.live_bytes * 2 < state.total_bytes {
+            self.compact(state)?;
+        }
+        Ok(())
+    }
+
+    fn rotate(&self, state: &mut LogState) -> TorrentResult<()> {
+        let next = state.active_id + 1;
+        state.active = open_append(&segment_path(&self.dir, next))?;
+        sync_dir(&self.dir, "packed_rotate")?;
+        state.active_id = next;
+        state.active_len = 0;
+        state.segments.push(next);
+        Ok(())
+    }
+
+    /// Rewrite live records into a fresh segment, then drop every older segment.
+    fn compact(&self, state: &mut LogState) -> TorrentResult<()> {
+        let target = state.active_id + 1;
+        let target_path = segment_path(&self.dir, target);
+        let mut sources: HashMap<u64, Vec<u8>> = HashMap::new();
+        let mut rewritten = Vec::with_capacity(usize::try_from(state.live_bytes).unwrap_or(0));
+        let mut relocated = HashMap::with_capacity(state.index.len());
+
+        for (&(id, kind), &location) in &state.index {
+            if let Entry::Vacant(slot) = sources.entry(location.segment) {
+                let path = segment_path(&self.dir, location.segment);
+                let bytes = fs::read(&path)
+                    .map_err(|source| io_error("packed_compact", None, path, source))?;
+                slot.insert(bytes);
+            }
+            let payload = sources
+                .get(&location.segment)
+                .and_then(|bytes| record_payload(bytes, location))
+                .ok_or_else(|| corrupt("packed_compact", Some(id), &target_path))?;
+            let moved = Location {
+                segment: target,
+                offset: rewritten.len() as u64,
+                len: location.len,
+            };
+            encode_record(&mut rewritten, id, kind, payload);
+            relocated.insert((id, kind), moved);
+        }
+
+        let mut file = open_append(&target_path)?;
+        file.write_all(&rewritten)
+            .and_then(|()| file.sync_all())
+            .map_err(|source| io_error("packed_compact", None, target_path.clone(), source))?;
+        // The new segment's directory entry must be durable before any source is unlinked,
+        // or a crash could leave neither the sources nor the compacted copy.
+        sync_dir(&self.dir, "packed_compact")?;
+
+        let retired = std::mem::replace(&mut state.segments, vec![target]);
+        state.index = relocated;
+        state.active = file;
+        state.active_id = target;
+        state.active_len = rewritten.len() as u64;
+        state.total_bytes = state.active_len;
+        state.live_bytes = state.active_len;
+        for segment in retired {
+            let path = segment_path(&self.dir, segment);
+            fs::remove_file(&path)
+                .map_err(|source| io_error("packed_compact", None, path, source))?;
+        }
+        Ok(())
+    }
+
+    /// Import per-file resume state left by the legacy layout, then delete those files.
+    fn migrate_legacy(&self) -> TorrentResult<()> {
+        let legacy = FastResumeStore::new(self.dir.clone());
+        let states = legacy.load_legacy()?;
+        if states.is_empty() {
+            return Ok(());
+        }
+        for state in &states {
+            if let Some(payload) = &state.fastresume {
+                self.write_fastresume(state.torrent_id, payload)?;
+            }
+            if let Some(metadata) = &state.metadata {
+                self.write_metadata(
+                    state.torrent_id,
+                    &encode_metadata(state.torrent_id, metadata, &self.dir)?,
+                )?;
+            }
+        }
+        self.flush()?;
+        for state in states {
+            legacy.remove_legacy(state.torrent_id)?;
+        }
+        Ok(())
+    }
+
+    fn decode_entries(
+        &self,
+        entries: &[(Uuid, RecordKind, Location)],
+        data: &HashMap<u64, Vec<u8>>,
+    ) -> TorrentResult<Vec<DecodedEntry>> {
+        let mut decoded = Vec::with_capacity(entries.len());
+        for &(id, kind, location) in entries {
+            let path = segment_path(&self.dir, location.segment);
+            let payload = data
+                .get(&location.segment)
+                .and_then(|bytes| record_payload(bytes, location))
+                .ok_or_else(|| corrupt("packed_decode", Some(id), &path))?;
+            match kind {
+                RecordKind::Fastresume => decoded.push((id, Some(payload.to_vec()), None)),
+                RecordKind::Metadata => {
+                    let metadata = serde_json::from_slice(payload).map_err(|source| {
+                        FastResumeStore::store_parse_error(
+                            "metadata_parse",
+                            Some(id),
+                            path.clone(),
+                            source,
+                        )
+                    })?;
+                    decoded.push((id, None, Some(metadata)));
+                }
+                RecordKind::Tombstone => {}
+            }
+        }
+        Ok(decoded)
+    }
+
+    fn lock(&self, operation: &'static str) -> TorrentResult<std::sync::MutexGuard<'_, LogState>> {
+        self.state.lock().map_err(|_| {
+            io_error(
+                operation,
+                None,
+                self.dir.clone(),
+                io::Error::other("resume log lock poisoned"),
+            )
+        })
+    }
+}
+
+/// Encode metadata the same way for fresh writes and migrated records.
+pub(super) fn encode_metadata(
+    torrent_id: Uuid,
+    metadata: &StoredTorrentMetadata,
+    dir: &Path,
+) -> TorrentResult<Vec<u8>> {
+    serde_json::to_vec(metadata).map_err(|source| {
+        FastResumeStore::store_parse_error(
+            "metadata_encode",
+            Some(torrent_id),
+            dir.to_path_buf(),
+            source,
+        )
+    })
+}
+
+fn apply_record(
+    index: &mut HashMap<(Uuid, RecordKind), Location>,
+    live_bytes: &mut u64,
+    id: Uuid,
+    kind: RecordKind,
+    location: Location,
+) {
+    let mut retire = |key| {
+        if let Some(previous) = index.remove(&key) {
+            *live_bytes -= previous.record_bytes();
+        }
+    };
+    if kind == RecordKind::Tombstone {
+        retire((id, RecordKind::Fastresume));
+        retire((id, RecordKind::Metadata));
+        return;
+    }
+    retire((id, kind));
+    index.insert((id, kind), location);
+    *live_bytes += location.record_bytes();
+}
+
+fn encode_record(buffer: &mut Vec<u8>, id: Uuid, kind: RecordKind, payload: &[u8]) {
+    let len = u32::try_from(payload.len()).unwrap_or(u32::MAX);
+    let mut checksum = Crc32::new();
+    checksum.update(&[kind as u8]);
+    checksum.update(id.as_bytes());
+    checksum.update(payload);
+    buffer.reserve(HEADER_BYTES + payload.len());
+    buffer.extend_from_slice(&len.to_le_bytes());
+    buffer.extend_from_slice(&checksum.finish().to_le_bytes());
+    buffer.push(kind as u8);
+    buffer.extend_from_slice(id.as_bytes());
+    buffer.extend_from_slice(payload);
+}
+
+fn record_payload(bytes: &[u8], location: Location) -> Option<&[u8]> {
+    let start = usize::try_from(location.offset).ok()? + HEADER_BYTES;
+    bytes.get(start..start + location.len as usize)
+}
+
+struct SegmentScan {
+    records: Vec<(Uuid, RecordKind, u64, u32)>,
+    valid_len: usize,
+}
+
+/// Walk record headers, stopping at the first short or checksum-mismatched record.
+fn scan_segment(bytes: &[u8]) -> SegmentScan {
+    let mut records = Vec::new();
+    let mut offset = 0;
+    while let Some(header) = bytes.get(offset..offset + HEADER_BYTES) {
+        let len = u32::from_le_bytes([header[0], header[1], header[2], header[3]]);
+        let expected = u32::from_le_bytes([header[4], header[5], header[6], header[7]]);
+        let Some(kind) = RecordKind::from_u8(header[8]) else {
+            break;
+        };
+        let Ok(id) = Uuid::from_slice(&header[9..HEADER_BYTES]) else {
+            break;
+        };
+        let body_start = offset + HEADER_BYTES;
+        let Some(payload) = bytes.get(body_start..body_start + len as usize) else {
+            break;
+        };
+        let mut checksum = Crc32::new();
+        checksum.update(&header[8..HEADER_BYTES]);
+        checksum.update(payload);
+        if checksum.finish() != expected {
+            break;
+        }
+        records.push((id, kind, offset as u64, len));
+        offset = body_start + len as usize;
+    }
+    SegmentScan {
+        records,
+        valid_len: offset,
+    }
+}
+
+fn list_segments(dir: &Path) -> TorrentResult<Vec<u64>> {
+    let entries = fs::read_dir(dir)
+        .map_err(|source| io_error("packed_list", None, dir.to_path_buf(), source))?;
+    let mut segments = Vec::new();
+    for entry in entries {
+        let entry =
+            entry.map_err(|source| io_error("packed_list", None, dir.to_path_buf(), source))?;
+        let name = entry.file_name();
+        let Some(id) = name
+            .to_str()
+            .and_then(|name| name.strip_prefix(SEGMENT_PREFIX))
+            .and_then(|name| name.strip_suffix(SEGMENT_SUFFIX))
+            .and_then(|id| id.parse::<u64>().ok())
+        else {
+            continue;
+        };
+        segments.push(id);
+    }
+    segments.sort_unstable();
+    Ok(segments)
+}
+
+/// Rename a damaged segment out of the segment namespace, keeping it for inspection.
+fn quarantine(path: &Path) -> TorrentResult<PathBuf> {
+    let mut target = path.as_os_str().to_owned();
+    target.push(QUARANTINE_SUFFIX);
+    let target = PathBuf::from(target);
+    fs::rename(path, &target)
+        .map_err(|source| io_error("packed_quarantine", None, path.to_path_buf(), source))?;
+    Ok(target)
+}
+
+fn segment_path(dir: &Path, segment: u64) -> PathBuf {
+    dir.join(format!("{SEGMENT_PREFIX}{segment:08}{SEGMENT_SUFFIX}"))
+}
+
+fn open_append(path: &Path) -> TorrentResult<File> {
+    OpenOptions::new()
+        .create(true)
+        .append(true)
+        .open(path)
+        .map_err(|source| io_error("packed_open", None, path.to_path_buf(), source))
+}
+
+/// `fsync` the directory so created or removed segment entries survive a crash.
+#[cfg(unix)]
+fn sync_dir(dir: &Path, operation: &'static str) -> TorrentResult<()> {
+    File::open(dir)
+        .and_then(|handle| handle.sync_all())
+        .map_err(|source| io_error(operation, None, dir.to_path_buf(), source))
+}
+
+/// Directory handles cannot be synced on this platform.
+#[cfg(not(unix))]
+fn sync_dir(_dir: &Path, _operation: &'static str) -> TorrentResult<()> {
+    Ok(())
+}
+
+fn truncate(path: &Path, len: u64) -> TorrentResult<()> {
+    OpenOptions::new()
+        .write(true)
+        .open(path)
+        .and_then(|file| file.set_len(len).and_then(|()| file.sync_all()))
+        .map_err(|source| io_error("packed_truncate", None, path.to_path_buf(), source))
+}
+
+fn io_error(
+    operation: &'static str,
+    torrent_id: Option<Uuid>,
+    path: PathBuf,
+    source: io::Error,
+) -> TorrentError {
+    FastResumeStore::store_io_error(operation, torrent_id, path, source)
+}
+
+fn corrupt(operation: &'static str, torrent_id: Option<Uuid>, path: &Path) -> TorrentError {
+    io_error(
+        operation,
+        torrent_id,
+        path.to_path_buf(),
+        io::Error::new(io::ErrorKind::InvalidData, "resume record out of bounds"),
+    )
+}
+
+/// CRC-32 (IEEE) used to detect torn or corrupted records.
+struct Crc32(u32);
+
+impl Crc32 {
+    const TABLE: [u32; 256] = {
+        let mut table = [0_u32; 256];
+        let mut index: u32 = 0;
+        while index < 256 {
+            let mut value = index;
+            let mut bit = 0;
+            while bit < 8 {
+                value = if value & 1 == 1 {
+                    0xEDB8_8320 ^ (value >> 1)
+                } else {
+                    value >> 1
+                };
+                bit += 1;
+            }
+            table[index as usize] = value;
+            index += 1;
+        }
+        table
+    };
+
+    const fn new() -> Self {
+        Self(u32::MAX)
+    }
+
+    fn update(&mut self, bytes: &[u8]) {
+        for &byte in bytes {
+            self.0 = Self::TABLE[((self.0 ^ u32::from(byte)) & 0xFF) as usize] ^ (self.0 >> 8);
+        }
+    }
+
+    const fn finish(&self) -> u32 {
+        !self.0
+    }
+}
@@ -2,6 +2,8 @@
 
 use chrono::Weekday;
 use revaer_torrent_core::StorageMode as CoreStorageMode;
+use std::sync::Arc;
+use std::time::Duration;
 
 /// Wrapper for boolean flags to avoid pedantic lint churn.
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
@@ -54,6 +56,16 @@ pub struct EngineRuntimeConfig {
     pub coalesce_writes: Toggle,
     /// Whether to use the shared disk cache pool.
     pub use_disk_cache_pool: Toggle,
+    /// Disk I/O subsystem the session is constructed with.
+    pub disk_io_backend: DiskIoBackend,
+    /// Optional number of disk I/O threads for threaded backends.
+    pub aio_threads: Option<i32>,
+    /// Optional number of threads hashing pieces on behalf of the disk subsystem.
+    pub hashing_threads: Option<i32>,
+    /// Optional interval between resume-data checkpoint rounds, in milliseconds.
+    pub resume_checkpoint_interval_ms: Option<i32>,
+    /// Optional cap on resume-data saves outstanding at once.
+    pub resume_max_inflight_saves: Option<i32>,
     /// Explicit listen interfaces (host/device/IP + port).
     pub listen_interfaces: Vec<String>,
     /// IPv6 preference for listening and outbound behaviour.
@@ -159,6 +171,113 @@ pub struct EngineSettingsSnapshot {
     pub seed_time_limit: Option<i32>,
 }
 
+/// Occupancy and approximate memory held by the native parsed-metadata cache.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct MetadataCacheStats {
+    /// Distinct info hashes with parsed metadata held.
+    pub entries: u32,
+    /// Entries used by more than one torrent.
+    pub shared_entries: u32,
+    /// Entries no torrent uses, kept so re-adds skip parsing.
+    pub retained_entries: u32,
+    /// Approximate bytes held by all entries.
+    pub bytes: u64,
+    /// Approximate bytes held by retained entries.
+    pub retained_bytes: u64,
+    /// Adds that reused cached metadata instead of parsing.
+    pub hits: u64,
+    /// Adds that had to parse metainfo.
+    pub misses: u64,
+}
+
+/// Name and kind of one session-wide libtorrent metric.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct SessionStatsMetric {
+    /// Dotted libtorrent metric name, e.g. `disk.queued_disk_jobs`.
+    pub name: String,
+    /// Whether the metric is a monotonic counter rather than a gauge.
+    pub counter: bool,
+}
+
+/// Latest sample of libtorrent's session-wide performance counters.
+#[derive(Debug, Clone, Default)]
+pub struct SessionStats {
+    /// Samples taken since the session started; zero until the first arrives.
+    pub sequence: u64,
+    /// Metric names and kinds, shared between samples and aligned with `values`.
+    pub metrics: Arc<[SessionStatsMetric]>,
+    /// Sampled values in the order of `metrics`.
+    pub values: Vec<i64>,
+}
+
+impl SessionStats {
+    /// Iterate metrics paired with their sampled values.
+    pub fn iter(&self) -> impl Iterator<Item = (&SessionStatsMetric, i64)> {
+        self.metrics.iter().zip(self.values.iter().copied())
+    }
+
+    /// Sampled value of the named metric, if present.
+    #[must_use]
+    pub fn get(&self, name: &str) -> Option<i64> {
+        self.iter()
+            .find_map(|(metric, value)| (metric.name == name).then_some(value))
+    }
+}
+
+/// Latency histogram for one native session entry point.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct CallTiming {
+    /// Native `Session` method name, e.g. `poll_events`.
+    pub name: String,
+    /// Calls recorded since the session started.
+    pub calls: u64,
+    /// Summed wall time of all calls.
+    pub total: Duration,
+    /// Slowest call observed.
+    pub max: Duration,
+    /// Call counts indexed like [`TimingState::bucket_bounds`].
+    pub buckets: Vec<u64>,
+}
+
+/// Latency histograms for every native session entry point, measured inside the bridge.
+#[derive(Debug, Clone, Default)]
+pub struct TimingState {
+    /// Exclusive upper bound of each bucket; the last bucket is effectively unbounded.
+    pub bucket_bounds: Vec<Duration>,
+    /// One histogram per entry point.
+    pub calls: Vec<CallTiming>,
+}
+
+impl TimingState {
+    /// Histogram of the named entry point, if present.
+    #[must_use]
+    pub fn get(&self, name: &str) -> Option<&CallTiming> {
+        self.calls.iter().find(|call| call.name == name)
+    }
+
+    /// Upper bound on the latency below which `per_mille` thousandths of the named entry
+    /// point's calls completed (e.g. `990` for p99), capped at its slowest call.
+    ///
+    /// Returns `None` when the entry point is unknown or has not been called.
+    #[must_use]
+    pub fn quantile(&self, name: &str, per_mille: u32) -> Option<Duration> {
+        let call = self.get(name).filter(|call| call.calls > 0)?;
+        let rank = call
+            .calls
+            .saturating_mul(u64::from(per_mille.min(1_000)))
+            .div_ceil(1_000)
+            .max(1);
+        let mut seen = 0_u64;
+        for (count, bound) in call.buckets.iter().zip(&self.bucket_bounds) {
+            seen = seen.saturating_add(*count);
+            if seen >= rank {
+                return Some((*bound).min(call.max));
+            }
+        }
+        Some(call.max)
+    }
+}
+
 /// IPv6 preference policy applied at runtime.
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
 pub enum Ipv6Mode {
@@ -232,6 +351,35 @@ impl DiskIoMode {
     }
 }
 
+/// Disk I/O subsystem backing the native session.
+///
+/// libtorrent fixes the subsystem when a session is constructed, so a change only takes
+/// effect while no torrents are attached; in practice, with the first profile applied.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum DiskIoBackend {
+    /// libtorrent's platform default: memory-mapped where supported, otherwise `Posix`.
+    #[default]
+    Auto,
+    /// Memory-mapped files serviced by a pool of `aio_threads`; suits fast local SSD and
+    /// `NVMe` storage where page-cache reads are cheap.
+    Mmap,
+    /// Single-threaded portable `pread`/`pwrite`; suits spinning disks and filesystems
+    /// with their own cache, such as ZFS, where memory-mapping double-caches data.
+    Posix,
+}
+
+impl DiskIoBackend {
+    #[must_use]
+    /// Numeric representation consumed by the native bridge.
+    pub const fn as_u8(self) -> u8 {
+        match self {
+            Self::Auto => 0,
+            Self::Mmap => 1,
+            Self::Posix => 2,
+        }
+    }
+}
+
 impl StorageMode {
     #[must_use]
     /// Numeric representation used in FFI/native code.
@@ -487,10 +635,11 @@ pub struct TrackerAuthRuntime {
 #[cfg(test)]
 mod tests {
     use super::{
-        ChokingAlgorithm, DiskIoMode, EncryptionPolicy, Ipv6Mode, SeedChokingAlgorithm,
-        StorageMode, Toggle, TrackerRuntimeConfig,
+        CallTiming, ChokingAlgorithm, DiskIoBackend, DiskIoMode, EncryptionPolicy, Ipv6Mode,
+        SeedChokingAlgorithm, StorageMode, TimingState, Toggle, TrackerRuntimeConfig,
     };
     use revaer_torrent_core::StorageMode as CoreStorageMode;
+    use std::time::Duration;
 
     #[test]
     fn encryption_policy_maps_to_expected_values() {
@@ -521,6 +670,14 @@ mod tests {
         assert_eq!(DiskIoMode::WriteThrough.as_i32(), 3);
     }
 
+    #[test]
+    fn disk_io_backend_maps_to_expected_values() {
+        assert_eq!(DiskIoBackend::default(), DiskIoBackend::Auto);
+        assert_eq!(DiskIoBackend::Auto.as_u8(), 0);
+        assert_eq!(DiskIoBackend::Mmap.as_u8(), 1);
+        assert_eq!(DiskIoBackend::Posix.as_u8(), 2);
+    }
+
     #[test]
     fn storage_mode_round_trips_with_core() {
         assert_eq!(StorageMode::Sparse.as_i32(), 0);
@@ -549,4 +706,47 @@ mod tests {
         assert_eq!(config.ssl_tracker_verify, Some(true));
         assert!(!config.announce_to_all);
     }
+
+    #[test]
+    fn timing_quantiles_walk_buckets_and_cap_at_max() {
+        let state = TimingState {
+            bucket_bounds: vec![
+                Duration::from_micros(1),
+                Duration::from_micros(10),
+                Duration::from_millis(1),
+                Duration::MAX,
+            ],
+            calls: vec![
+                CallTiming {
+                    name: "poll_events".into(),
+                    calls: 100,
+                    total: Duration::from_millis(5),
+                    max: Duration::from_micros(700),
+                    buckets: vec![50, 45, 5, 0],
+                },
+                CallTiming {
+                    name: "list_peers".into(),
+                    calls: 0,
+                    total: Duration::ZERO,
+                    max: Duration::ZERO,
+                    buckets: vec![0; 4],
+                },
+            ],
+        };
+
+        assert_eq!(
+            state.quantile("poll_events", 500),
+            Some(Duration::from_micros(1))
+        );
+        assert_eq!(
+            state.quantile("poll_events", 950),
+            Some(Duration::from_micros(10))
+        );
+        assert_eq!(
+            state.quantile("poll_events", 990),
+            Some(Duration::from_micros(700))
+        );
+        assert_eq!(state.quantile("list_peers", 990), None);
+        assert_eq!(state.quantile("missing", 990), None);
+    }
 }
@@ -2,30 +2,41 @@
 
 use crate::{
     command::EngineCommand,
-    session::LibTorrentSession,
+    session::{LibTorrentSession, RestoreTorrent, checks_payload_before_admission},
     store::{FastResumeStore, StoredTorrentMetadata},
     types::{AltSpeedRuntimeConfig, AltSpeedSchedule, EngineRuntimeConfig},
 };
 use chrono::{DateTime, Datelike, Timelike, Utc};
 use revaer_events::{DiscoveredFile, Event, EventBus, TorrentState};
 use revaer_torrent_core::{
-    AddTorrent, EngineEvent, FilePriorityOverride, FileSelectionRules, FileSelectionUpdate,
-    RemoveTorrent, StorageMode, TorrentFile, TorrentProgress, TorrentRateLimit, TorrentRates,
-    TorrentResult, TorrentSource,
-    model::{TorrentOptionsUpdate, TorrentTrackersUpdate, TorrentWebSeedsUpdate, TrackerStatus},
+    AddTorrent, AddTorrentOptions, EngineEvent, FilePriorityOverride, FileProgress,
+    FileSelectionRules, FileSelectionUpdate, RemoveTorrent, StorageMode, TorrentFile,
+    TorrentProgress, TorrentRateLimit, TorrentRates, TorrentResult, TorrentSource,
+    model::{
+        TorrentAuthorProgress, TorrentAuthorRequest, TorrentAuthorResult, TorrentOptionsUpdate,
+        TorrentTrackersUpdate, TorrentWebSeedsUpdate, TrackerStatus,
+    },
 };
 use std::collections::{BTreeSet, HashMap, HashSet};
 use std::convert::TryFrom;
+use std::sync::Arc;
 use std::time::{Duration, Instant};
-use tokio::sync::mpsc;
+use tokio::sync::{Notify, mpsc, oneshot, watch};
 use tracing::{debug, info, warn};
 use uuid::Uuid;
 
 use crate::error::{LibtorrentError, op_failed};
 
+/// Poll cadence. Each poll requests the next status batch, so this is also the torrent
+/// status refresh rate; alert wakeups only add flushes in between.
 const ALERT_POLL_INTERVAL: Duration = Duration::from_millis(200);
 const PROGRESS_COALESCE_INTERVAL: Duration = Duration::from_millis(100);
 const ALT_SPEED_EVAL_INTERVAL: Duration = Duration::from_secs(30);
+/// Upper bound on adds submitted through one `add_torrents` call.
+const MAX_ADD_BATCH: usize = 64;
+/// Upper bound on how long shutdown waits for outstanding resume-data saves.
+const RESUME_FLUSH_TIMEOUT: Duration = Duration::from_secs(10);
+const RESUME_FLUSH_POLL_INTERVAL: Duration = Duration::from_millis(50);
 
 /// Launch the background task that consumes engine commands and publishes events.
 pub fn spawn(
@@ -35,6 +46,7 @@ pub fn spawn(
     session: Box<dyn LibTorrentSession>,
 ) {
     tokio::spawn(async move {
+        let alerts = session.alert_signal();
         let mut worker = Worker::new(events, session, store);
         let mut poll = tokio::time::interval(ALERT_POLL_INTERVAL);
         let mut alt_tick = tokio::time::interval(ALT_SPEED_EVAL_INTERVAL);
@@ -42,13 +54,14 @@ pub fn spawn(
             tokio::select! {
                 command = commands.recv() => {
                     match command {
-                        Some(command) => {
-                            if let Err(err) = worker.handle(command).await {
-                                let detail = err.to_string();
-                                worker.mark_degraded("session", Some(&detail));
-                                warn!(error = %err, "libtorrent command handling failed");
+                        Some(EngineCommand::Add(request)) => {
+                            let (batch, next) = drain_queued_adds(*request, &mut commands);
+                            worker.run_adds(batch).await;
+                            if let Some(command) = next {
+                                worker.run(command).await;
                             }
                         }
+                        Some(command) => worker.run(command).await,
                         None => break,
                     }
                 }
@@ -59,29 +72,64 @@ pub fn spawn(
                         warn!(error = %err, "failed to apply alt speed schedule");
                     }
                 }
+                () = wait_for_alerts(alerts.as_deref()) => {
+                    if let Err(err) = worker.flush_session_events().await {
+                        let detail = err.to_string();
+                        worker.mark_degraded("session", Some(&detail));
+                        warn!(error = %err, "libtorrent alert polling failed");
+                    }
+                }
                 _ = poll.tick() => {
                     if let Err(err) = worker.flush_session_events().await {
                         let detail = err.to_string();
                         worker.mark_degraded("session", Some(&detail));
                         warn!(error = %err, "libtorrent alert polling failed");
                     }
+                    worker.flush_store();
                 }
             }
         }
-        if let Err(err) = worker.flush_session_events().await {
+        if let Err(err) = worker.flush_resume_checkpoints().await {
             let detail = err.to_string();
             worker.mark_degraded("session", Some(&detail));
             warn!(error = %err, "libtorrent alert polling failed during shutdown");
         }
+        worker.flush_store();
     });
 }
 
+/// Collect the adds queued directly behind `first`, up to [`MAX_ADD_BATCH`]. The first
+/// command of any other kind ends the batch and is returned so it still runs in order.
+fn drain_queued_adds(
+    first: AddTorrent,
+    commands: &mut mpsc::Receiver<EngineCommand>,
+) -> (Vec<AddTorrent>, Option<EngineCommand>) {
+    let mut batch = vec![first];
+    while batch.len() < MAX_ADD_BATCH {
+        match commands.try_recv() {
+            Ok(EngineCommand::Add(request)) => batch.push(*request),
+            Ok(other) => return (batch, Some(other)),
+            Err(_) => break,
+        }
+    }
+    (batch, None)
+}
+
+/// Resolve when the session signals pending alerts; never resolves without a signal.
+async fn wait_for_alerts(signal: Option<&Notify>) {
+    match signal {
+        Some(notify) => notify.notified().await,
+        None => std::future::pending().await,
+    }
+}
+
 struct Worker {
     events: EventBus,
     session: Box<dyn LibTorrentSession>,
     store: Option<FastResumeStore>,
     resume_cache: HashMap<Uuid, StoredTorrentMetadata>,
-    fastresume_payloads: HashMap<Uuid, Vec<u8>>,
+    // Shared with the session on load and restore, so a payload is never copied to be sent.
+    fastresume_payloads: HashMap<Uuid, Arc<Vec<u8>>>,
     health: BTreeSet<String>,
     progress_last_emit: HashMap<Uuid, Instant>,
     base_limits: TorrentRateLimit,
@@ -91,6 +139,18 @@ struct Worker {
     per_torrent_limits: HashMap<Uuid, TorrentRateLimit>,
     cleanup_goals: HashMap<Uuid, CleanupGoal>,
     alt_speed: Option<AltSpeedPlan>,
+    authoring_jobs: HashMap<Uuid, AuthoringJob>,
+    restore_submitted: bool,
+    restore_started: Option<Instant>,
+    // Pre-verified and hash-sampled adds accepted by the session but not yet admitted; their
+    // post-add steps run on `VerifyAdmitted` and are dropped on a torrent error.
+    pending_verifies: HashMap<Uuid, PendingVerify>,
+}
+
+/// Caller channels for an authoring job running in the background.
+struct AuthoringJob {
+    progress: watch::Sender<TorrentAuthorProgress>,
+    respond_to: oneshot::Sender<TorrentResult<TorrentAuthorResult>>,
 }
 
 #[derive(Clone)]
@@ -144,9 +204,17 @@ struct CleanupGoal {
     satisfied: bool,
 }
 
+struct PendingVerify {
+    request: AddTorrent,
+    // Last tenth of the pieces reported in the log, so progress is logged at most ten times.
+    logged_tenths: u32,
+}
+
 #[derive(Debug)]
 enum PendingAction {
     RemoveForCleanup { id: Uuid, remove_data: bool },
+    FinishAuthoring { job_id: Uuid },
+    FinishVerifiedAdd { id: Uuid },
 }
 
 impl Worker {
@@ -177,7 +245,7 @@ impl Worker {
                         }
 
                         if let Some(payload) = state.fastresume {
-                            fastresume_payloads.insert(state.torrent_id, payload);
+                            fastresume_payloads.insert(state.torrent_id, Arc::new(payload));
                         } else {
                             resume_store_warnings.push(format!(
                                 "fastresume payload missing for torrent {}",
@@ -207,6 +275,10 @@ impl Worker {
             per_torrent_limits: HashMap::new(),
             cleanup_goals: HashMap::new(),
             alt_speed: None,
+            authoring_jobs: HashMap::new(),
+            restore_submitted: false,
+            restore_started: None,
+            pending_verifies: HashMap::new(),
         };
 
         if let Some(message) = load_error {
@@ -224,15 +296,45 @@ impl Worker {
         worker
     }
 
+    async fn run(&mut self, command: EngineCommand) {
+        if let Err(err) = self.handle(command).await {
+            let detail = err.to_string();
+            self.mark_degraded("session", Some(&detail));
+            warn!(error = %err, "libtorrent command handling failed");
+        }
+    }
+
+    /// A lone add keeps the synchronous single-add path; anything more goes through
+    /// `add_torrents` so the session admits the batch asynchronously.
+    async fn run_adds(&mut self, mut batch: Vec<AddTorrent>) {
+        if batch.len() == 1 {
+            if let Some(request) = batch.pop() {
+                self.run(EngineCommand::Add(Box::new(request))).await;
+            }
+            return;
+        }
+        if let Err(err) = self.handle_add_batch(batch).await {
+            let detail = err.to_string();
+            self.mark_degraded("session", Some(&detail));
+            warn!(error = %err, "libtorrent batch add failed");
+        }
+    }
+
     async fn handle(&mut self, command: EngineCommand) -> TorrentResult<()> {
         let operation = command.operation();
         match command {
             EngineCommand::Add(request) => self.handle_add(*request).await?,
             EngineCommand::CreateTorrent {
+                job_id,
                 request,
+                progress,
                 respond_to,
             } => {
-                self.handle_create_torrent(request, respond_to).await?;
+                self.handle_create_torrent(job_id, request, progress, respond_to)
+                    .await;
+            }
+            EngineCommand::CancelCreateTorrent { job_id } => {
+                self.handle_cancel_create_torrent(job_id).await?;
             }
             EngineCommand::Remove { id, options } => self.handle_remove(id, options).await?,
             EngineCommand::Pause { id } => self.handle_pause(id).await?,
@@ -282,6 +384,18 @@ impl Worker {
                 let result = self.session.inspect_settings().await;
                 Self::send_response(respond_to, result, operation, None);
             }
+            EngineCommand::InspectMetadataCache { respond_to } => {
+                let result = self.session.inspect_metadata_cache().await;
+                Self::send_response(respond_to, result, operation, None);
+            }
+            EngineCommand::InspectSessionStats { respond_to } => {
+                let result = self.session.inspect_session_stats().await;
+                Self::send_response(respond_to, result, operation, None);
+            }
+            EngineCommand::InspectTimingState { respond_to } => {
+                let result = self.session.inspect_timing_state().await;
+                Self::send_response(respond_to, result, operation, None);
+            }
         }
 
         self.flush_session_events().await
@@ -289,7 +403,35 @@ impl Worker {
 
     async fn handle_add(&mut self, request: AddTorrent) -> TorrentResult<()> {
         let mut request = request;
-        self.backfill_request_from_resume(&mut request);
+        self.prepare_add(&mut request);
+        self.session.add_torrent(&request).await?;
+        self.finish_or_hold_add(request).await
+    }
+
+    /// Submit adds that were queued back to back through one `add_torrents` call, then
+    /// finish each accepted request as a single add would.
+    async fn handle_add_batch(&mut self, requests: Vec<AddTorrent>) -> TorrentResult<()> {
+        let mut requests = requests;
+        for request in &mut requests {
+            self.prepare_add(request);
+        }
+        let results = self.session.add_torrents(&requests).await?;
+        for (request, result) in requests.iter().zip(results) {
+            let outcome = match result {
+                Ok(()) => self.finish_or_hold_add(request.clone()).await,
+                Err(err) => Err(err),
+            };
+            if let Err(err) = outcome {
+                let detail = err.to_string();
+                self.mark_degraded("session", Some(&detail));
+                warn!(torrent_id = %request.id, error = %err, "libtorrent add failed");
+            }
+        }
+        self.flush_session_events().await
+    }
+
+    fn prepare_add(&self, request: &mut AddTorrent) {
+        self.backfill_request_from_resume(request);
 
         if request.options.hash_check_sample_pct.is_some()
             && matches!(request.source, TorrentSource::Magnet { .. })
@@ -301,6 +443,16 @@ impl Worker {
             request.options.hash_check_sample_pct = None;
         }
 
+        if request.options.pre_verify.unwrap_or(false)
+            && matches!(request.source, TorrentSource::Magnet { .. })
+        {
+            warn!(
+                torrent_id = %request.id,
+                "pre-verify requested without metainfo; libtorrent will check files instead"
+            );
+            request.options.pre_verify = None;
+        }
+
         if request.options.seed_mode.unwrap_or(false)
             && request.options.hash_check_sample_pct.is_none()
         {
@@ -312,8 +464,26 @@ impl Worker {
 
         request.options.seed_ratio_limit = None;
         request.options.seed_time_limit = None;
+    }
 
-        self.session.add_torrent(&request).await?;
+    /// A checked add is only queued for hashing when the session accepts it, so its
+    /// post-add steps wait until the session reports the admission.
+    async fn finish_or_hold_add(&mut self, request: AddTorrent) -> TorrentResult<()> {
+        if checks_payload_before_admission(&request) {
+            info!(torrent_id = %request.id, "checking existing data before admission");
+            self.pending_verifies.insert(
+                request.id,
+                PendingVerify {
+                    request,
+                    logged_tenths: 0,
+                },
+            );
+            return Ok(());
+        }
+        self.finish_add(&request).await
+    }
+
+    async fn finish_add(&mut self, request: &AddTorrent) -> TorrentResult<()> {
         self.apply_fastresume_if_present(request.id).await;
 
         let mut effective_selection = request.options.file_rules.clone();
@@ -331,7 +501,7 @@ impl Worker {
             .await?;
 
         self.publish_reconciliations(request.id, reconciliation_reasons);
-        self.emit_add_event(&request);
+        self.emit_add_event(request);
 
         let storage_mode = request.options.storage_mode.unwrap_or(self.storage_mode);
 
@@ -376,85 +546,129 @@ impl Worker {
 
     async fn handle_create_torrent(
         &mut self,
-        request: revaer_torrent_core::model::TorrentAuthorRequest,
-        respond_to: tokio::sync::oneshot::Sender<
-            TorrentResult<revaer_torrent_core::model::TorrentAuthorResult>,
-        >,
-    ) -> TorrentResult<()> {
-        let result = self.session.create_torrent(&request).await;
-        Self::send_response(respond_to, result, "create_torrent", None);
-        Ok(())
+        job_id: Uuid,
+        request: TorrentAuthorRequest,
+        progress: watch::Sender<TorrentAuthorProgress>,
+        respond_to: oneshot::Sender<TorrentResult<TorrentAuthorResult>>,
+    ) {
+        match self.session.start_create_torrent(job_id, &request).await {
+            Ok(None) => {
+                debug!(job_id = %job_id, "torrent authoring job started");
+                self.authoring_jobs.insert(
+                    job_id,
+                    AuthoringJob {
+                        progress,
+                        respond_to,
+                    },
+                );
+            }
+            Ok(Some(result)) => {
+                Self::send_response(respond_to, Ok(result), "create_torrent", None);
+            }
+            Err(err) => Self::send_response(respond_to, Err(err), "create_torrent", None),
+        }
+    }
+
+    async fn handle_cancel_create_torrent(&mut self, job_id: Uuid) -> TorrentResult<()> {
+        if !self.authoring_jobs.contains_key(&job_id) {
+            debug!(job_id = %job_id, "ignoring cancel for inactive authoring job");
+            return Ok(());
+        }
+        self.session.cancel_create_torrent(job_id).await
+    }
+
+    fn handle_authoring_progress(&self, progress: TorrentAuthorProgress) {
+        let Some(job) = self.authoring_jobs.get(&progress.job_id) else {
+            return;
+        };
+        debug!(
+            job_id = %progress.job_id,
+            pieces_done = progress.pieces_done,
+            pieces_total = progress.pieces_total,
+            bytes_per_second = progress.bytes_per_second,
+            "torrent authoring progress"
+        );
+        job.progress.send_replace(progress);
+    }
+
+    async fn finish_authoring(&mut self, job_id: Uuid) {
+        let Some(job) = self.authoring_jobs.remove(&job_id) else {
+            return;
+        };
+        let result = self.session.finish_create_torrent(job_id).await;
+        Self::send_response(job.respond_to, result, "create_torrent", None);
     }
 
     fn backfill_request_from_resume(&self, request: &mut AddTorrent) {
-        if let Some(stored) = self.resume_cache.get(&request.id) {
-            if request.options.trackers.is_empty() && !stored.trackers.is_empty() {
-                request.options.trackers.clone_from(&stored.trackers);
-                request.options.replace_trackers = stored.replace_trackers;
+        self.backfill_options_from_resume(request.id, &mut request.options);
+    }
+
+    fn backfill_options_from_resume(&self, torrent_id: Uuid, options: &mut AddTorrentOptions) {
+        if let Some(stored) = self.resume_cache.get(&torrent_id) {
+            if options.trackers.is_empty() && !stored.trackers.is_empty() {
+                options.trackers.clone_from(&stored.trackers);
+                options.replace_trackers = stored.replace_trackers;
             }
-            if request.options.web_seeds.is_empty() && !stored.web_seeds.is_empty() {
-                request.options.web_seeds.clone_from(&stored.web_seeds);
-                request.options.replace_web_seeds = stored.replace_web_seeds;
+            if options.web_seeds.is_empty() && !stored.web_seeds.is_empty() {
+                options.web_seeds.clone_from(&stored.web_seeds);
+                options.replace_web_seeds = stored.replace_web_seeds;
             }
-            if request.options.tags.is_empty() && !stored.tags.is_empty() {
-                request.options.tags.clone_from(&stored.tags);
+            if options.tags.is_empty() && !stored.tags.is_empty() {
+                options.tags.clone_from(&stored.tags);
             }
-            if request.options.category.is_none() && stored.category.is_some() {
-                request.options.category.clone_from(&stored.category);
+            if options.category.is_none() && stored.category.is_some() {
+                options.category.clone_from(&stored.category);
             }
-            if request.options.comment.is_none() && stored.comment.is_some() {
-                request.options.comment.clone_from(&stored.comment);
+            if options.comment.is_none() && stored.comment.is_some() {
+                options.comment.clone_from(&stored.comment);
             }
-            if request.options.source.is_none() && stored.source.is_some() {
-                request.options.source.clone_from(&stored.source);
+            if options.source.is_none() && stored.source.is_some() {
+                options.source.clone_from(&stored.source);
             }
-            if request.options.private.is_none() && stored.private.is_some() {
-                request.options.private = stored.private;
+            if options.private.is_none() && stored.private.is_some() {
+                options.private = stored.private;
             }
-            if request.options.cleanup.is_none() && stored.cleanup.is_some() {
-                request.options.cleanup.clone_from(&stored.cleanup);
+            if options.cleanup.is_none() && stored.cleanup.is_some() {
+                options.cleanup.clone_from(&stored.cleanup);
             }
-            if request.options.connections_limit.is_none() {
-                request.options.connections_limit = stored.connections_limit;
+            if options.connections_limit.is_none() {
+                options.connections_limit = stored.connections_limit;
             }
-            if !has_rate_limit(&request.options.rate_limit)
+            if !has_rate_limit(&options.rate_limit)
                 && let Some(limit) = &stored.rate_limit
             {
-                request.options.rate_limit = limit.clone();
+                options.rate_limit = limit.clone();
             }
-            if request.options.seed_mode.is_none() {
-                request.options.seed_mode = stored.seed_mode;
+            if options.seed_mode.is_none() {
+                options.seed_mode = stored.seed_mode;
             }
-            if request.options.hash_check_sample_pct.is_none() {
-                request.options.hash_check_sample_pct = stored.hash_check_sample_pct;
+            if options.hash_check_sample_pct.is_none() {
+                options.hash_check_sample_pct = stored.hash_check_sample_pct;
             }
-            if request.options.super_seeding.is_none() {
-                request.options.super_seeding = stored.super_seeding;
+            if options.super_seeding.is_none() {
+                options.super_seeding = stored.super_seeding;
             }
-            if request.options.auto_managed.is_none() {
-                request.options.auto_managed = stored.auto_managed;
+            if options.auto_managed.is_none() {
+                options.auto_managed = stored.auto_managed;
             }
-            if request.options.queue_position.is_none() {
-                request.options.queue_position = stored.queue_position;
+            if options.queue_position.is_none() {
+                options.queue_position = stored.queue_position;
             }
-            if request.options.pex_enabled.is_none() {
-                request.options.pex_enabled = stored.pex_enabled;
+            if options.pex_enabled.is_none() {
+                options.pex_enabled = stored.pex_enabled;
             }
-            if request.options.storage_mode.is_none() {
-                request.options.storage_mode = stored.storage_mode;
+            if options.storage_mode.is_none() {
+                options.storage_mode = stored.storage_mode;
             }
-            if request.options.download_dir.is_none() && stored.download_dir.is_some() {
-                request
-                    .options
-                    .download_dir
-                    .clone_from(&stored.download_dir);
+            if options.download_dir.is_none() && stored.download_dir.is_some() {
+                options.download_dir.clone_from(&stored.download_dir);
             }
         }
     }
 
     async fn apply_fastresume_if_present(&mut self, id: Uuid) {
-        if let Some(payload) = self.fastresume_payloads.get(&id).cloned() {
-            if let Err(err) = self.session.load_fastresume(id, &payload).await {
+        if let Some(payload) = self.fastresume_payloads.get(&id) {
+            if let Err(err) = self.session.load_fastresume(id, Arc::clone(payload)).await {
                 let detail = err.to_string();
                 self.mark_degraded("resume_store", Some(&detail));
             } else {
@@ -617,6 +831,7 @@ impl Worker {
 
     async fn handle_remove(&mut self, id: Uuid, options: RemoveTorrent) -> TorrentResult<()> {
         self.session.remove_torrent(id, &options).await?;
+        self.pending_verifies.remove(&id);
         let mut store_ok = true;
         if let Some(store) = &self.store {
             match store.remove(id) {
@@ -881,6 +1096,12 @@ impl Worker {
 
     async fn handle_apply_config(&mut self, config: EngineRuntimeConfig) -> TorrentResult<()> {
         self.session.apply_config(&config).await?;
+        // Accepted settings the session cannot switch live stay visible in health until the
+        // process restarts or the profile reverts them.
+        match self.session.pending_restart() {
+            Some(detail) => self.mark_degraded("restart_required", Some(&detail)),
+            None => self.mark_recovered("restart_required"),
+        }
         self.base_limits = TorrentRateLimit {
             download_bps: map_limit(config.download_rate_limit),
             upload_bps: map_limit(config.upload_rate_limit),
@@ -903,9 +1124,86 @@ impl Worker {
             "applied engine runtime configuration"
         );
         self.reconcile_alt_speed().await?;
+        self.restore_stored_torrents().await;
         Ok(())
     }
 
+    /// Re-admit every stored torrent through one bulk restore. Runs after the first engine
+    /// profile is applied so restored torrents start under the configured session settings.
+    async fn restore_stored_torrents(&mut self) {
+        if self.restore_submitted || self.fastresume_payloads.is_empty() {
+            return;
+        }
+        self.restore_submitted = true;
+        let mut restored = Vec::with_capacity(self.fastresume_payloads.len());
+        let mut torrents = Vec::with_capacity(self.fastresume_payloads.len());
+        for (id, payload) in &self.fastresume_payloads {
+            let mut options = AddTorrentOptions::default();
+            self.backfill_options_from_resume(*id, &mut options);
+            torrents.push(RestoreTorrent {
+                id: *id,
+                fastresume: Arc::clone(payload),
+                download_dir: options.download_dir.clone(),
+            });
+            restored.push((*id, options));
+        }
+        let count = torrents.len();
+        let started = Instant::now();
+        match self.session.restore_torrents(torrents).await {
+            Ok(()) => {
+                self.restore_started = Some(started);
+                info!(torrents = count, "submitted stored torrents for restore");
+            }
+            Err(err) => {
+                let detail = err.to_string();
+                self.mark_degraded("resume_store", Some(&detail));
+                warn!(error = %detail, "failed to restore stored torrents");
+                return;
+            }
+        }
+        for (id, options) in restored {
+            self.reconcile_restored(id, options).await;
+        }
+    }
+
+    /// Re-apply the persisted selection, sequential flag, rate limit and cleanup policy to a
+    /// torrent submitted through bulk restore, as the single-add path does for re-adds.
+    /// Sessions hold these updates until the torrent is admitted.
+    async fn reconcile_restored(&mut self, torrent_id: Uuid, options: AddTorrentOptions) {
+        let mut selection = options.file_rules.clone();
+        let mut download_dir = options.download_dir.clone();
+        let mut priorities = Vec::new();
+        let mut sequential = options.sequential.unwrap_or(false);
+        match self
+            .reconcile_from_resume(
+                torrent_id,
+                &mut selection,
+                &mut download_dir,
+                &mut priorities,
+                &mut sequential,
+            )
+            .await
+        {
+            Ok(reasons) => self.publish_reconciliations(torrent_id, reasons),
+            Err(err) => warn!(
+                torrent_id = %torrent_id,
+                error = %err,
+                "failed to restore persisted selection for restored torrent"
+            ),
+        }
+        if let Err(err) = self
+            .apply_initial_rate_limit(torrent_id, &options.rate_limit)
+            .await
+        {
+            warn!(
+                torrent_id = %torrent_id,
+                error = %err,
+                "failed to restore rate limit for restored torrent"
+            );
+        }
+        self.register_cleanup_goal(torrent_id, options.cleanup);
+    }
+
     async fn reconcile_alt_speed(&mut self) -> TorrentResult<()> {
         let now = Utc::now();
         self.reconcile_alt_speed_with_now(now).await
@@ -972,6 +1270,24 @@ impl Worker {
         }
     }
 
+    /// Force a resume checkpoint for every torrent with unsaved state and persist the
+    /// responses, waiting up to `RESUME_FLUSH_TIMEOUT` for outstanding saves.
+    async fn flush_resume_checkpoints(&mut self) -> TorrentResult<()> {
+        let deadline = Instant::now() + RESUME_FLUSH_TIMEOUT;
+        loop {
+            let outstanding = self.session.flush_resume_data().await?;
+            self.flush_session_events().await?;
+            if outstanding == 0 {
+                return Ok(());
+            }
+            if Instant::now() >= deadline {
+                warn!(outstanding, "resume data flush timed out during shutdown");
+                return Ok(());
+            }
+            tokio::time::sleep(RESUME_FLUSH_POLL_INTERVAL).await;
+        }
+    }
+
     fn publish_engine_event(&mut self, event: EngineEvent, actions: &mut Vec<PendingAction>) {
         match event {
             EngineEvent::FilesDiscovered { torrent_id, files } => {
@@ -984,6 +1300,9 @@ impl Worker {
             } => {
                 self.handle_progress_event(torrent_id, &progress, &rates, actions);
             }
+            EngineEvent::FileProgress { torrent_id, files } => {
+                self.handle_file_progress(torrent_id, files);
+            }
             EngineEvent::StateChanged { torrent_id, state } => {
                 self.handle_state_changed(torrent_id, state);
             }
@@ -1031,6 +1350,29 @@ impl Worker {
             EngineEvent::SessionError { component, message } => {
                 self.handle_session_error(component, &message);
             }
+            EngineEvent::AuthoringProgress { progress } => {
+                self.handle_authoring_progress(progress);
+            }
+            EngineEvent::AuthoringFinished { job_id } => {
+                actions.push(PendingAction::FinishAuthoring { job_id });
+            }
+            EngineEvent::VerifyProgress {
+                torrent_id,
+                pieces_done,
+                pieces_total,
+            } => {
+                self.handle_verify_progress(torrent_id, pieces_done, pieces_total);
+            }
+            EngineEvent::VerifyAdmitted { torrent_id } => {
+                actions.push(PendingAction::FinishVerifiedAdd { id: torrent_id });
+            }
+            EngineEvent::RestoreFinished { restored, failed } => {
+                let elapsed_ms = self
+                    .restore_started
+                    .take()
+                    .map(|started| started.elapsed().as_millis());
+                info!(restored, failed, elapsed_ms = ?elapsed_ms, "restored stored torrents");
+            }
         }
     }
 
@@ -1052,6 +1394,22 @@ impl Worker {
         self.mark_recovered("session");
     }
 
+    fn handle_file_progress(&mut self, torrent_id: Uuid, files: Vec<FileProgress>) {
+        if files.is_empty() {
+            return;
+        }
+        let files = files
+            .into_iter()
+            .map(|file| revaer_events::FileProgress {
+                index: file.index,
+                bytes_completed: file.bytes_completed,
+                completed: file.completed,
+            })
+            .collect();
+        self.publish_event(Event::FileProgress { torrent_id, files });
+        self.mark_recovered("session");
+    }
+
     fn handle_progress_event(
         &mut self,
         torrent_id: Uuid,
@@ -1155,6 +1513,9 @@ impl Worker {
     }
 
     fn handle_error(&mut self, torrent_id: Uuid, message: String) {
+        if self.pending_verifies.remove(&torrent_id).is_some() {
+            warn!(torrent_id = %torrent_id, error = %message, "pre-verified add was not admitted");
+        }
         let detail = message.clone();
         self.publish_event(Event::StateChanged {
             torrent_id,
@@ -1163,6 +1524,18 @@ impl Worker {
         self.mark_degraded("session", Some(detail.as_str()));
     }
 
+    fn handle_verify_progress(&mut self, torrent_id: Uuid, pieces_done: u32, pieces_total: u32) {
+        let Some(pending) = self.pending_verifies.get_mut(&torrent_id) else {
+            return;
+        };
+        let tenths = u32::try_from(u64::from(pieces_done) * 10 / u64::from(pieces_total.max(1)))
+            .unwrap_or(10);
+        if tenths > pending.logged_tenths {
+            pending.logged_tenths = tenths;
+            info!(torrent_id = %torrent_id, pieces_done, pieces_total, "pre-verify progress");
+        }
+    }
+
     fn handle_session_error(&mut self, component: Option<String>, message: &str) {
         if let Some(component) = component {
             self.mark_degraded(&component, Some(message));
@@ -1314,6 +1687,15 @@ impl Worker {
                         "cleanup policy reached; removing torrent"
                     );
                 }
+                PendingAction::FinishAuthoring { job_id } => {
+                    self.finish_authoring(job_id).await;
+                }
+                PendingAction::FinishVerifiedAdd { id } => {
+                    if let Some(pending) = self.pending_verifies.remove(&id) {
+                        info!(torrent_id = %id, "pre-verified torrent admitted");
+                        self.finish_add(&pending.request).await?;
+                    }
+                }
             }
         }
         Ok(())
@@ -1380,7 +1762,19 @@ impl Worker {
                 self.mark_recovered("resume_store");
             }
         }
-        self.fastresume_payloads.insert(torrent_id, payload);
+        self.fastresume_payloads
+            .insert(torrent_id, Arc::new(payload));
+    }
+
+    /// Commit any writes the resume store is still batching.
+    fn flush_store(&mut self) {
+        if let Some(store) = &self.store
+            && let Err(err) = store.flush()
+        {
+            let detail = err.to_string();
+            self.mark_degraded("resume_store", Some(&detail));
+            warn!(error = %detail, "failed to flush resume store");
+        }
     }
 
     fn should_emit_progress(&mut self, torrent_id: Uuid) -> bool {
@@ -1572,7 +1966,7 @@ mod tests {
         FileSelectionUpdate, PeerChoke, PeerInterest, PeerSnapshot, RemoveTorrent,
         TorrentCleanupPolicy, TorrentFile, TorrentProgress, TorrentRateLimit, TorrentRates,
         TorrentSource,
-        model::{TorrentAuthorRequest, TorrentOptionsUpdate},
+        model::{TorrentAuthorFormat, TorrentAuthorRequest, TorrentOptionsUpdate},
     };
     use std::fs;
     use std::path::PathBuf;
@@ -1661,7 +2055,11 @@ mod tests {
             Ok(())
         }
 
-        async fn load_fastresume(&mut self, _id: Uuid, _payload: &[u8]) -> TorrentResult<()> {
+        async fn load_fastresume(
+            &mut self,
+            _id: Uuid,
+            _payload: Arc<Vec<u8>>,
+        ) -> TorrentResult<()> {
             Ok(())
         }
 
@@ -1754,6 +2152,26 @@ mod tests {
         encoded
     }
 
+    #[tokio::test]
+    async fn wait_for_alerts_follows_signal_and_stays_pending_without_one() -> Result<()> {
+        let notify = Notify::new();
+        notify.notify_one();
+        timeout(Duration::from_millis(50), wait_for_alerts(Some(&notify)))
+            .await
+            .map_err(|_| anyhow!("expected signalled wait to resolve"))?;
+
+        assert!(
+            timeout(Duration::from_millis(20), wait_for_alerts(None))
+                .await
+                .is_err()
+        );
+        assert!(
+            StubSession::default().alert_signal().is_none(),
+            "stub session should rely on interval polling"
+        );
+        Ok(())
+    }
+
     #[tokio::test]
     async fn add_command_with_stub_session_publishes_initial_events() -> Result<()> {
         let bus = EventBus::with_capacity(16);
@@ -1810,6 +2228,113 @@ mod tests {
         Ok(())
     }
 
+    #[tokio::test]
+    async fn queued_adds_are_submitted_as_one_batch() -> Result<()> {
+        let (tx, mut rx) = mpsc::channel(8);
+        let requests: Vec<AddTorrent> = (0..3)
+            .map(|idx| AddTorrent {
+                id: Uuid::new_v4(),
+                source: TorrentSource::magnet(format!("magnet:?xt=urn:btih:stub{idx}")),
+                options: AddTorrentOptions {
+                    name_hint: Some(format!("batch-{idx}")),
+                    ..AddTorrentOptions::default()
+                },
+            })
+            .collect();
+        for request in &requests[1..] {
+            tx.send(EngineCommand::Add(Box::new(request.clone())))
+                .await?;
+        }
+        let paused = Uuid::new_v4();
+        tx.send(EngineCommand::Pause { id: paused }).await?;
+
+        let (batch, next) = drain_queued_adds(requests[0].clone(), &mut rx);
+        assert_eq!(
+            batch.iter().map(|request| request.id).collect::<Vec<_>>(),
+            requests
+                .iter()
+                .map(|request| request.id)
+                .collect::<Vec<_>>()
+        );
+        assert!(matches!(next, Some(EngineCommand::Pause { id }) if id == paused));
+
+        let bus = EventBus::with_capacity(16);
+        let mut stream = bus.subscribe(None);
+        let session: Box<dyn LibTorrentSession> = Box::new(StubSession::default());
+        let mut worker = Worker::new(bus.clone(), session, None);
+        worker.handle_add_batch(batch).await?;
+
+        let mut added = HashSet::new();
+        while let Some(event) = next_event_with_timeout(&mut stream, 50).await {
+            if let Event::TorrentAdded { torrent_id, .. } = event {
+                added.insert(torrent_id);
+            }
+        }
+        for request in &requests {
+            assert!(
+                added.contains(&request.id),
+                "missing TorrentAdded for batch item"
+            );
+            assert!(worker.resume_cache.contains_key(&request.id));
+        }
+        assert!(!worker.health.contains("session"));
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn pre_verified_add_completes_only_after_admission() -> Result<()> {
+        let bus = EventBus::with_capacity(32);
+        let mut stream = bus.subscribe(None);
+        let session: Box<dyn LibTorrentSession> = Box::new(StubSession::default());
+        let mut worker = Worker::new(bus.clone(), session, None);
+        let verify = |name: &str| AddTorrent {
+            id: Uuid::new_v4(),
+            source: TorrentSource::metainfo(b"stub".to_vec()),
+            options: AddTorrentOptions {
+                name_hint: Some(name.into()),
+                pre_verify: Some(true),
+                ..AddTorrentOptions::default()
+            },
+        };
+
+        let admitted = verify("admitted");
+        worker.handle_add(admitted.clone()).await?;
+        assert!(worker.pending_verifies.contains_key(&admitted.id));
+        assert!(!worker.resume_cache.contains_key(&admitted.id));
+
+        worker.flush_session_events().await?;
+        assert!(worker.pending_verifies.is_empty());
+        assert!(worker.resume_cache.contains_key(&admitted.id));
+        let mut added = false;
+        while let Some(event) = next_event_with_timeout(&mut stream, 50).await {
+            if matches!(event, Event::TorrentAdded { torrent_id, .. } if torrent_id == admitted.id)
+            {
+                added = true;
+            }
+        }
+        assert!(added, "admission should publish TorrentAdded");
+
+        let rejected = verify("rejected");
+        worker.handle_add(rejected.clone()).await?;
+        let mut actions = Vec::new();
+        worker.publish_engine_event(
+            EngineEvent::Error {
+                torrent_id: rejected.id,
+                message: "pre-verify failed: unreadable".into(),
+            },
+            &mut actions,
+        );
+        assert!(worker.pending_verifies.is_empty());
+        worker.flush_session_events().await?;
+        while let Some(event) = next_event_with_timeout(&mut stream, 50).await {
+            assert!(
+                !matches!(event, Event::TorrentAdded { torrent_id, .. } if torrent_id == rejected.id),
+                "a rejected pre-verify must not publish TorrentAdded"
+            );
+        }
+        Ok(())
+    }
+
     #[tokio::test]
     async fn add_command_applies_per_torrent_rate_limit() -> Result<()> {
         let bus = EventBus::with_capacity(8);
@@ -1907,12 +2432,17 @@ mod tests {
             private: true,
             comment: Some("fixture".to_string()),
             source: Some("revaer".to_string()),
+            hash_threads: None,
+            format: TorrentAuthorFormat::default(),
         };
         let (respond_to, rx) = oneshot::channel();
+        let (progress, _progress_rx) = watch::channel(TorrentAuthorProgress::default());
 
         worker
             .handle(EngineCommand::CreateTorrent {
+                job_id: Uuid::new_v4(),
                 request: request.clone(),
+                progress,
                 respond_to,
             })
             .await?;
@@ -1929,6 +2459,57 @@ mod tests {
         Ok(())
     }
 
+    #[tokio::test]
+    async fn authoring_job_events_drive_progress_and_completion() -> Result<()> {
+        let bus = EventBus::with_capacity(4);
+        let session: Box<dyn LibTorrentSession> = Box::new(StubSession::default());
+        let mut worker = Worker::new(bus, session, None);
+        let job_id = Uuid::new_v4();
+        let (respond_to, rx) = oneshot::channel();
+        let (progress, progress_rx) = watch::channel(TorrentAuthorProgress::default());
+        worker.authoring_jobs.insert(
+            job_id,
+            AuthoringJob {
+                progress,
+                respond_to,
+            },
+        );
+
+        let mut actions = Vec::new();
+        let update = TorrentAuthorProgress {
+            job_id,
+            bytes_hashed: 16_384,
+            bytes_total: 65_536,
+            pieces_done: 1,
+            pieces_total: 4,
+            bytes_per_second: 1_024,
+        };
+        worker.publish_engine_event(
+            EngineEvent::AuthoringProgress { progress: update },
+            &mut actions,
+        );
+        assert_eq!(*progress_rx.borrow(), update);
+        assert!(actions.is_empty());
+
+        // Cancels for tracked jobs reach the session, which does not know this one.
+        assert!(
+            worker
+                .handle(EngineCommand::CancelCreateTorrent { job_id })
+                .await
+                .is_err()
+        );
+        worker.publish_engine_event(EngineEvent::AuthoringFinished { job_id }, &mut actions);
+        worker.apply_actions(actions).await?;
+
+        // The stub session has no background jobs, so collecting the result fails.
+        let response = rx
+            .await
+            .map_err(|_| anyhow!("expected authoring response"))?;
+        assert!(response.is_err());
+        assert!(worker.authoring_jobs.is_empty());
+        Ok(())
+    }
+
     #[tokio::test]
     async fn add_command_persists_connection_limit_metadata() -> Result<()> {
         let bus = EventBus::with_capacity(4);
@@ -2840,6 +3421,49 @@ mod tests {
         Ok(())
     }
 
+    #[tokio::test]
+    async fn file_progress_event_publishes_deltas() -> Result<()> {
+        let bus = EventBus::with_capacity(8);
+        let session: Box<dyn LibTorrentSession> = Box::new(StubSession::default());
+        let mut worker = Worker::new(bus.clone(), session, None);
+        let mut stream = bus.subscribe(None);
+        let torrent_id = Uuid::new_v4();
+        let mut actions = Vec::new();
+
+        worker.publish_engine_event(
+            EngineEvent::FileProgress {
+                torrent_id,
+                files: vec![revaer_torrent_core::FileProgress {
+                    index: 3,
+                    bytes_completed: 4_096,
+                    completed: true,
+                }],
+            },
+            &mut actions,
+        );
+        worker.apply_actions(actions).await?;
+
+        match next_event_with_timeout(&mut stream, 50).await {
+            Some(Event::FileProgress {
+                torrent_id: id,
+                files,
+            }) => {
+                assert_eq!(id, torrent_id);
+                assert_eq!(
+                    files,
+                    vec![revaer_events::FileProgress {
+                        index: 3,
+                        bytes_completed: 4_096,
+                        completed: true,
+                    }]
+                );
+            }
+            _ => return Err(anyhow!("expected file progress event")),
+        }
+
+        Ok(())
+    }
+
     #[tokio::test]
     async fn completed_event_publishes_state_and_completion() -> Result<()> {
         let bus = EventBus::with_capacity(8);
@@ -3086,6 +3710,125 @@ mod tests {
         Ok(())
     }
 
+    #[tokio::test]
+    async fn stored_torrents_are_restored_once_in_bulk() -> Result<()> {
+        let temp = temp_dir()?;
+        let store = FastResumeStore::new(temp.path());
+        let torrent_id = Uuid::new_v4();
+        store.write_metadata(
+            torrent_id,
+            &StoredTorrentMetadata {
+                download_dir: Some(".server_root/restored".into()),
+                ..StoredTorrentMetadata::default()
+            },
+        )?;
+        store.write_fastresume(torrent_id, b"resume")?;
+
+        let bus = EventBus::with_capacity(8);
+        let session: Box<dyn LibTorrentSession> = Box::new(StubSession::default());
+        let mut worker = Worker::new(bus, session, Some(store));
+
+        worker.restore_stored_torrents().await;
+        assert!(worker.restore_submitted);
+        assert!(worker.restore_started.is_some());
+        worker.flush_session_events().await?;
+        assert!(
+            worker.restore_started.is_none(),
+            "restore completion should be observed"
+        );
+
+        worker.restore_stored_torrents().await;
+        assert!(
+            worker.restore_started.is_none(),
+            "restore must not resubmit"
+        );
+        worker
+            .handle(EngineCommand::Pause { id: torrent_id })
+            .await?;
+        Ok(())
+    }
+
+    #[tokio::test]
+    async fn bulk_restore_reapplies_persisted_selection() -> Result<()> {
+        let temp = temp_dir()?;
+        let store = FastResumeStore::new(temp.path());
+        let torrent_id = Uuid::new_v4();
+        store.write_metadata(
+            torrent_id,
+            &StoredTorrentMetadata {
+                selection: FileSelectionRules {
+                    include: vec!["Season1/**".into()],
+                    exclude: vec!["**/*.nfo".into()],
+                    skip_fluff: true,
+                },
+                priorities: vec![FilePriorityOverride {
+                    index: 2,
+                    priority: FilePriority::High,
+                }],
+                sequential: true,
+                tags: vec!["persisted".into()],
+                rate_limit: Some(TorrentRateLimit {
+                    download_bps: Some(4_096),
+                    upload_bps: None,
+                }),
+                ..StoredTorrentMetadata::default()
+            },
+        )?;
+        store.write_fastresume(torrent_id, b"resume")?;
+
+        let bus = EventBus::with_capacity(32);
+        let mut stream = bus.subscribe(None);
+        let session: Box<dyn LibTorrentSession> = Box::new(StubSession::default());
+        let mut worker = Worker::new(bus.clone(), session, Some(store.clone()));
+
+        worker.restore_stored_torrents().await;
+        worker.flush_session_events().await?;
+
+        let mut reconciled = false;
+        while let Some(event) = next_event_with_timeout(&mut stream, 50).await {
+            if matches!(event, Event::SelectionReconciled { torrent_id: id, .. } if id == torrent_id)
+            {
+                reconciled = true;
+            }
+        }
+        assert!(
+            reconciled,
+            "expected selection reconciliation for restored torrent"
+        );
+
+        let state = store
+            .load_all()?
+            .into_iter()
+            .find(|entry| entry.torrent_id == torrent_id)
+            .ok_or_else(|| anyhow!("expected stored torrent"))?;
+        let payload = state
+            .fastresume
+            .ok_or_else(|| anyhow!("expected refreshed resume payload"))?;
+        let resume: serde_json::Value = serde_json::from_slice(&payload)?;
+        assert_eq!(
+            resume["selection"]["include"],
+            serde_json::json!(["Season1/**"])
+        );
+        assert_eq!(
+            resume["selection"]["exclude"],
+            serde_json::json!(["**/*.nfo"])
+        );
+        assert_eq!(resume["selection"]["skip_fluff"], serde_json::json!(true));
+        assert_eq!(resume["priorities"][0]["index"], serde_json::json!(2));
+        assert_eq!(resume["sequential"], serde_json::json!(true));
+        assert_eq!(
+            resume["rate_limit"]["download_bps"],
+            serde_json::json!(4_096)
+        );
+
+        let metadata = state
+            .metadata
+            .ok_or_else(|| anyhow!("expected stored metadata"))?;
+        assert_eq!(metadata.tags, vec!["persisted".to_string()]);
+        assert!(metadata.sequential);
+        Ok(())
+    }
+
     #[tokio::test]
     async fn alt_speed_schedule_applies_and_reverts() -> Result<()> {
         let bus = EventBus::with_capacity(4);
@@ -3110,6 +3853,11 @@ mod tests {
             coalesce_reads: true.into(),
             coalesce_writes: true.into(),
             use_disk_cache_pool: true.into(),
+            disk_io_backend: crate::types::DiskIoBackend::Auto,
+            aio_threads: None,
+            hashing_threads: None,
+            resume_checkpoint_interval_ms: None,
+            resume_max_inflight_saves: None,
             listen_interfaces: Vec::new(),
             ipv6_mode: Ipv6Mode::Disabled,
             enable_dht: false,
@@ -3301,7 +4049,11 @@ mod tests {
             Ok(())
         }
 
-        async fn load_fastresume(&mut self, _id: Uuid, _payload: &[u8]) -> TorrentResult<()> {
+        async fn load_fastresume(
+            &mut self,
+            _id: Uuid,
+            _payload: Arc<Vec<u8>>,
+        ) -> TorrentResult<()> {
             Ok(())
         }
 
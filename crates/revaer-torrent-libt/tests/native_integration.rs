@@ -58,6 +58,11 @@ fn base_runtime_config(download: &TempDir, resume: &TempDir) -> EngineRuntimeCon
         coalesce_reads: true.into(),
         coalesce_writes: true.into(),
         use_disk_cache_pool: true.into(),
+        disk_io_backend: revaer_torrent_libt::types::DiskIoBackend::Auto,
+        aio_threads: None,
+        hashing_threads: None,
+        resume_checkpoint_interval_ms: None,
+        resume_max_inflight_saves: None,
         listen_interfaces: Vec::new(),
         ipv6_mode: Ipv6Mode::Disabled,
         enable_dht: true,
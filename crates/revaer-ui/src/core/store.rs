@@ -530,7 +530,8 @@ pub(crate) fn apply_sse_envelope(
                 );
                 SseApplyOutcome::Applied
             }
-            CoreEvent::SelectionReconciled { .. }
+            CoreEvent::FileProgress { .. }
+            | CoreEvent::SelectionReconciled { .. }
             | CoreEvent::SettingsChanged { .. }
             | CoreEvent::HealthChanged { .. } => SseApplyOutcome::Refresh,
         },
@@ -99,6 +99,11 @@ const STORAGE_FIELDS: &[&str] = &[
     "coalesce_writes",
     "use_disk_cache_pool",
     "max_queued_disk_bytes",
+    "resume_checkpoint_interval_ms",
+    "resume_max_inflight_saves",
+    "disk_io_backend",
+    "aio_threads",
+    "hashing_threads",
 ];
 
 pub(crate) const WEEKDAYS: [(&str, &str); 7] = [
@@ -836,7 +841,7 @@ pub(crate) fn select_options(
             (section, key),
             (
                 SettingsSection::EngineProfile,
-                "disk_read_mode" | "disk_write_mode"
+                "disk_read_mode" | "disk_write_mode" | "disk_io_backend"
             )
         );
     let options = match (section, key) {
@@ -881,6 +886,10 @@ pub(crate) fn select_options(
             ),
             ("write_through".to_string(), "settings.option.write_through"),
         ],
+        (SettingsSection::EngineProfile, "disk_io_backend") => vec![
+            ("mmap".to_string(), "settings.option.mmap"),
+            ("posix".to_string(), "settings.option.posix"),
+        ],
         (SettingsSection::FsPolicy, "par2") => vec![
             ("off".to_string(), "settings.option.off"),
             ("verify".to_string(), "settings.option.verify"),
@@ -921,7 +930,11 @@ pub(crate) fn numeric_kind(section: SettingsSection, key: &str) -> Option<Numeri
         | "max_upload_bps"
         | "seed_time_limit"
         | "stats_interval_ms"
-        | "max_queued_disk_bytes" => Some(NumericKind::Integer),
+        | "max_queued_disk_bytes"
+        | "resume_checkpoint_interval_ms"
+        | "resume_max_inflight_saves"
+        | "aio_threads"
+        | "hashing_threads" => Some(NumericKind::Integer),
         "seed_ratio_limit" => Some(NumericKind::Float),
         _ => None,
     }
@@ -440,6 +440,7 @@ pub(crate) fn create_torrent_panel(props: &CreateTorrentProps) -> Html {
                 private: *private,
                 comment: optional_string(&comment),
                 source: optional_string(&source),
+                ..TorrentAuthorRequest::default()
             };
             local_error.set(None);
             on_submit.emit(request);